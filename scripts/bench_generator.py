@@ -0,0 +1,217 @@
+#!/usr/bin/env python3
+"""
+Generator self-benchmark for the primitives of generator.h
+
+Compiles scripts/generator_bench.cpp against src/app/resources/generator.h
+and runs every primitive at several sizes, one process per case, so slow
+stress runs can be attributed to the generator or to the solutions.
+
+Per case it reports:
+- values/s: scalar values generated per second (construction only)
+- bytes/s: output bytes formatted per second by print()
+- peak RSS of the case process (VmHWM, Linux only)
+
+Results are written as JSON (schema below). With --baseline, the run is
+compared against an earlier result file and the script exits with code 1
+if any case got slower than --max-slowdown allows, so header changes can be
+checked for regressions.
+
+Usage:
+    python scripts/bench_generator.py [options]
+
+Examples:
+    # Full suite, save results
+    python scripts/bench_generator.py -o generator_bench.json
+
+    # Quick check of two primitives against a saved baseline
+    python scripts/bench_generator.py --cases rvector tree --sizes 100000 \\
+        --baseline generator_bench.json
+
+JSON output:
+    {"schema": 1, "compiler": ..., "flags": [...], "header_sha256": ...,
+     "results": [{"case", "size", "values", "bytes", "gen_seconds",
+                  "print_seconds", "values_per_sec", "bytes_per_sec",
+                  "peak_rss_kb"}, ...]}
+"""
+
+import argparse
+import hashlib
+import json
+import os
+import platform
+import shlex
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+
+PROJECT_ROOT = Path(__file__).resolve().parent.parent
+HEADER_DIR = PROJECT_ROOT / "src" / "app" / "resources"
+BENCH_SOURCE = Path(__file__).resolve().parent / "generator_bench.cpp"
+
+CASES = [
+    "random_int",
+    "random_double",
+    "random_char",
+    "rvector",
+    "rstring",
+    "rmatrix",
+    "permutation",
+    "unique_vector_dense",
+    "unique_vector_sparse",
+    "tree",
+    "binary_tree",
+    "graph",
+    "points",
+    "ordered_set",
+]
+DEFAULT_SIZES = [1000, 100000, 1000000]
+DEFAULT_FLAGS = ["-O2", "-std=c++17"]
+
+# Fixed seed so every run generates the same data
+BENCH_SEED = "20240601"
+
+
+def compile_bench(compiler, flags, output_dir):
+    """Compile the benchmark harness; returns the executable path."""
+    executable = Path(output_dir) / ("generator_bench.exe" if os.name == "nt" else "generator_bench")
+    cmd = [compiler, *flags, f"-I{HEADER_DIR}", str(BENCH_SOURCE), "-o", str(executable)]
+    result = subprocess.run(cmd, capture_output=True, text=True)
+    if result.returncode != 0:
+        sys.exit(f"Compilation failed:\n{result.stderr}")
+    return executable
+
+
+def run_case(executable, case, size, repetitions):
+    """
+    Run one case in its own process.
+
+    peak_rss_kb is measured by the case process itself (VmHWM), since the
+    rusage of a forked child also covers this driver; it is None where
+    /proc is not available.
+    """
+    env = dict(os.environ, CTS_SEED=BENCH_SEED)
+    process = subprocess.run(
+        [str(executable), case, str(size), str(repetitions)],
+        capture_output=True,
+        text=True,
+        env=env,
+    )
+    if process.returncode != 0:
+        return {"case": case, "size": size, "error": process.stderr.strip() or f"exit code {process.returncode}"}
+    return json.loads(process.stdout)
+
+
+def add_rates(result):
+    """Derive values/s and bytes/s from the measured times."""
+    gen = result["gen_seconds"]
+    printing = result["print_seconds"]
+    result["values_per_sec"] = result["values"] / gen if gen > 0 else None
+    result["bytes_per_sec"] = result["bytes"] / printing if printing > 0 else None
+    return result
+
+
+def compare(results, baseline_path, max_slowdown):
+    """
+    Compare values/s and bytes/s against a baseline run.
+
+    Returns:
+        list: Human-readable regression descriptions
+    """
+    with open(baseline_path, encoding="utf-8") as f:
+        baseline = {
+            (r["case"], r["size"]): r for r in json.load(f).get("results", []) if "error" not in r
+        }
+
+    regressions = []
+    for result in results:
+        old = baseline.get((result["case"], result["size"]))
+        if not old or "error" in result:
+            continue
+        for metric in ("values_per_sec", "bytes_per_sec"):
+            before, now = old.get(metric), result.get(metric)
+            if before and now and before / now > max_slowdown:
+                regressions.append(
+                    f"{result['case']} n={result['size']}: {metric} "
+                    f"{before:,.0f} -> {now:,.0f} ({before / now:.2f}x slower)"
+                )
+    return regressions
+
+
+def print_table(results):
+    print(f"{'case':<22}{'size':>10}{'values/s':>16}{'bytes/s':>16}{'peak RSS':>12}")
+    for r in results:
+        if "error" in r:
+            print(f"{r['case']:<22}{r['size']:>10}  error: {r['error']}")
+            continue
+        rss = f"{r['peak_rss_kb'] / 1024:.1f} MB" if r.get("peak_rss_kb") is not None else "n/a"
+        values = f"{r['values_per_sec']:,.0f}" if r["values_per_sec"] else "-"
+        rate = f"{r['bytes_per_sec']:,.0f}" if r["bytes_per_sec"] else "-"
+        print(f"{r['case']:<22}{r['size']:>10}{values:>16}{rate:>16}{rss:>12}")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Benchmark the primitives of generator.h",
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+    )
+    parser.add_argument("--cases", nargs="+", choices=CASES, default=CASES, help="Cases to run")
+    parser.add_argument("--sizes", nargs="+", type=int, default=DEFAULT_SIZES, help="Input sizes")
+    parser.add_argument("--repetitions", type=int, default=3, help="Runs per case (best time wins)")
+    parser.add_argument("--compiler", default="g++", help="C++ compiler")
+    parser.add_argument(
+        "--flags", default=" ".join(DEFAULT_FLAGS),
+        help='Compiler flags as one string (e.g. --flags="-O3 -march=native")',
+    )
+    parser.add_argument("-o", "--output", help="Write JSON results to this file")
+    parser.add_argument("--baseline", help="Earlier JSON results to compare against")
+    parser.add_argument(
+        "--max-slowdown", type=float, default=1.5,
+        help="Allowed slowdown factor against the baseline (default: 1.5; "
+        "small sizes are noisy)",
+    )
+    parser.add_argument("--json", action="store_true", help="Print JSON instead of a table")
+    args = parser.parse_args()
+    args.flags = shlex.split(args.flags)
+
+    with tempfile.TemporaryDirectory(prefix="generator_bench_") as build_dir:
+        executable = compile_bench(args.compiler, args.flags, build_dir)
+        results = []
+        for case in args.cases:
+            for size in args.sizes:
+                result = run_case(executable, case, size, args.repetitions)
+                results.append(add_rates(result) if "error" not in result else result)
+                if not args.json:
+                    print(f"  {case} n={size} done", file=sys.stderr)
+
+    header = (HEADER_DIR / "generator.h").read_bytes()
+    report = {
+        "schema": 1,
+        "compiler": args.compiler,
+        "flags": args.flags,
+        "platform": platform.platform(),
+        "header_sha256": hashlib.sha256(header).hexdigest(),
+        "results": results,
+    }
+
+    if args.output:
+        with open(args.output, "w", encoding="utf-8") as f:
+            json.dump(report, f, indent=2)
+
+    if args.json:
+        json.dump(report, sys.stdout, indent=2)
+        print()
+    else:
+        print_table(results)
+
+    if args.baseline:
+        regressions = compare(results, args.baseline, args.max_slowdown)
+        for line in regressions:
+            print(f"REGRESSION {line}", file=sys.stderr)
+        if regressions:
+            return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,211 @@
+// Self-benchmark for the primitives of generator.h.
+//
+// Built and driven by scripts/bench_generator.py; one process per case so
+// the driver can attribute peak memory to a single primitive and size:
+//
+//     generator_bench <case> <size> <repetitions>
+//
+// Prints one JSON object: scalar values generated, bytes printed, the best
+// generation / printing time over all repetitions and the process peak RSS
+// (VmHWM, Linux only; null elsewhere). Printing goes
+// through the primitive's print() into a counting sink, so bytes/s measures
+// formatting without terminal or pipe costs.
+
+#include "generator.h"
+
+namespace
+{
+
+// Stream buffer that discards everything and counts bytes
+class CountingBuf : public streambuf
+{
+public:
+  size_t bytes = 0;
+
+protected:
+  int overflow(int c) override
+  {
+    if (c != EOF)
+      ++bytes;
+    return c;
+  }
+  streamsize xsputn(const char *, streamsize n) override
+  {
+    bytes += static_cast<size_t>(n);
+    return n;
+  }
+};
+
+struct Sample
+{
+  size_t values = 0;
+  double gen_seconds = 0;
+  double print_seconds = 0;
+};
+
+using Clock = chrono::steady_clock;
+
+double seconds_since(Clock::time_point start)
+{
+  return chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Times construction and print() of a generator object
+template <typename Make>
+Sample measure(Make make, size_t values)
+{
+  Sample sample;
+  sample.values = values;
+  auto start = Clock::now();
+  auto object = make();
+  sample.gen_seconds = seconds_since(start);
+  start = Clock::now();
+  object.print();
+  sample.print_seconds = seconds_since(start);
+  return sample;
+}
+
+// Times n scalar random<T>() calls; printing is n values, one per line
+template <typename T>
+Sample measure_scalar(size_t n, T l, T r)
+{
+  Sample sample;
+  sample.values = n;
+  vector<T> out(n);
+  auto start = Clock::now();
+  for (auto &x : out)
+    x = random(l, r);
+  sample.gen_seconds = seconds_since(start);
+  start = Clock::now();
+  for (const auto &x : out)
+    cout << x << "\n";
+  sample.print_seconds = seconds_since(start);
+  return sample;
+}
+
+Sample run_case(const string &name, size_t n)
+{
+  int ni = static_cast<int>(n);
+  if (name == "random_int")
+    return measure_scalar<long long>(n, 1, 1000000000000000000LL);
+  if (name == "random_double")
+    return measure_scalar<double>(n, 0.0, 1.0);
+  if (name == "random_char")
+    return measure_scalar<char>(n, 'a', 'z');
+  if (name == "rvector")
+    return measure([&]
+                   { return rvector<int>(n, 1, 1000000000); }, n);
+  if (name == "rstring")
+    return measure([&]
+                   { return rstring(n, 'a', 'z'); }, n);
+  if (name == "rmatrix")
+  {
+    size_t side = max<size_t>(1, static_cast<size_t>(sqrt(static_cast<double>(n))));
+    return measure([&]
+                   { return rmatrix<int>(side, side, 0, 9); }, side * side);
+  }
+  if (name == "permutation")
+    return measure([&]
+                   { return permutation(ni); }, n);
+  if (name == "unique_vector_dense")
+    return measure([&]
+                   { return unique_vector<long long>(n, 1, 2 * static_cast<long long>(n)); }, n);
+  if (name == "unique_vector_sparse")
+    return measure([&]
+                   { return unique_vector<long long>(n, 1, 1000000000000000000LL); }, n);
+  if (name == "tree")
+    return measure([&]
+                   { return Tree<>(ni, 1, 1000000000); }, 3 * (n - 1));
+  if (name == "binary_tree")
+    return measure([&]
+                   { return BinaryTree<>(ni); }, 2 * (n - 1));
+  if (name == "graph")
+    return measure([&]
+                   { return Graph<>(ni, 2 * ni); }, 4 * n);
+  if (name == "points")
+    return measure([&]
+                   { return points(ni, -1000000000, 1000000000); }, 2 * n);
+  if (name == "ordered_set")
+  {
+    // Not a generator: insertions plus order-statistics queries
+    Sample sample;
+    sample.values = 2 * n;
+    ordered_set<long long> s;
+    auto start = Clock::now();
+    for (size_t i = 0; i < n; ++i)
+      s.insert(random(1LL, 1000000000000000000LL));
+    long long checksum = 0;
+    for (size_t i = 0; i < n; ++i)
+      checksum += static_cast<long long>(s.order_of_key(random(1LL, 1000000000000000000LL)));
+    sample.gen_seconds = seconds_since(start);
+    start = Clock::now();
+    cout << checksum << "\n";
+    sample.print_seconds = seconds_since(start);
+    return sample;
+  }
+  throw invalid_argument("unknown case: " + name);
+}
+
+// Peak resident set size of this process in KB (VmHWM), or -1 if unknown.
+// Read here rather than from the parent's wait4(): on Linux the child's
+// ru_maxrss keeps the high-water mark of the forked driver from before exec.
+long peak_rss_kb()
+{
+  ifstream status("/proc/self/status");
+  string line;
+  while (getline(status, line))
+    if (line.compare(0, 6, "VmHWM:") == 0)
+      return strtol(line.c_str() + 6, nullptr, 10);
+  return -1;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+  if (argc < 3)
+  {
+    cerr << "usage: " << argv[0] << " <case> <size> [repetitions]\n";
+    return 2;
+  }
+  string name = argv[1];
+  size_t n = strtoull(argv[2], nullptr, 10);
+  int repetitions = argc > 3 ? max(1, atoi(argv[3])) : 1;
+
+  CountingBuf sink;
+  streambuf *original = cout.rdbuf(&sink);
+
+  Sample best;
+  size_t bytes = 0;
+  try
+  {
+    for (int i = 0; i < repetitions; ++i)
+    {
+      sink.bytes = 0;
+      Sample sample = run_case(name, n);
+      cout.flush();
+      bytes = sink.bytes;
+      if (i == 0 || sample.gen_seconds < best.gen_seconds)
+        best.gen_seconds = sample.gen_seconds;
+      if (i == 0 || sample.print_seconds < best.print_seconds)
+        best.print_seconds = sample.print_seconds;
+      best.values = sample.values;
+    }
+  }
+  catch (const exception &e)
+  {
+    cout.rdbuf(original);
+    cerr << e.what() << "\n";
+    return 1;
+  }
+
+  cout.rdbuf(original);
+  long peak = peak_rss_kb();
+  cout << setprecision(9)
+       << "{\"case\": \"" << name << "\", \"size\": " << n
+       << ", \"values\": " << best.values << ", \"bytes\": " << bytes
+       << ", \"gen_seconds\": " << best.gen_seconds
+       << ", \"print_seconds\": " << best.print_seconds
+       << ", \"peak_rss_kb\": " << (peak < 0 ? "null" : to_string(peak)) << "}\n";
+  return 0;
+}
@@ -0,0 +1,325 @@
+#!/usr/bin/env python3
+"""
+Headless command-line runner for CI and nightly performance jobs.
+
+Runs the comparator, validator or benchmarker of a workspace without the
+GUI and without importing PySide6 (CTS_HEADLESS, see
+core/tools/base/qt_compat.py): the same compiler, workers and analysis as
+the app, with results written as JSON.
+
+    python -m src.app.cli comparator --tests 1000 [--workspace DIR]
+    python -m src.app.cli benchmarker --tests 20 --time-limit 1000 --format json
+    python -m src.app.cli validator --tests 500 --set comparator.tiered=true
+    python -m src.app.cli comparator --tests 1000000 --checkpoint 60
+    python -m src.app.cli resume <journal>
+
+Source files are looked up as <workspace>/<tool>/<role>.{cpp,py,java}
+(Java: capitalized), or given with --file ROLE=PATH. The configuration is
+the app's config.json unless --config names another one; --set overrides
+single keys (values are parsed as JSON, else kept as strings).
+
+Output (stdout, or --output FILE):
+    ndjson: one {"type": "test", ...} line per test as it completes, then a
+            {"type": "summary", ...} line
+    json:   one document {"summary": {...}, "tests": [...]} at the end
+
+Per-test records leave out the full input/output copies (*_full keys)
+unless --full is given. The summary carries the counts, total time, run
+seed and the tool's analysis (the mismatch_analysis saved by the app).
+
+With --checkpoint the run is journaled every SECONDS (default 30) to
+<workspace>/<tool>/checkpoints/run-<seed>.jsonl (the path is printed to
+stderr). After a crash or restart, resume continues the journal's run from
+its last checkpoint with the same tool, sources, seed and options, without
+repeating completed tests; the summary then covers the whole run. It stops
+if the compiled binaries differ from the run's, unless --force is given.
+
+Exit status: 0 if every test passed, 1 if any failed, 2 if compilation
+failed or the arguments were invalid.
+"""
+
+import argparse
+import json
+import os
+import sys
+import time
+
+# Tools, roles and the run options of each tool
+TOOLS = {
+    "comparator": ("generator", "correct", "test"),
+    "validator": ("generator", "test", "validator"),
+    "benchmarker": ("generator", "test"),
+}
+
+SOURCE_EXTENSIONS = ("cpp", "py", "java")
+
+EXIT_PASSED = 0
+EXIT_FAILED = 1
+EXIT_ERROR = 2
+
+# Seconds between checkpoints with a bare --checkpoint
+# (base.checkpoint.DEFAULT_CHECKPOINT_INTERVAL, not imported before parsing)
+DEFAULT_CHECKPOINT_SECONDS = 30.0
+
+
+def parse_args(argv=None):
+    # Options of every command
+    common = argparse.ArgumentParser(add_help=False)
+    common.add_argument("--config", default=None, help="Config file (default: the app's config.json)")
+    common.add_argument(
+        "--set", action="append", default=[], metavar="KEY=VALUE", help="Override a config key (a.b.c=value)"
+    )
+    common.add_argument("--format", choices=("ndjson", "json"), default="ndjson", help="Output format")
+    common.add_argument("--output", default=None, help="Write results to this file instead of stdout")
+    common.add_argument("--full", action="store_true", help="Keep full inputs/outputs in test records")
+    common.add_argument("--save", action="store_true", help="Also save the run to the app's database")
+    common.add_argument("--verbose", action="store_true", help="Print compiler output to stderr")
+
+    parser = argparse.ArgumentParser(
+        prog="python -m src.app.cli",
+        description="Run comparator, validator or benchmarker tests without the GUI",
+    )
+    commands = parser.add_subparsers(dest="tool", required=True, metavar="{%s,resume}" % ",".join(sorted(TOOLS)))
+    for tool in sorted(TOOLS):
+        command = commands.add_parser(tool, parents=[common], help=f"Run {tool} tests")
+        command.add_argument("--tests", type=int, default=100, help="Number of tests (default: 100)")
+        command.add_argument("--workspace", default=None, help="Workspace directory (default: the app's)")
+        command.add_argument(
+            "--file", action="append", default=[], metavar="ROLE=PATH", help="Source file of a role"
+        )
+        command.add_argument("--workers", type=int, default=None, help="Parallel tests (default: automatic)")
+        command.add_argument("--seed", type=int, default=None, help="Run seed to reproduce a run")
+        command.add_argument(
+            "--checkpoint",
+            type=float,
+            nargs="?",
+            const=DEFAULT_CHECKPOINT_SECONDS,
+            default=None,
+            metavar="SECONDS",
+            help=f"Journal the run every SECONDS (default: {DEFAULT_CHECKPOINT_SECONDS:g}) to resume it later",
+        )
+        if tool == "benchmarker":
+            command.add_argument("--time-limit", type=int, default=1000, help="Time limit in ms")
+            command.add_argument("--memory-limit", type=int, default=256, help="Memory limit in MB")
+
+    resume = commands.add_parser("resume", parents=[common], help="Continue a checkpointed run")
+    resume.add_argument("journal", help="Journal of the run (printed when it started)")
+    resume.add_argument("--force", action="store_true", help="Resume even if the binaries changed")
+    return parser.parse_args(argv)
+
+
+def load_config(path, overrides):
+    """
+    Load the config file and apply KEY=VALUE overrides.
+
+    Raises:
+        ValueError: On an override without '='
+    """
+    config = {}
+    if path is None:
+        from src.app.shared.constants.paths import CONFIG_FILE
+
+        path = CONFIG_FILE if os.path.exists(CONFIG_FILE) else None
+    if path is not None:
+        with open(path, encoding="utf-8") as f:
+            config = json.load(f)
+
+    for override in overrides:
+        key, separator, raw_value = override.partition("=")
+        if not separator or not key:
+            raise ValueError(f"Invalid --set {override!r}, expected KEY=VALUE")
+        try:
+            value = json.loads(raw_value)
+        except json.JSONDecodeError:
+            value = raw_value
+        target = config
+        *parents, leaf = key.split(".")
+        for parent in parents:
+            target = target.setdefault(parent, {})
+        target[leaf] = value
+    return config
+
+
+def find_sources(workspace_dir, tool, file_args):
+    """
+    Get the source file of every role of a tool.
+
+    Raises:
+        ValueError: If a role has no source file
+    """
+    from src.app.shared.constants.file_constants import get_source_filename
+    from src.app.shared.constants.paths import get_workspace_file_path
+
+    files = {}
+    for file_arg in file_args:
+        role, separator, path = file_arg.partition("=")
+        if not separator or role not in TOOLS[tool]:
+            raise ValueError(f"Invalid --file {file_arg!r}, roles of {tool}: {', '.join(TOOLS[tool])}")
+        files[role] = os.path.abspath(path)
+
+    for role in TOOLS[tool]:
+        if role in files:
+            continue
+        for extension in SOURCE_EXTENSIONS:
+            path = get_workspace_file_path(workspace_dir, tool, get_source_filename(role, extension))
+            if os.path.exists(path):
+                files[role] = path
+                break
+        else:
+            raise ValueError(f"No {role} source in {os.path.join(workspace_dir, tool)}")
+    return files
+
+
+def create_runner(tool, workspace_dir, files, config):
+    """Create the runner of a tool (imports only that tool)."""
+    if tool == "comparator":
+        from src.app.core.tools.comparator import Comparator
+
+        return Comparator(workspace_dir, files=files, config=config)
+    if tool == "validator":
+        from src.app.core.tools.validator import ValidatorRunner
+
+        return ValidatorRunner(workspace_dir, files=files, config=config)
+    from src.app.core.tools.benchmarker import Benchmarker
+
+    return Benchmarker(workspace_dir, files=files, config=config)
+
+
+def test_record(result, full):
+    """JSON-safe record of one test result."""
+    record = {"type": "test"}
+    for key, value in result.items():
+        if not full and key.endswith("_full"):
+            continue
+        record[key] = value
+    return record
+
+
+def write_line(stream, document):
+    stream.write(json.dumps(document, default=str, separators=(",", ":")) + "\n")
+    stream.flush()
+
+
+def run(args, stream):
+    """
+    Compile, run the tests and write the results.
+
+    Returns:
+        int: Exit status
+    """
+    from src.app.shared.constants.paths import WORKSPACE_DIR, normalize_test_type
+
+    journal = None
+    try:
+        config = load_config(args.config, args.set)
+        if args.tool == "resume":
+            from src.app.core.tools.base.checkpoint import RunJournal
+
+            journal = RunJournal.load(args.journal)
+            tool = normalize_test_type(journal.header["test_type"])
+            workspace_dir = journal.header["workspace_dir"]
+            files = journal.header["files"]
+        else:
+            tool = args.tool
+            workspace_dir = os.path.abspath(args.workspace or WORKSPACE_DIR)
+            files = find_sources(workspace_dir, tool, args.file)
+    except (OSError, KeyError, ValueError) as e:
+        print(f"error: {e}", file=sys.stderr)
+        return EXIT_ERROR
+    if journal is not None and journal.complete:
+        print(f"error: every test of {args.journal} already completed", file=sys.stderr)
+        return EXIT_ERROR
+
+    runner = create_runner(tool, workspace_dir, files, config)
+    if journal is not None:
+        journal = runner.resume_from(args.journal, force=args.force)
+        resumed_from = journal.completed
+    elif args.checkpoint is not None:
+        runner.enable_checkpoints(args.checkpoint)
+    if args.verbose:
+        runner.compilationOutput.connect(lambda message, kind: sys.stderr.write(message))
+
+    compile_start = time.perf_counter()
+    compiled = runner.compile_all(blocking=True)
+    compile_time = time.perf_counter() - compile_start
+    if not compiled:
+        document = {"type": "summary", "tool": tool, "compiled": False, "compile_time": compile_time}
+        write_line(stream, document)
+        print("error: compilation failed (use --verbose for compiler output)", file=sys.stderr)
+        return EXIT_ERROR
+
+    if journal is not None:
+        test_count = journal.test_count
+        run_options = journal.header["options"]
+    else:
+        test_count = args.tests
+        run_options = {"max_workers": args.workers}
+        if args.seed is not None:
+            run_options["run_seed"] = args.seed
+        if tool == "benchmarker":
+            run_options.update(time_limit=args.time_limit, memory_limit=args.memory_limit)
+
+    try:
+        worker = runner.prepare_worker(test_count, **run_options)
+    except ValueError as e:
+        print(f"error: {e}", file=sys.stderr)
+        return EXIT_ERROR
+    if worker.journal is not None:
+        print(f"checkpoint journal: {worker.journal.path}", file=sys.stderr)
+    if args.format == "ndjson":
+        worker.resultRecorded.connect(lambda result: write_line(stream, test_record(result, args.full)))
+    worker.run_tests()
+
+    test_result = runner.build_test_result()
+    summary = {
+        "type": "summary",
+        "tool": tool,
+        "compiled": True,
+        "compile_time": compile_time,
+        "test_count": test_count,
+        "passed_tests": test_result.passed_tests if test_result else 0,
+        "failed_tests": test_result.failed_tests if test_result else 0,
+        "total_time": test_result.total_time if test_result else 0.0,
+        "run_seed": getattr(worker, "run_seed", None),
+        "analysis": json.loads(test_result.mismatch_analysis) if test_result else {},
+    }
+    if journal is not None:
+        summary["resumed_from"] = resumed_from
+    if args.save and test_result:
+        summary["result_id"] = runner.db_manager.save_test_result(test_result)
+
+    if args.format == "ndjson":
+        write_line(stream, summary)
+    else:
+        del summary["type"]
+        tests = [test_record(result, args.full) for result in worker.get_test_results()]
+        for record in tests:
+            del record["type"]
+        stream.write(json.dumps({"summary": summary, "tests": tests}, default=str, indent=2) + "\n")
+
+    all_passed = test_result is not None and test_result.failed_tests == 0 and test_result.passed_tests > 0
+    return EXIT_PASSED if all_passed else EXIT_FAILED
+
+
+def main(argv=None):
+    args = parse_args(argv)
+
+    # Must be set before any core tool module is imported
+    os.environ["CTS_HEADLESS"] = "1"
+
+    import logging
+
+    logging.basicConfig(level=logging.WARNING, format="%(levelname)s:%(name)s:%(message)s")
+
+    if args.output:
+        with open(args.output, "w", encoding="utf-8") as stream:
+            return run(args, stream)
+    return run(args, sys.stdout)
+
+
+if __name__ == "__main__":
+    # Allow running as a file as well as with -m
+    project_root = os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+    if project_root not in sys.path:
+        sys.path.insert(0, project_root)
+    sys.exit(main())
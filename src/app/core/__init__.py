@@ -3,32 +3,68 @@ Core module for the Code Testing Suite.
 
 This module contains the core business logic and domain models,
 including AI functionality, configuration management, and tools.
+
+Note: Uses lazy imports, so the headless CLI can import the tools without
+loading the AI and configuration UI modules (and Qt widgets).
 """
 
-# AI Module exports
-from src.app.core.ai import (
-    EditorAI,
-    PromptTemplates,
-    get_gemini_client,
-    initialize_gemini,
-    is_ai_ready,
-    is_gemini_available,
-    should_show_ai_panel,
-)
-
-# Configuration Module exports
-from src.app.core.config import (
-    ConfigError,
-    ConfigLoadError,
-    ConfigManager,
-    ConfigPersistence,
-    ConfigSaveError,
-    DatabaseOperations,
-    GeminiConfig,
-    GeminiConfigUI,
-)
-from src.app.core.tools.benchmarker import BenchmarkCompilerRunner, Benchmarker
-from src.app.core.tools.comparator import Comparator
-
-# Tools Module exports
-from src.app.core.tools.compiler_runner import CompilerRunner
+from typing import TYPE_CHECKING
+
+if TYPE_CHECKING:
+    from src.app.core.ai import (
+        EditorAI,
+        PromptTemplates,
+        get_gemini_client,
+        initialize_gemini,
+        is_ai_ready,
+        is_gemini_available,
+        should_show_ai_panel,
+    )
+    from src.app.core.config import (
+        ConfigError,
+        ConfigLoadError,
+        ConfigManager,
+        ConfigPersistence,
+        ConfigSaveError,
+        DatabaseOperations,
+        GeminiConfig,
+        GeminiConfigUI,
+    )
+    from src.app.core.tools.benchmarker import BenchmarkCompilerRunner, Benchmarker
+    from src.app.core.tools.comparator import Comparator
+    from src.app.core.tools.compiler_runner import CompilerRunner
+
+# Exported name -> module it lives in
+_EXPORTS = {
+    # AI Module exports
+    "EditorAI": "src.app.core.ai",
+    "PromptTemplates": "src.app.core.ai",
+    "get_gemini_client": "src.app.core.ai",
+    "initialize_gemini": "src.app.core.ai",
+    "is_ai_ready": "src.app.core.ai",
+    "is_gemini_available": "src.app.core.ai",
+    "should_show_ai_panel": "src.app.core.ai",
+    # Configuration Module exports
+    "ConfigError": "src.app.core.config",
+    "ConfigLoadError": "src.app.core.config",
+    "ConfigManager": "src.app.core.config",
+    "ConfigPersistence": "src.app.core.config",
+    "ConfigSaveError": "src.app.core.config",
+    "DatabaseOperations": "src.app.core.config",
+    "GeminiConfig": "src.app.core.config",
+    "GeminiConfigUI": "src.app.core.config",
+    # Tools Module exports
+    "BenchmarkCompilerRunner": "src.app.core.tools.benchmarker",
+    "Benchmarker": "src.app.core.tools.benchmarker",
+    "Comparator": "src.app.core.tools.comparator",
+    "CompilerRunner": "src.app.core.tools.compiler_runner",
+}
+
+
+def __getattr__(name: str):
+    """Lazy import exports on first access."""
+    if name in _EXPORTS:
+        import importlib
+
+        return getattr(importlib.import_module(_EXPORTS[name]), name)
+    raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
@@ -40,11 +40,16 @@ class ConfigDialogProtocol(Protocol):
     cpp_std_combo: Optional[QComboBox]
     cpp_opt_combo: Optional[QComboBox]
     cpp_flags_input: Optional[QLineEdit]
+    cpp_stack_limit_spin: Optional[QSpinBox]
+    cpp_stress_build_checkbox: Optional[QCheckBox]
     py_interpreter_combo: Optional[QComboBox]
     py_flags_input: Optional[QLineEdit]
+    py_warm_pool_checkbox: Optional[QCheckBox]
     java_compiler_combo: Optional[QComboBox]
     java_runtime_combo: Optional[QComboBox]
     java_flags_input: Optional[QLineEdit]
+    java_cds_checkbox: Optional[QCheckBox]
+    java_warm_jvm_checkbox: Optional[QCheckBox]
     
     # Optional editor settings attributes
     font_family_combo: Optional[QComboBox]
@@ -271,17 +276,22 @@ class ConfigManager:
                     "std_version": "c++17",
                     "optimization": "O2",
                     "flags": ["-march=native", "-mtune=native", "-pipe", "-Wall"],
+                    "stack_limit_mb": 256,  # RLIMIT_STACK for solutions (0 = unlimited)
+                    "stress_build": False,  # Static, non-PIE, eagerly bound executables
                 },
                 "py": {
                     "interpreter": "python",
                     "version": "3",
                     "flags": ["-u"],  # Unbuffered output
+                    "warm_pool": False,  # Fork a warm interpreter per test
                 },
                 "java": {
                     "compiler": "javac",
                     "version": "11",
                     "flags": [],
                     "runtime": "java",
+                    "cds": True,  # Class data sharing archive per compiled class
+                    "warm_jvm": False,  # Run tests in persistent JVMs
                 },
             },
             "gemini": {  # Standardized format (Phase 1)
@@ -394,6 +404,8 @@ class ConfigPersistence:
         cpp_flags = cpp_config.get("flags", [])
         cpp_flags_str = ", ".join(cpp_flags) if isinstance(cpp_flags, list) else str(cpp_flags)
         self._set_line_edit_text("cpp_flags_input", cpp_flags_str)
+        self._set_spin_value("cpp_stack_limit_spin", cpp_config.get("stack_limit_mb", 256))
+        self._set_checkbox_checked("cpp_stress_build_checkbox", bool(cpp_config.get("stress_build", False)))
 
         # Python configuration
         py_config = languages.get("py", {})
@@ -402,6 +414,7 @@ class ConfigPersistence:
         py_flags = py_config.get("flags", [])
         py_flags_str = ", ".join(py_flags) if isinstance(py_flags, list) else str(py_flags)
         self._set_line_edit_text("py_flags_input", py_flags_str)
+        self._set_checkbox_checked("py_warm_pool_checkbox", bool(py_config.get("warm_pool", False)))
 
         # Java configuration
         java_config = languages.get("java", {})
@@ -411,6 +424,8 @@ class ConfigPersistence:
         java_flags = java_config.get("flags", [])
         java_flags_str = ", ".join(java_flags) if isinstance(java_flags, list) else str(java_flags)
         self._set_line_edit_text("java_flags_input", java_flags_str)
+        self._set_checkbox_checked("java_cds_checkbox", bool(java_config.get("cds", True)))
+        self._set_checkbox_checked("java_warm_jvm_checkbox", bool(java_config.get("warm_jvm", False)))
 
         # Updated for new gemini format (Phase 1)
         gemini_settings = (
@@ -520,6 +535,14 @@ class ConfigPersistence:
                                 ",".join(current_config.get("languages", {}).get("cpp", {}).get("flags", []))
                             )
                         ),
+                        "stack_limit_mb": self._get_spin_value(
+                            "cpp_stack_limit_spin",
+                            current_config.get("languages", {}).get("cpp", {}).get("stack_limit_mb", 256)
+                        ),
+                        "stress_build": self._get_checkbox_checked(
+                            "cpp_stress_build_checkbox",
+                            current_config.get("languages", {}).get("cpp", {}).get("stress_build", False)
+                        ),
                     },
                     "py": {
                         "interpreter": self._get_combo_text(
@@ -533,6 +556,10 @@ class ConfigPersistence:
                                 ",".join(current_config.get("languages", {}).get("py", {}).get("flags", []))
                             )
                         ),
+                        "warm_pool": self._get_checkbox_checked(
+                            "py_warm_pool_checkbox",
+                            current_config.get("languages", {}).get("py", {}).get("warm_pool", False)
+                        ),
                     },
                     "java": {
                         "compiler": self._get_combo_text(
@@ -550,6 +577,14 @@ class ConfigPersistence:
                             "java_runtime_combo",
                             current_config.get("languages", {}).get("java", {}).get("runtime", "java")
                         ),
+                        "cds": self._get_checkbox_checked(
+                            "java_cds_checkbox",
+                            current_config.get("languages", {}).get("java", {}).get("cds", True)
+                        ),
+                        "warm_jvm": self._get_checkbox_checked(
+                            "java_warm_jvm_checkbox",
+                            current_config.get("languages", {}).get("java", {}).get("warm_jvm", False)
+                        ),
                     },
                 },
                 "gemini": {  # New standardized format
@@ -586,6 +621,14 @@ class ConfigPersistence:
                     "wrap_lines": bool(self.parent.wrap_checkbox.isChecked()),
                 },
             }
+
+            # Keep settings that have no UI (e.g. per-tool sections) instead of dropping them
+            for lang, lang_config in current_config.get("languages", {}).items():
+                if isinstance(lang_config, dict) and lang in config["languages"]:
+                    config["languages"][lang] = {**lang_config, **config["languages"][lang]}
+            for key, value in current_config.items():
+                config.setdefault(key, value)
+
             self.config_manager.save_config(config)
             logger.info("Configuration saved successfully via UI")
 
@@ -3,12 +3,17 @@ Tools module for the Code Testing Suite.
 
 This module contains all the core tools for compiling, running, validating,
 and testing code.
+
+Note: Uses lazy imports; the runners are loaded when accessed.
 """
 
-from src.app.core.tools.benchmarker import BenchmarkCompilerRunner, Benchmarker
-from src.app.core.tools.comparator import Comparator
-from src.app.core.tools.compiler_runner import CompilerRunner
-from src.app.core.tools.validator import ValidatorRunner
+from typing import TYPE_CHECKING
+
+if TYPE_CHECKING:
+    from src.app.core.tools.benchmarker import BenchmarkCompilerRunner, Benchmarker
+    from src.app.core.tools.comparator import Comparator
+    from src.app.core.tools.compiler_runner import CompilerRunner
+    from src.app.core.tools.validator import ValidatorRunner
 
 __all__ = [
     "CompilerRunner",
@@ -19,3 +24,24 @@ __all__ = [
     "Comparator",
     "Benchmarker",
 ]
+
+
+def __getattr__(name: str):
+    """Lazy import tools on first access."""
+    if name in ("BenchmarkCompilerRunner", "Benchmarker"):
+        from src.app.core.tools.benchmarker import BenchmarkCompilerRunner, Benchmarker
+
+        return locals()[name]
+    elif name == "Comparator":
+        from src.app.core.tools.comparator import Comparator
+
+        return Comparator
+    elif name == "CompilerRunner":
+        from src.app.core.tools.compiler_runner import CompilerRunner
+
+        return CompilerRunner
+    elif name == "ValidatorRunner":
+        from src.app.core.tools.validator import ValidatorRunner
+
+        return ValidatorRunner
+    raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
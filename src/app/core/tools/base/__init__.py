@@ -12,20 +12,41 @@ Base Classes:
 - ProcessExecutor: Provides common subprocess execution utilities
 - LanguageDetector: Multi-language detection and compiler configuration
 - Language Compilers: Language-specific compilation implementations
+
+Note: Uses lazy imports, so importing one module of this package does not
+load all the others.
 """
 
-from src.app.core.tools.base.base_compiler import BaseCompiler
-from src.app.core.tools.base.base_runner import BaseRunner
-from src.app.core.tools.specialized.base_test_worker import BaseTestWorker
-from src.app.core.tools.base.language_compilers import (
-    BaseLanguageCompiler,
-    CppCompiler,
-    JavaCompiler,
-    LanguageCompilerFactory,
-    PythonCompiler,
-)
-from src.app.core.tools.base.language_detector import Language, LanguageDetector
-from src.app.core.tools.base.process_executor import ProcessExecutor
+from typing import TYPE_CHECKING
+
+if TYPE_CHECKING:
+    from src.app.core.tools.base.base_compiler import BaseCompiler
+    from src.app.core.tools.base.base_runner import BaseRunner
+    from src.app.core.tools.specialized.base_test_worker import BaseTestWorker
+    from src.app.core.tools.base.language_compilers import (
+        BaseLanguageCompiler,
+        CppCompiler,
+        JavaCompiler,
+        LanguageCompilerFactory,
+        PythonCompiler,
+    )
+    from src.app.core.tools.base.language_detector import Language, LanguageDetector
+    from src.app.core.tools.base.process_executor import ProcessExecutor
+
+# Exported name -> module it lives in
+_EXPORTS = {
+    "BaseCompiler": "src.app.core.tools.base.base_compiler",
+    "BaseRunner": "src.app.core.tools.base.base_runner",
+    "BaseTestWorker": "src.app.core.tools.specialized.base_test_worker",
+    "BaseLanguageCompiler": "src.app.core.tools.base.language_compilers",
+    "CppCompiler": "src.app.core.tools.base.language_compilers",
+    "JavaCompiler": "src.app.core.tools.base.language_compilers",
+    "LanguageCompilerFactory": "src.app.core.tools.base.language_compilers",
+    "PythonCompiler": "src.app.core.tools.base.language_compilers",
+    "Language": "src.app.core.tools.base.language_detector",
+    "LanguageDetector": "src.app.core.tools.base.language_detector",
+    "ProcessExecutor": "src.app.core.tools.base.process_executor",
+}
 
 __all__ = [
     "BaseCompiler",
@@ -40,3 +61,12 @@ __all__ = [
     "JavaCompiler",
     "LanguageCompilerFactory",
 ]
+
+
+def __getattr__(name: str):
+    """Lazy import exports on first access."""
+    if name in _EXPORTS:
+        import importlib
+
+        return getattr(importlib.import_module(_EXPORTS[name]), name)
+    raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
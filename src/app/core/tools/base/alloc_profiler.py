@@ -0,0 +1,438 @@
+"""
+Allocation profiling of native solutions via an LD_PRELOAD interposer.
+
+The interposer (resources/native/alloc_profiler.cpp) is compiled once into
+the user cache and preloaded into the test process. It counts allocations,
+bytes, peak live bytes and request size classes, collects the top call
+sites with a frame-pointer walk and writes a JSON report on exit.
+
+read_report() turns that report into a compact per-test summary: call sites
+are symbolized with addr2line (when available), merged by their resolved
+frames, and the allocation pattern is checked for the two most common
+problems in contest solutions: vectors grown without reserve() and
+node-based containers (map/set/list) churning allocations.
+
+Linux/glibc only; elsewhere profiling is reported as unsupported.
+"""
+
+import json
+import logging
+import os
+import shutil
+import subprocess
+import sys
+import threading
+from typing import Any, Dict, List, Optional, Tuple
+
+from src.app.shared.constants.paths import USER_DATA_DIR
+
+logger = logging.getLogger(__name__)
+
+PROFILER_SOURCE = os.path.normpath(
+    os.path.join(
+        os.path.dirname(os.path.abspath(__file__)),
+        "..", "..", "..", "resources", "native", "alloc_profiler.cpp",
+    )
+)
+PROFILER_CACHE_DIR = os.path.join(USER_DATA_DIR, "cache", "native")
+PROFILER_LIBRARY = "libcts_alloc.so"
+
+# Environment variables read by the interposer
+REPORT_ENV = "CTS_ALLOC_REPORT"
+DEPTH_ENV = "CTS_ALLOC_DEPTH"
+
+# Call sites kept per test after merging
+TOP_SITES = 10
+
+# A call site requesting this many distinct power-of-two sizes grows a buffer
+GROWTH_SIZE_CLASSES = 8
+
+# Bytes a growing site must allocate before it is worth a hint
+GROWTH_HINT_BYTES = 1 << 20
+
+# Node-based containers allocate each element as a small block of one size
+# and free it on its own. Matched on the size class counters rather than on
+# call site symbols: at -O2 without frame pointers the container's allocate()
+# is inlined into its caller and the site often resolves to main().
+NODE_SIZE_LIMIT = 256  # Bytes; largest block counted as a node
+NODE_HINT_ALLOCATIONS = 1000
+
+# Symbolized (module, module mtime, offset), shared by all tests of a session
+_symbol_cache: Dict[Tuple[str, int, int], Dict[str, str]] = {}
+_symbol_lock = threading.Lock()
+
+
+def alloc_profiler_supported() -> bool:
+    """Check whether the platform supports the LD_PRELOAD interposer."""
+    return sys.platform.startswith("linux")
+
+
+def build_native(
+    source: str,
+    output_name: str,
+    flags: List[str],
+    libraries: Tuple[str, ...] = (),
+    compiler: str = "g++",
+    timeout: int = 60,
+) -> Optional[str]:
+    """
+    Compile a native helper from resources/native into the user cache if needed.
+
+    The output is rebuilt when its source is newer.
+
+    Args:
+        source: C++ source file
+        output_name: File name of the library or executable in the cache
+        flags: Compiler flags besides the output and the source
+        libraries: Linker arguments placed after the source (e.g. '-ldl')
+        compiler: C++ compiler executable
+        timeout: Compilation timeout in seconds
+
+    Returns:
+        Optional[str]: Path of the built file, or None on failure
+    """
+    output = os.path.join(PROFILER_CACHE_DIR, output_name)
+    try:
+        if os.path.getmtime(output) >= os.path.getmtime(source):
+            return output
+    except OSError:
+        pass
+
+    os.makedirs(PROFILER_CACHE_DIR, exist_ok=True)
+    try:
+        result = subprocess.run(
+            [compiler, *flags, "-o", output, source, *libraries],
+            stdout=subprocess.PIPE,
+            stderr=subprocess.PIPE,
+            text=True,
+            timeout=timeout,
+        )
+    except (OSError, subprocess.TimeoutExpired) as e:
+        logger.warning(f"Could not build {output_name}: {e}")
+        return None
+
+    if result.returncode != 0:
+        logger.warning(f"Build of {output_name} failed: {result.stderr.strip()}")
+        return None
+    return output
+
+
+def build_preload_library(
+    source: str, library_name: str, compiler: str = "g++", timeout: int = 60
+) -> Optional[str]:
+    """
+    Compile a native LD_PRELOAD library into the user cache if needed.
+
+    Shared by the profilers in resources/native.
+
+    Args:
+        source: C++ source file
+        library_name: File name of the shared library in the cache
+        compiler: C++ compiler executable
+        timeout: Compilation timeout in seconds
+
+    Returns:
+        Optional[str]: Path of the shared library, or None on failure
+    """
+    return build_native(
+        source,
+        library_name,
+        ["-O2", "-std=c++17", "-shared", "-fPIC", "-fno-omit-frame-pointer"],
+        ("-ldl",),
+        compiler,
+        timeout,
+    )
+
+
+def ensure_profiler_built(compiler: str = "g++", timeout: int = 60) -> Optional[str]:
+    """
+    Compile the interposer into the user cache if needed.
+
+    Args:
+        compiler: C++ compiler executable
+        timeout: Compilation timeout in seconds
+
+    Returns:
+        Optional[str]: Path of the shared library, or None on failure
+    """
+    if not alloc_profiler_supported():
+        return None
+    return build_preload_library(PROFILER_SOURCE, PROFILER_LIBRARY, compiler, timeout)
+
+
+def profiler_environment(
+    library: str, report_path: str, depth: Optional[int] = None, base_env: Optional[Dict[str, str]] = None
+) -> Dict[str, str]:
+    """
+    Get the environment that preloads the interposer.
+
+    Args:
+        library: Path returned by ensure_profiler_built()
+        report_path: File the report is written to on exit
+        depth: Frames kept per call site (1-4, None = library default)
+        base_env: Environment to extend (default: os.environ)
+
+    Returns:
+        Dict[str, str]: Environment for the profiled process
+    """
+    env = dict(os.environ if base_env is None else base_env)
+    preload = env.get("LD_PRELOAD")
+    env["LD_PRELOAD"] = f"{library}:{preload}" if preload else library
+    env[REPORT_ENV] = report_path
+    if depth is not None:
+        env[DEPTH_ENV] = str(depth)
+    return env
+
+
+def _is_position_independent(module: str) -> bool:
+    """ELF e_type ET_DYN: addr2line expects offsets instead of addresses."""
+    try:
+        with open(module, "rb") as f:
+            header = f.read(18)
+    except OSError:
+        return True
+    if len(header) < 18 or header[:4] != b"\x7fELF":
+        return True
+    byteorder = "little" if header[5] == 1 else "big"
+    return int.from_bytes(header[16:18], byteorder) == 3
+
+
+def _module_stamp(module: str) -> int:
+    try:
+        return os.stat(module).st_mtime_ns
+    except OSError:
+        return 0
+
+
+def _run_addr2line(addr2line: str, module: str, lookups: List[int]) -> List[List[Tuple[str, str]]]:
+    """
+    Resolve addresses of one module, including inlined frames.
+
+    Returns:
+        One (function, location) chain per address, innermost frame first
+    """
+    try:
+        result = subprocess.run(
+            [addr2line, "-a", "-i", "-f", "-C", "-e", module] + [hex(lookup) for lookup in lookups],
+            stdout=subprocess.PIPE,
+            stderr=subprocess.DEVNULL,
+            text=True,
+            timeout=10,
+        )
+        lines = result.stdout.splitlines()
+    except (OSError, subprocess.TimeoutExpired):
+        lines = []
+
+    # -a prints the address before the function/location pairs of each lookup
+    chains: List[List[Tuple[str, str]]] = []
+    i = 0
+    while i < len(lines):
+        if lines[i].startswith("0x"):
+            chains.append([])
+            i += 1
+            continue
+        if chains and i + 1 < len(lines):
+            chains[-1].append((lines[i], lines[i + 1]))
+        i += 2
+    return chains + [[] for _ in range(len(lookups) - len(chains))]
+
+
+def _describe_chain(chain: List[Tuple[str, str]], symbol: str) -> Dict[str, Any]:
+    """
+    Summarize an inline chain: the innermost function names the allocation
+    (e.g. an allocator of map nodes), the outermost location is the line in
+    the solution it was inlined into.
+    """
+    known = [(f, loc) for f, loc in chain if f != "??"]
+    function = known[0][0] if known else symbol
+    locations = [loc for _, loc in chain if not loc.startswith("??")]
+    info = {
+        "function": function,
+        "location": locations[-1] if locations else "",
+        "inlined": [f for f, _ in known],
+    }
+    if len(known) > 1 and known[-1][0] != function:
+        info["caller"] = known[-1][0]
+    return info
+
+
+def symbolize_frames(frames: List[Dict[str, Any]]) -> None:
+    """
+    Fill 'function' and 'location' of frames using addr2line (in place).
+
+    Frames need 'module', 'offset' and 'address' (and optionally the dladdr
+    'symbol' as fallback). Resolved frames also get 'inlined': the functions
+    of the inline chain, innermost first.
+    """
+    addr2line = shutil.which("addr2line")
+    stamps = {module: _module_stamp(module) for module in {f["module"] for f in frames}}
+    pending: Dict[str, List[Tuple[int, Dict[str, Any]]]] = {}
+
+    with _symbol_lock:
+        for frame in frames:
+            key = (frame["module"], stamps[frame["module"]], frame["offset"])
+            if key in _symbol_cache:
+                frame.update(_symbol_cache[key])
+            elif addr2line and stamps[frame["module"]]:
+                lookup = frame["offset"] if _is_position_independent(frame["module"]) else frame["address"]
+                pending.setdefault(frame["module"], []).append((lookup, frame))
+
+    for module, entries in pending.items():
+        chains = _run_addr2line(addr2line, module, [lookup for lookup, _ in entries])
+        with _symbol_lock:
+            for (_, frame), chain in zip(entries, chains):
+                info = _describe_chain(chain, frame.get("symbol", ""))
+                _symbol_cache[(module, stamps[module], frame["offset"])] = info
+                frame.update(info)
+
+    for frame in frames:
+        frame.setdefault("function", frame.get("symbol", ""))
+        frame.setdefault("location", "")
+        frame.setdefault("inlined", [])
+
+
+def _merge_sites(sites: List[Dict[str, Any]], symbolize: bool) -> List[Dict[str, Any]]:
+    """
+    Drop unresolvable frames and merge sites with the same remaining frames.
+
+    Frames after the first one that does not belong to a loaded module are
+    garbage read from binaries built without frame pointers.
+    """
+    merged: Dict[Tuple, Dict[str, Any]] = {}
+    for site in sites:
+        frames = []
+        for frame in site.get("frames", []):
+            if not frame.get("module"):
+                break
+            frames.append(frame)
+        key = tuple((f["module"], f["offset"]) for f in frames)
+        entry = merged.setdefault(key, {"count": 0, "bytes": 0, "size_classes": 0, "frames": frames})
+        entry["count"] += site.get("count", 0)
+        entry["bytes"] += site.get("bytes", 0)
+        entry["size_classes"] |= site.get("size_classes", 0)
+
+    for entry in merged.values():
+        classes = entry.pop("size_classes")
+        entry["growth"] = bin(classes).count("1") >= GROWTH_SIZE_CLASSES
+        if classes and not classes & (classes - 1):
+            entry["size_class"] = classes.bit_length() - 1
+
+    # Most frequent sites plus growing buffers, which allocate rarely but copy a lot
+    by_count = sorted(merged.values(), key=lambda s: s["count"], reverse=True)
+    top = by_count[:TOP_SITES] + [
+        site for site in by_count[TOP_SITES:] if site["growth"] and site["bytes"] >= GROWTH_HINT_BYTES
+    ][:TOP_SITES // 2]
+    if symbolize:
+        symbolize_frames([frame for site in top for frame in site["frames"]])
+    for site in top:
+        site["frames"] = [
+            {
+                "module": os.path.basename(f["module"]),
+                "function": f.get("function", f.get("symbol", "")),
+                "location": f.get("location", ""),
+                **({"caller": f["caller"]} if f.get("caller") else {}),
+            }
+            for f in site["frames"]
+        ]
+    return top
+
+
+def _site_name(site: Dict[str, Any]) -> str:
+    frame = site["frames"][0] if site["frames"] else {}
+    return frame.get("function") or frame.get("location") or "unknown site"
+
+
+def _find_hints(summary: Dict[str, Any], size_classes: List[int], frees: int) -> List[str]:
+    """
+    Flag vector growth among the top sites and container node churn.
+
+    Args:
+        summary: Report summary with its top sites
+        size_classes: Allocations per request size class (bucket i: [2^(i-1), 2^i))
+        frees: Frees of the process
+    """
+    hints = []
+    for site in summary["top_sites"]:
+        if site["growth"] and site["bytes"] >= GROWTH_HINT_BYTES:
+            hints.append(
+                f"Buffer grown by reallocation ({site['count']} allocations, "
+                f"{site['bytes'] / (1 << 20):.1f} MB) at {_site_name(site)}; reserve() the final size"
+            )
+
+    # Most allocations in one small size class, and (about) as many frees
+    allocations = summary["allocations"]
+    small = [(size_classes[i], i) for i in range(1, len(size_classes)) if 1 << i <= NODE_SIZE_LIMIT]
+    if small:
+        count, bucket = max(small)
+        if count >= NODE_HINT_ALLOCATIONS and count * 2 > allocations and frees * 10 >= count * 9:
+            sites = [site for site in summary["top_sites"] if site.get("size_class") == bucket]
+            where = f" at {_site_name(sites[0])}" if sites else ""
+            hints.append(
+                f"{count} of {allocations} allocations are {1 << (bucket - 1)}-{(1 << bucket) - 1} byte "
+                f"blocks freed one by one, typical of container nodes (map/set/list/unordered_map){where}"
+            )
+    return hints
+
+
+def read_report(path: str, symbolize: bool = True) -> Optional[Dict[str, Any]]:
+    """
+    Read and summarize a report written by the interposer.
+
+    Args:
+        path: Report path passed via CTS_ALLOC_REPORT
+        symbolize: Resolve call sites with addr2line
+
+    Returns:
+        Optional[Dict[str, Any]]: Per-test allocation summary, or None if the
+        process wrote no report (killed, or not a dynamically linked binary)
+    """
+    try:
+        with open(path, encoding="utf-8") as f:
+            report = json.load(f)
+    except (OSError, ValueError):
+        return None
+
+    size_classes = report.get("size_classes", [])
+    summary = {
+        "allocations": sum(report.get(key, 0) for key in ("allocations", "new_calls", "reallocations")),
+        "new_calls": report.get("new_calls", 0),
+        "reallocations": report.get("reallocations", 0),
+        "frees": report.get("frees", 0),
+        "bytes_allocated": report.get("bytes_requested", 0),
+        "peak_live_bytes": report.get("peak_live_bytes", 0),
+        "leaked_bytes": max(0, report.get("live_bytes", 0)),
+        # Bucket i counts requests of [2^(i-1), 2^i) bytes; bucket 0 is size 0
+        "size_classes": {
+            (f"<{1 << i}" if i else "0"): count for i, count in enumerate(size_classes) if count
+        },
+        "top_sites": _merge_sites(report.get("sites", []), symbolize),
+    }
+    summary["hints"] = _find_hints(summary, size_classes, report.get("frees", 0))
+    return summary
+
+
+def summarize_allocations(results: List[Dict[str, Any]]) -> Optional[Dict[str, Any]]:
+    """
+    Aggregate the per-test allocation summaries of a run.
+
+    Returns:
+        Optional[Dict[str, Any]]: Totals, maxima and the most frequent hints,
+        or None when no test was profiled
+    """
+    profiled = [r["allocations"] for r in results if isinstance(r.get("allocations"), dict)]
+    if not profiled:
+        return None
+
+    hints: Dict[str, int] = {}
+    for summary in profiled:
+        for hint in summary.get("hints", []):
+            hints[hint] = hints.get(hint, 0) + 1
+
+    return {
+        "profiled_tests": len(profiled),
+        "total_allocations": sum(s["allocations"] for s in profiled),
+        "max_allocations": max(s["allocations"] for s in profiled),
+        "max_peak_live_bytes": max(s["peak_live_bytes"] for s in profiled),
+        "max_leaked_bytes": max(s["leaked_bytes"] for s in profiled),
+        "hints": hints,
+    }
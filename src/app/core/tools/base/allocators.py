@@ -0,0 +1,265 @@
+"""
+Allocator and transparent huge page experiments for benchmarked solutions.
+
+Solutions built on map/set, vector<vector<>> and other allocation-heavy
+structures can run at very different speeds under different allocators,
+while judges run them with glibc malloc. Running every input under the
+allocators installed locally (preloaded with LD_PRELOAD) and with
+transparent huge pages (THP) toggled shows how much of the time is spent
+in the allocator before anyone rewrites the solution around arenas.
+
+Variants are environments of the same test executable:
+
+- "jemalloc", "mimalloc", "tcmalloc": the library found via ldconfig or in
+  the usual library directories (or configured paths) is preloaded
+- "thp": glibc malloc asks for huge pages (glibc.malloc.hugetlb=1, glibc
+  2.35+), when THP is not disabled system-wide
+- "no-thp": THP disabled for the process (PR_SET_THP_DISABLE, set by the
+  launch trampoline of process_limits), when the system default is
+  "always" -- otherwise the regular run already has no huge pages
+
+All variants run on the same inputs through the tournament worker;
+summarize_allocators() compares each with the regular run (glibc malloc,
+system THP default) and reports the spread of median times.
+
+Linux only; elsewhere no variants are available.
+"""
+
+import os
+import re
+import statistics
+import subprocess
+import sys
+from typing import Any, Dict, List, Optional
+
+from src.app.core.tools.base.tournament import (
+    SIGNIFICANCE_LEVEL,
+    is_timed,
+    wilcoxon_signed_rank,
+)
+
+# Allocator name -> shared library names, preferred first
+KNOWN_ALLOCATORS: Dict[str, List[str]] = {
+    "jemalloc": ["libjemalloc.so.2", "libjemalloc.so"],
+    "mimalloc": ["libmimalloc.so.2", "libmimalloc.so"],
+    "tcmalloc": [
+        "libtcmalloc_minimal.so.4",
+        "libtcmalloc.so.4",
+        "libtcmalloc_minimal.so",
+        "libtcmalloc.so",
+    ],
+}
+
+LIBRARY_DIRS = [
+    "/usr/lib/x86_64-linux-gnu",
+    "/usr/lib/aarch64-linux-gnu",
+    "/usr/lib64",
+    "/usr/lib",
+    "/usr/local/lib",
+]
+
+THP_SETTING = "/sys/kernel/mm/transparent_hugepage/enabled"
+
+# Read (and removed) by resources/native/rlimit_exec.cpp
+THP_DISABLE_ENV = "CTS_THP_DISABLE"
+
+# Key suffix separator of variant runs ('test@jemalloc')
+VARIANT_SEPARATOR = "@"
+
+# Spread of median times (slowest / fastest variant) that marks a solution
+# as allocator-bound
+ALLOCATOR_BOUND_SPREAD = 1.15
+
+
+def allocator_experiments_supported() -> bool:
+    """Check whether the platform supports preloaded allocators."""
+    return sys.platform.startswith("linux")
+
+
+def _ldconfig_libraries() -> Dict[str, str]:
+    """Library name -> path from the dynamic linker cache."""
+    try:
+        result = subprocess.run(
+            ["ldconfig", "-p"], stdout=subprocess.PIPE, stderr=subprocess.DEVNULL, text=True, timeout=5
+        )
+    except (OSError, subprocess.TimeoutExpired):
+        return {}
+    libraries = {}
+    for line in result.stdout.splitlines():
+        match = re.match(r"\s*(\S+) \(([^)]*)\) => (\S+)", line)
+        if match and "x86-32" not in match.group(2):
+            libraries.setdefault(match.group(1), match.group(3))
+    return libraries
+
+
+def find_allocators(configured: Optional[Dict[str, str]] = None) -> Dict[str, str]:
+    """
+    Find the alternative allocators installed locally.
+
+    Args:
+        configured: Allocator name -> library path, taking precedence over
+                    discovery (config["benchmarker"]["allocators"])
+
+    Returns:
+        Dict[str, str]: Allocator name -> library path of those that exist
+    """
+    if not allocator_experiments_supported():
+        return {}
+    found = {
+        name: path for name, path in (configured or {}).items() if os.path.isfile(path)
+    }
+    cache = None
+    for name, library_names in KNOWN_ALLOCATORS.items():
+        if name in found:
+            continue
+        if cache is None:
+            cache = _ldconfig_libraries()
+        for library in library_names:
+            candidates = [cache[library]] if library in cache else []
+            candidates += [os.path.join(directory, library) for directory in LIBRARY_DIRS]
+            path = next((c for c in candidates if os.path.isfile(c)), None)
+            if path:
+                found[name] = path
+                break
+    return found
+
+
+def thp_mode() -> Optional[str]:
+    """
+    Get the system-wide THP setting.
+
+    Returns:
+        Optional[str]: 'always', 'madvise' or 'never'; None if unavailable
+    """
+    try:
+        with open(THP_SETTING, encoding="ascii") as f:
+            match = re.search(r"\[(\w+)\]", f.read())
+    except OSError:
+        return None
+    return match.group(1) if match else None
+
+
+def glibc_hugetlb_supported() -> bool:
+    """Check whether glibc malloc has the hugetlb tunable (glibc 2.35+)."""
+    try:
+        version = os.confstr("CS_GNU_LIBC_VERSION") or ""
+    except (AttributeError, ValueError, OSError):
+        return False
+    match = re.match(r"glibc (\d+)\.(\d+)", version)
+    return bool(match) and (int(match.group(1)), int(match.group(2))) >= (2, 35)
+
+
+def allocator_variants(
+    configured: Optional[Dict[str, str]] = None, thp_disable: bool = True
+) -> Dict[str, Dict[str, str]]:
+    """
+    Get the variants available on this machine.
+
+    Args:
+        configured: Allocator name -> library path (see find_allocators())
+        thp_disable: Whether launched processes honour THP_DISABLE_ENV (the
+                     launch trampoline is available)
+
+    Returns:
+        Dict[str, Dict[str, str]]: Variant name -> environment overrides
+    """
+    variants = {
+        name: {"LD_PRELOAD": path} for name, path in find_allocators(configured).items()
+    }
+    if not allocator_experiments_supported():
+        return variants
+
+    mode = thp_mode()
+    if mode in ("always", "madvise") and glibc_hugetlb_supported():
+        variants["thp"] = {"GLIBC_TUNABLES": "glibc.malloc.hugetlb=1"}
+    if mode == "always" and thp_disable:
+        variants["no-thp"] = {THP_DISABLE_ENV: "1"}
+    return variants
+
+
+def variant_environment(
+    overrides: Dict[str, str], base_env: Optional[Dict[str, str]] = None
+) -> Dict[str, str]:
+    """
+    Apply a variant's overrides to an environment.
+
+    LD_PRELOAD and GLIBC_TUNABLES are extended rather than replaced.
+
+    Args:
+        overrides: Environment overrides of the variant
+        base_env: Environment to extend (default: os.environ)
+
+    Returns:
+        Dict[str, str]: Environment of the variant run
+    """
+    env = dict(os.environ if base_env is None else base_env)
+    for name, value in overrides.items():
+        current = env.get(name)
+        if name == "LD_PRELOAD" and current:
+            env[name] = f"{value}:{current}"
+        elif name == "GLIBC_TUNABLES" and current:
+            env[name] = f"{current}:{value}"
+        else:
+            env[name] = value
+    return env
+
+
+def summarize_allocators(
+    results: List[Dict[str, Any]], variants: Dict[str, str], baseline_key: str = "test"
+) -> Optional[Dict[str, Any]]:
+    """
+    Compare the variant runs with the regular run.
+
+    Args:
+        results: Test results carrying 'tournament' entries
+        variants: Variant key -> variant name
+        baseline_key: Key of the regular run
+
+    Returns:
+        Optional[Dict[str, Any]]: Per variant: compared tests, median time
+        and ratio to the regular run, its significance, output mismatches
+        and one-sided crashes (either hints at undefined behaviour); the
+        spread of median times over all runs and whether it marks the
+        solution as allocator-bound; None without variant results
+    """
+    runs = [
+        r["tournament"] for r in results
+        if isinstance(r.get("tournament"), dict) and baseline_key in r["tournament"]
+    ]
+    if not runs or not variants:
+        return None
+
+    baseline_times = [run[baseline_key]["execution_time"] for run in runs if is_timed(run[baseline_key])]
+    medians = {"regular": statistics.median(baseline_times) if baseline_times else None}
+    summary: Dict[str, Any] = {"significance_level": SIGNIFICANCE_LEVEL, "variants": {}}
+    for key, name in variants.items():
+        pairs = [(run[baseline_key], run[key], index) for index, run in enumerate(runs) if key in run]
+        timed = [(b["execution_time"], v["execution_time"]) for b, v, _ in pairs if is_timed(b) and is_timed(v)]
+        variant_times = [v for _, v in timed]
+        ratios = [v / b for b, v in timed if b > 0]
+        test = wilcoxon_signed_rank(variant_times, [b for b, _ in timed])
+        medians[name] = statistics.median(variant_times) if variant_times else None
+        summary["variants"][name] = {
+            "key": key,
+            "compared_tests": len(timed),
+            "median_time": medians[name],
+            "median_ratio": statistics.median(ratios) if ratios else None,
+            "p_value": test["p_value"],
+            "significant": test["p_value"] < SIGNIFICANCE_LEVEL,
+            "output_mismatches": sum(
+                1 for b, v, _ in pairs
+                if b.get("passed") and v.get("passed") and b.get("output_hash") != v.get("output_hash")
+            ),
+            "crashes": sum(1 for b, v, _ in pairs if is_timed(b) != is_timed(v)),
+        }
+
+    summary["median_times"] = medians
+    timed_medians = [m for m in medians.values() if m]
+    spread = max(timed_medians) / min(timed_medians) if len(timed_medians) > 1 else None
+    summary["spread"] = spread
+    summary["allocator_bound"] = bool(
+        spread is not None
+        and spread >= ALLOCATOR_BOUND_SPREAD
+        and any(v["significant"] for v in summary["variants"].values())
+    )
+    return summary
@@ -0,0 +1,226 @@
+"""
+Compiler flag autotuning of a benchmarked C++ solution.
+
+The default flags (-O2 -march=native -mtune=native -pipe -Wall) are a
+guess; whether -O3, -funroll-loops, -fno-plt or another standard makes a
+given solution faster depends on the solution. Autotuning searches a
+curated flag space with successive halving:
+
+1. Every candidate flag set is built as a variant of the test solution
+   (compiled in the regular parallel pass, cached by timestamp).
+2. Round 1 runs all candidates and the regular build on a few generated
+   inputs; each later round keeps the faster half and doubles the inputs,
+   until the last round measures the survivors on all of them. Earlier
+   measurements are kept, so every round only runs new inputs.
+3. Candidates are judged by the median per-test time ratio to the regular
+   build, which runs on every input as the reference. A candidate that
+   prints a different output or crashes where the regular build does not
+   is disqualified: flags must not change what the solution computes.
+
+The winner is reported with a bootstrap confidence interval of its median
+ratio; it is recommended only if the whole interval lies below 1. The
+recommended overrides can be saved per source file in
+config["languages"]["cpp"]["file_overrides"], which BaseCompiler applies
+when building that file.
+"""
+
+import math
+import random
+import statistics
+from typing import Any, Dict, List, Optional, Sequence, Tuple
+
+from src.app.core.tools.base.differential import BASELINE_KEY
+from src.app.core.tools.base.tournament import is_timed
+
+# Candidate flag sets (language config overrides) searched by default
+FLAG_SPACE: Dict[str, Dict[str, Any]] = {
+    "O3": {"optimization": "O3"},
+    "unroll": {"extra_flags": ["-funroll-loops"]},
+    "O3-unroll": {"optimization": "O3", "extra_flags": ["-funroll-loops"]},
+    "no-plt": {"extra_flags": ["-fno-plt"]},
+    "O3-unroll-no-plt": {"optimization": "O3", "extra_flags": ["-funroll-loops", "-fno-plt"]},
+    "c++20": {"std_version": "c++20"},
+    "no-march": {"flags": ["-pipe", "-Wall"]},
+}
+
+# Inputs of the first round (fewer tests are too noisy to eliminate anything)
+MIN_ROUND_TESTS = 3
+
+# Bootstrap resamples and coverage of the confidence interval
+BOOTSTRAP_SAMPLES = 1000
+CONFIDENCE = 0.95
+
+
+def halving_schedule(candidates: int, test_count: int) -> List[int]:
+    """
+    Cumulative inputs measured after each round of successive halving.
+
+    Args:
+        candidates: Number of candidate flag sets
+        test_count: Inputs of the last round (the test budget)
+
+    Returns:
+        List[int]: Non-decreasing test counts, ending with test_count
+    """
+    rounds = max(1, math.ceil(math.log2(candidates)) + 1) if candidates > 1 else 1
+    schedule = []
+    for r in range(rounds):
+        tests = math.ceil(test_count / 2 ** (rounds - 1 - r))
+        tests = min(test_count, max(MIN_ROUND_TESTS, tests))
+        if not schedule or tests > schedule[-1]:
+            schedule.append(tests)
+    return schedule
+
+
+def bootstrap_median_ci(
+    values: Sequence[float], samples: int = BOOTSTRAP_SAMPLES, confidence: float = CONFIDENCE, seed: int = 0
+) -> Tuple[float, float]:
+    """
+    Percentile bootstrap confidence interval of a median.
+
+    Returns:
+        Tuple[float, float]: Lower and upper bound (the median twice for a
+        single value)
+    """
+    if len(values) < 2:
+        return (values[0], values[0]) if values else (math.nan, math.nan)
+    rng = random.Random(seed)
+    medians = sorted(
+        statistics.median(rng.choices(values, k=len(values))) for _ in range(samples)
+    )
+    tail = (1 - confidence) / 2
+    low = medians[int(tail * (samples - 1))]
+    high = medians[int(math.ceil((1 - tail) * (samples - 1)))]
+    return low, high
+
+
+def candidate_stats(results: List[Dict[str, Any]], key: str) -> Dict[str, Any]:
+    """
+    Compare one candidate with the regular build over the results so far.
+
+    Returns:
+        Dict[str, Any]: tests, ratios (candidate / regular time per test),
+        median_ratio, and the test numbers with output mismatches and
+        one-sided crashes
+    """
+    ratios: List[float] = []
+    mismatches: List[int] = []
+    crashes: List[int] = []
+    tests = 0
+    for result in results:
+        runs = result.get("tournament")
+        if not isinstance(runs, dict) or key not in runs or BASELINE_KEY not in runs:
+            continue
+        tests += 1
+        baseline, entry = runs[BASELINE_KEY], runs[key]
+        if is_timed(baseline) != is_timed(entry):
+            crashes.append(result.get("test_number"))
+        elif (
+            baseline.get("passed") and entry.get("passed")
+            and baseline.get("output_hash") != entry.get("output_hash")
+        ):
+            mismatches.append(result.get("test_number"))
+        elif is_timed(baseline) and baseline["execution_time"] > 0:
+            ratios.append(entry["execution_time"] / baseline["execution_time"])
+    return {
+        "tests": tests,
+        "ratios": ratios,
+        "median_ratio": statistics.median(ratios) if ratios else None,
+        "output_mismatches": sorted(mismatches),
+        "crashes": sorted(crashes),
+    }
+
+
+def select_survivors(
+    results: List[Dict[str, Any]], candidates: List[str], keep_all: bool = False
+) -> Tuple[List[str], List[str]]:
+    """
+    Keep the faster half of the candidates.
+
+    Args:
+        results: Test results so far
+        candidates: Candidate keys still in the race
+        keep_all: Keep every valid candidate (last round)
+
+    Returns:
+        Tuple[List[str], List[str]]: Survivors (fastest first) and
+        eliminated keys (disqualified ones included)
+    """
+    valid = []
+    for key in candidates:
+        stats = candidate_stats(results, key)
+        if stats["median_ratio"] is not None and not stats["output_mismatches"] and not stats["crashes"]:
+            valid.append((stats["median_ratio"], key))
+    valid.sort()
+    keep = len(valid) if keep_all else math.ceil(len(valid) / 2)
+    survivors = [key for _, key in valid[:keep]]
+    return survivors, [key for key in candidates if key not in survivors]
+
+
+def summarize_autotune(
+    results: List[Dict[str, Any]],
+    labels: Dict[str, str],
+    overrides: Dict[str, Dict[str, Any]],
+    rounds: Optional[List[Dict[str, Any]]] = None,
+) -> Optional[Dict[str, Any]]:
+    """
+    Report the autotuning run.
+
+    Args:
+        results: Test results carrying 'tournament' entries
+        labels: Candidate key -> flag set name
+        overrides: Candidate key -> language config overrides
+        rounds: Rounds recorded by the worker (tests, candidates, eliminated)
+
+    Returns:
+        Optional[Dict[str, Any]]: Candidates (ratio to the regular build,
+        disqualifications), the rounds, the best candidate with the
+        confidence interval of its median ratio, and recommended_overrides
+        (empty if no flag set is reliably faster); None without results
+    """
+    if not any(isinstance(r.get("tournament"), dict) for r in results):
+        return None
+
+    candidates = []
+    for key, label in labels.items():
+        stats = candidate_stats(results, key)
+        entry = {
+            "key": key,
+            "label": label,
+            "overrides": overrides.get(key, {}),
+            "tests": stats["tests"],
+            "median_ratio": stats["median_ratio"],
+        }
+        if stats["output_mismatches"] or stats["crashes"]:
+            entry["disqualified"] = {
+                "output_mismatches": stats["output_mismatches"],
+                "crashes": stats["crashes"],
+            }
+        candidates.append(entry)
+    candidates.sort(key=lambda c: (-c["tests"], c["median_ratio"] if c["median_ratio"] is not None else math.inf))
+
+    summary: Dict[str, Any] = {
+        "candidates": candidates,
+        "rounds": rounds or [],
+        "confidence": CONFIDENCE,
+        "best": None,
+        "recommended_overrides": {},
+    }
+
+    # The best candidate measured on the most inputs
+    contenders = [c for c in candidates if "disqualified" not in c and c["median_ratio"] is not None]
+    if contenders:
+        best = contenders[0]
+        low, high = bootstrap_median_ci(candidate_stats(results, best["key"])["ratios"])
+        summary["best"] = {
+            "label": best["label"],
+            "overrides": best["overrides"],
+            "tests": best["tests"],
+            "median_ratio": best["median_ratio"],
+            "speedup": 1 / best["median_ratio"] if best["median_ratio"] > 0 else None,
+            "ratio_ci": [low, high],
+            "significant": high < 1.0,
+        }
+        if high < 1.0:
+            summary["recommended_overrides"] = best["overrides"]
+    return summary
@@ -12,14 +12,15 @@ language detection and routing to appropriate compilers.
 import logging
 import multiprocessing
 import os
+import sys
 import threading
 from concurrent.futures import ThreadPoolExecutor, as_completed
 from typing import Any, Dict, List, Optional, Tuple
 
-from PySide6.QtCore import QObject, Signal
-
 from src.app.core.tools.base.language_compilers import LanguageCompilerFactory
 from src.app.core.tools.base.language_detector import Language, LanguageDetector
+from src.app.core.tools.base.qt_compat import QObject, Signal
+from src.app.core.tools.base.startup_probe import is_dynamic_executable
 
 logger = logging.getLogger(__name__)
 
@@ -89,6 +90,10 @@ class BaseCompiler(QObject):
             )
             self.executables[key] = executable_path
 
+        # Additional builds of existing sources (variant_key -> variant info),
+        # compiled in the same parallel pass as the regular files
+        self.build_variants: Dict[str, Dict[str, Any]] = {}
+
         # P2 Issue #13 FIX: Add per-file locks to prevent TOCTOU race condition
         # Prevents multiple threads from simultaneously checking/compiling the same file
         self._compilation_locks: Dict[str, threading.Lock] = {}
@@ -119,15 +124,104 @@ class BaseCompiler(QObject):
 
         return resolved
 
-    def compile_all(self) -> bool:
+    def add_source(self, file_key: str, file_path: str) -> str:
+        """
+        Register an additional source file to compile with the regular files.
+
+        Args:
+            file_key: Key of the new file (e.g. 'solution_1')
+            file_path: Source path (relative paths resolve like the regular files)
+
+        Returns:
+            str: Resolved source path
+        """
+        path = self._resolve_file_paths({file_key: file_path})[file_key]
+        language = self.language_detector.detect_from_extension(path)
+
+        self.files[file_key] = path
+        self.file_languages[file_key] = language
+        self.executables[file_key] = self.language_detector.get_executable_path(path, language)
+
+        logger.debug(f"Registered {language.value} source for {file_key}: {path}")
+        return path
+
+    def add_build_variant(
+        self, file_key: str, variant: str, overrides: Dict[str, Any]
+    ) -> Optional[str]:
+        """
+        Register an additional build of an existing C++ source.
+
+        The variant is compiled together with the regular files in
+        _parallel_compile_all() and gets its own executable next to the
+        regular one (e.g. test -> test_sanitized), so timestamp caching
+        works independently for every variant.
+
+        Args:
+            file_key: Key of the source file to build again
+            variant: Variant name, used as executable suffix
+            overrides: Language config entries overriding the regular build
+                       (e.g. {'extra_flags': [...]} or {'optimization': 'O0'})
+
+        Returns:
+            Optional[str]: Key of the variant (usable with get_execution_command),
+                           or None if the file is not compiled to native code
+        """
+        if file_key not in self.files:
+            raise KeyError(f"Unknown file key: {file_key}")
+
+        language = self.file_languages.get(file_key, Language.UNKNOWN)
+        if language != Language.CPP:
+            return None
+
+        variant_key = f"{file_key}:{variant}"
+        root, extension = os.path.splitext(self.executables[file_key])
+
+        self.files[variant_key] = self.files[file_key]
+        self.file_languages[variant_key] = language
+        self.executables[variant_key] = f"{root}_{variant}{extension}"
+        self.build_variants[variant_key] = {
+            "base_key": file_key,
+            "variant": variant,
+            "overrides": dict(overrides),
+        }
+
+        logger.debug(f"Registered {variant} build variant for {file_key}")
+        return variant_key
+
+    def add_sanitizer_build(self, file_key: str) -> Optional[str]:
+        """
+        Register an ASan/UBSan build of a source file.
+
+        Args:
+            file_key: Key of the source file to sanitize
+
+        Returns:
+            Optional[str]: Variant key, or None if the language has no sanitizers
+        """
+        return self.add_build_variant(
+            file_key,
+            "sanitized",
+            # Sanitizer runtimes need the dynamic loader
+            {"extra_flags": self.get_sanitizer_flags(), "stress_build": False},
+        )
+
+    def compile_all(self, blocking: bool = False) -> bool:
         """
         Compile all files in parallel with optimizations and caching.
 
+        Args:
+            blocking: Compile in the calling thread instead of a background
+                      thread (headless runs without an event loop)
+
         Returns:
-            bool: True if all files compiled successfully, False otherwise
+            bool: True if compilation started (blocking: if all files compiled)
         """
         self.compilation_failed = False
 
+        if blocking:
+            self._parallel_compile_all()
+            return not self.compilation_failed
+
         # Start parallel compilation in a separate thread to avoid blocking UI
         compile_thread = threading.Thread(target=self._parallel_compile_all)
         compile_thread.daemon = True
@@ -140,7 +234,8 @@ class BaseCompiler(QObject):
         Compile all files in parallel with smart caching and optimization.
 
         This method consolidates the identical logic from validator_runner.py,
-        benchmarker.py, and comparator.py.
+        benchmarker.py, and comparator.py. Registered build variants are part
+        of self.files, so they are compiled in the same thread pool.
         """
         files_to_compile = list(self.files.keys())
         max_workers = min(len(files_to_compile), multiprocessing.cpu_count())
@@ -212,6 +307,9 @@ class BaseCompiler(QObject):
                             language.value.upper() if language != Language.UNKNOWN else ""
                         )
                         file_name = os.path.basename(self.files[file_key])
+                        if file_key in self.build_variants:
+                            variant = self.build_variants[file_key]["variant"]
+                            file_name = f"{file_name} ({variant} build)"
 
                         if success:
                             self.compilationOutput.emit(f"✅ {output}\n", "success")
@@ -307,10 +405,18 @@ class BaseCompiler(QObject):
             try:
                 source_mtime = os.path.getmtime(source_file)
                 exe_mtime = os.path.getmtime(executable_file)
-                return source_mtime > exe_mtime  # Source is newer than executable
+                if source_mtime > exe_mtime:
+                    return True  # Source is newer than executable
             except OSError:
                 return True  # If we can't check timestamps, be safe and recompile
 
+            # Rebuild after the stress build setting was toggled
+            if language == Language.CPP and self.get_stress_build_flags():
+                stress_build = bool(self._get_language_config(language, file_key).get("stress_build"))
+                if is_dynamic_executable(executable_file) is stress_build:
+                    return True
+            return False
+
     def _compile_single_file(self, file_key: str) -> Tuple[bool, str]:
         """
         Compile a single file using language-specific compiler.
@@ -332,32 +438,48 @@ class BaseCompiler(QObject):
             return False, f"Unknown language for {file_key}: {source_file}"
 
         try:
-            # Get or create language-specific compiler
-            if language not in self.language_compilers:
-                lang_config = self._get_language_config(language)
-                self.language_compilers[language] = (
-                    LanguageCompilerFactory.create_compiler(language, lang_config)
+            variant = self.build_variants.get(file_key)
+            if variant or self._get_file_overrides(language, file_key):
+                # Variants and files with saved overrides carry their own config
+                # overlay - never share the cached compiler
+                compiler = LanguageCompilerFactory.create_compiler(
+                    language, self._get_language_config(language, file_key)
                 )
+            else:
+                # Get or create language-specific compiler
+                if language not in self.language_compilers:
+                    lang_config = self._get_language_config(language)
+                    self.language_compilers[language] = (
+                        LanguageCompilerFactory.create_compiler(language, lang_config)
+                    )
 
-            compiler = self.language_compilers[language]
+                compiler = self.language_compilers[language]
 
             # Compile using language-specific compiler
             success, message = compiler.compile(
                 source_file=source_file, output_file=executable_file, timeout=30
             )
 
+            if success and variant:
+                message = f"{message} ({variant['variant']} build)"
+
             return success, message
 
         except Exception as e:
             logger.error(f"Compilation error for {file_key}: {e}")
             return False, f"Compilation error: {str(e)}"
 
-    def _get_language_config(self, language: Language) -> Dict[str, Any]:
+    def _get_language_config(
+        self, language: Language, file_key: Optional[str] = None
+    ) -> Dict[str, Any]:
         """
         Get language-specific configuration from config.
 
         Args:
             language: Language enum
+            file_key: Optional file key; per-file overrides (file_overrides,
+                      keyed by source path) and build variant overrides are
+                      overlaid in that order
 
         Returns:
             Dict: Language configuration with compiler settings
@@ -371,8 +493,40 @@ class BaseCompiler(QObject):
         if language == Language.CPP and "optimization" not in lang_config:
             lang_config["optimization"] = self.optimization_level
 
+        file_overrides = self._get_file_overrides(language, file_key)
+        if file_overrides:
+            lang_config = {**lang_config, **file_overrides}
+
+        variant = self.build_variants.get(file_key) if file_key else None
+        if variant:
+            lang_config = {**lang_config, **variant["overrides"]}
+
+        if language == Language.CPP and lang_config.get("stress_build"):
+            lang_config = {
+                **lang_config,
+                "link_flags": list(lang_config.get("link_flags", [])) + self.get_stress_build_flags(),
+            }
+
         return lang_config
 
+    def _get_file_overrides(
+        self, language: Language, file_key: Optional[str]
+    ) -> Dict[str, Any]:
+        """
+        Get the config overrides saved for a source file (e.g. autotuned flags).
+
+        Args:
+            language: Language enum
+            file_key: File key (None: no overrides)
+
+        Returns:
+            Dict: Overrides from languages.<lang>.file_overrides[source path]
+        """
+        if not file_key or file_key not in self.files:
+            return {}
+        lang_config = self.config.get("languages", {}).get(language.value, {})
+        return lang_config.get("file_overrides", {}).get(self.files[file_key], {})
+
     def get_compiler_flags(self) -> List[str]:
         """
         Get compiler flags for compilation.
@@ -407,6 +561,43 @@ class BaseCompiler(QObject):
             "-fsanitize=undefined",  # Enable undefined behavior sanitizer
         ]
 
+    def get_sanitizer_flags(self) -> List[str]:
+        """
+        Get flags for sanitizer builds (tiered stress testing).
+
+        Unlike get_debug_flags(), DEBUG is not defined, so the sanitized binary
+        prints exactly what the release build prints.
+
+        Returns:
+            List[str]: List of sanitizer compiler flags
+        """
+        return [
+            "-g",  # Include debug information for readable reports
+            "-fno-omit-frame-pointer",  # Reliable stack traces in reports
+            "-fsanitize=address",  # Enable address sanitizer
+            "-fsanitize=undefined",  # Enable undefined behavior sanitizer
+        ]
+
+    def get_stress_build_flags(self) -> List[str]:
+        """
+        Get linker flags for stress builds (languages.cpp.stress_build).
+
+        Stress tests launch the solutions thousands of times on tiny inputs,
+        where dynamic loading and relocation are a visible part of each run.
+
+        Returns:
+            List[str]: List of linker flags (empty where static linking is unavailable)
+        """
+        if sys.platform == "darwin":
+            return []  # No static libc on macOS
+        return [
+            "-static",  # No dynamic loader or shared library relocations
+            "-static-libstdc++",  # Also where only libstdc++ can be linked statically
+            "-static-libgcc",
+            "-no-pie",  # Fixed load address, no self-relocation at startup
+            "-Wl,-z,now",  # Resolve remaining symbols at load, not on first call
+        ]
+
     def get_release_flags(self) -> List[str]:
         """
         Get release-specific compiler flags.
@@ -4,20 +4,42 @@ BaseRunner - Consolidated runner patterns for all tools.
 This class consolidates the 300+ lines of duplicated runner boilerplate
 from ValidatorRunner, Benchmarker, and Comparator into a single reusable
 base class with consistent threading, database integration, and lifecycle management.
+
+Runs can be checkpointed to a journal (config["checkpoint"]) and resumed
+from it with resume_from(); see base/checkpoint.py.
 """
 
 import json
 import logging
-from datetime import datetime
-from typing import Any, Dict, Optional
-
-from PySide6.QtCore import QObject, QThread, Signal
+import os
+from datetime import datetime, timedelta
+from typing import Any, Dict, List, Optional
 
 from src.app.core.tools.base.base_compiler import BaseCompiler
+from src.app.core.tools.base.checkpoint import (
+    DEFAULT_CHECKPOINT_INTERVAL,
+    RunJournal,
+    binary_hashes,
+    journal_path,
+)
+from src.app.core.tools.base.cpu_topology import CorePool
+from src.app.core.tools.base.language_detector import Language
+from src.app.core.tools.base.output_capture import DEFAULT_OUTPUT_LIMIT_MB
+from src.app.core.tools.base.process_limits import (
+    DEFAULT_STACK_LIMIT_MB,
+    stack_limit_supported,
+)
+from src.app.core.tools.base.qt_compat import QObject, QThread, Signal
+from src.app.core.tools.base.startup_probe import is_dynamic_executable
+from src.app.core.tools.base.warm_java_pool import warm_jvm_supported
+from src.app.core.tools.base.warm_python_pool import warm_pool_supported
 from src.app.database import DatabaseManager, TestResult
 
 logger = logging.getLogger(__name__)
 
+# Roles whose process startup is probed after a run (solutions reading stdin)
+STARTUP_PROBE_ROLES = ("test", "correct")
+
 
 class BaseRunner(QObject):
     """
@@ -133,16 +155,74 @@ class BaseRunner(QObject):
         self.test_start_time = None
         self.test_count = 0
 
+        # Checkpointing: seconds between checkpoints (None = off), and the
+        # journal the next run resumes
+        self.checkpoint_interval: Optional[float] = None
+        self.resume_journal: Optional[RunJournal] = None
+        self._resume_force = False
+        checkpoint_config = self.config.get("checkpoint", {})
+        if checkpoint_config.get("enabled", False):
+            self.enable_checkpoints(
+                checkpoint_config.get("interval_s", DEFAULT_CHECKPOINT_INTERVAL)
+            )
+
         logger.debug(f"Initialized BaseRunner for {test_type} tests in {workspace_dir}")
 
-    def compile_all(self) -> bool:
+    def enable_checkpoints(self, interval: float = DEFAULT_CHECKPOINT_INTERVAL) -> None:
+        """
+        Checkpoint every following run to a journal in checkpoint_dir().
+
+        Args:
+            interval: Seconds between checkpoints
+        """
+        self.checkpoint_interval = interval
+
+    def checkpoint_dir(self) -> str:
+        """Directory of this tool's run journals."""
+        from src.app.shared.constants.paths import get_test_type_dir
+
+        return os.path.join(get_test_type_dir(self.workspace_dir, self.test_type), "checkpoints")
+
+    def resume_from(self, path: str, force: bool = False) -> RunJournal:
+        """
+        Make the next run continue the run of a journal from its last checkpoint.
+
+        Start it with run_tests(journal.test_count, **journal.header["options"])
+        after compiling; tests completed before the checkpoint are not run
+        again.
+
+        Args:
+            path: Journal of the run
+            force: Resume even if the compiled binaries differ from the
+                   ones the run started with
+
+        Returns:
+            RunJournal: The loaded journal
+
+        Raises:
+            OSError: If the journal cannot be read
+            ValueError: If it is not a journal of this tool
+        """
+        journal = RunJournal.load(path, self.checkpoint_interval)
+        if journal.header.get("test_type") != self.test_type:
+            raise ValueError(
+                f"Journal {path} is a {journal.header.get('test_type')} run, not {self.test_type}"
+            )
+        self.resume_journal = journal
+        self._resume_force = force
+        return journal
+
+    def compile_all(self, blocking: bool = False) -> bool:
         """
         Compile all required files using the BaseCompiler.
 
+        Args:
+            blocking: Compile in the calling thread (headless runs)
+
         Returns:
-            bool: True if compilation started successfully
+            bool: True if compilation started successfully (blocking: if it succeeded)
         """
-        return self.compiler.compile_all()
+        return self.compiler.compile_all(blocking=blocking)
 
     def run_tests(self, test_count: int, **kwargs) -> None:
         """
@@ -179,11 +259,8 @@ class BaseRunner(QObject):
             runner.run_tests(5, time_limit=1000, memory_limit=256, max_workers=2)
             ```
         """
-        self.test_count = test_count
-        self.test_start_time = datetime.now()
-
         # Create worker and thread FIRST
-        self.worker = self._create_test_worker(test_count, **kwargs)
+        self.worker = self.prepare_worker(test_count, **kwargs)
         self.thread = QThread()
 
         # Move worker to thread
@@ -211,6 +288,95 @@ class BaseRunner(QObject):
 
         logger.debug(f"Started {test_count} {self.test_type} tests")
 
+    def prepare_worker(self, test_count: int, **kwargs):
+        """
+        Create the test worker of a run and apply the runner's settings to it.
+
+        run_tests() moves the worker to a QThread; the headless CLI calls its
+        run_tests() directly.
+
+        Args:
+            test_count: Number of tests to execute
+            **kwargs: Additional test-specific parameters passed to _create_test_worker()
+
+        Returns:
+            Test worker instance, also stored as self.worker
+
+        Raises:
+            ValueError: If a resumed run's binaries changed (see resume_from())
+        """
+        self.test_count = test_count
+        self.test_start_time = datetime.now()
+
+        journal = self.resume_journal
+        if journal is not None:
+            kwargs["run_seed"] = journal.run_seed
+
+        self.worker = self._create_test_worker(test_count, **kwargs)
+        if kwargs.get("run_seed") is not None:
+            # Not every tool passes the seed on to its worker
+            self.worker.run_seed = kwargs["run_seed"]
+        warm_roles = self._get_warm_interpreter_roles()
+        if warm_roles:
+            self.worker.enable_warm_interpreters(warm_roles)
+        stack_limits = self._get_stack_limits()
+        if stack_limits:
+            self.worker.set_stack_limits(stack_limits)
+        self.worker.set_output_limit(self._get_output_limit())
+        core_pool = self._get_cpu_placement()
+        if core_pool is not None:
+            self.worker.set_cpu_placement(core_pool)
+        probe_commands = self._get_startup_probe_commands()
+        if probe_commands:
+            self.worker.set_startup_probes(probe_commands)
+
+        if journal is not None:
+            self._resume_worker(journal)
+        elif self.checkpoint_interval is not None and self.worker.supports_checkpoints:
+            self._start_journal(test_count, kwargs)
+        return self.worker
+
+    def _resume_worker(self, journal: RunJournal) -> None:
+        """Continue the journal's run with the new worker."""
+        self.resume_journal = None
+        changed = journal.changed_binaries(binary_hashes(self.worker.execution_commands))
+        if changed and not self._resume_force:
+            raise ValueError(
+                f"Cannot resume {journal.path}: {', '.join(changed)} changed since the run started"
+            )
+        if changed:
+            logger.warning(f"Resuming {journal.path} with changed binaries: {', '.join(changed)}")
+        self.worker.enable_checkpoints(journal)
+        # Total time covers the earlier sessions too
+        self.test_start_time = datetime.now() - timedelta(seconds=journal.previous_elapsed)
+        logger.info(
+            f"Resuming {journal.path}: {journal.completed} of {journal.test_count} tests completed"
+        )
+
+    def _start_journal(self, test_count: int, options: Dict[str, Any]) -> None:
+        """Checkpoint the new worker's run to a new journal."""
+        try:
+            journal = RunJournal.create(
+                journal_path(self.checkpoint_dir(), self.worker.run_seed),
+                self.test_type,
+                self.worker.run_seed,
+                test_count,
+                binary_hashes(self.worker.execution_commands),
+                workspace_dir=self.workspace_dir,
+                files=self.files,
+                options={
+                    key: value
+                    for key, value in options.items()
+                    if key != "run_seed" and isinstance(value, (bool, int, float, str, type(None)))
+                },
+                interval=self.checkpoint_interval,
+            )
+        except OSError as e:
+            logger.error(f"Could not start checkpoint journal, running without: {e}")
+            return
+        self.worker.enable_checkpoints(journal)
+        logger.info(f"Checkpointing run to {journal.path}")
+
     def _create_test_worker(self, test_count: int, **kwargs):
         """
         Create the appropriate test worker - ABSTRACT METHOD.
@@ -226,6 +392,147 @@ class BaseRunner(QObject):
         """
         raise NotImplementedError("Subclasses must implement _create_test_worker()")
 
+    def _get_stack_limits(self) -> Dict[str, int]:
+        """
+        Get the stack limits of native (C++) roles.
+
+        Judges usually allow far more than the default 8 MB stack, so deep
+        recursion would otherwise be reported as a crash. The limit comes
+        from languages.cpp.stack_limit_mb (0 = unlimited).
+
+        Returns:
+            Dict[str, int]: File key -> stack limit in MB (empty where unsupported)
+        """
+        if not stack_limit_supported():
+            return {}
+        cpp_config = self.config.get("languages", {}).get("cpp", {})
+        limit_mb = cpp_config.get("stack_limit_mb", DEFAULT_STACK_LIMIT_MB)
+        if limit_mb is None:
+            return {}
+
+        return {
+            key: int(limit_mb)
+            for key, language in self.compiler.file_languages.items()
+            if language == Language.CPP
+        }
+
+    def _get_startup_probe_commands(self) -> Dict[str, List[str]]:
+        """
+        Get the commands whose process startup the worker times after a run.
+
+        Only native (C++) solutions: a generator ignores its input, so its
+        run on empty input would be a whole generation, not startup.
+
+        Returns:
+            Dict[str, List[str]]: File key -> execution command
+        """
+        return {
+            key: self.compiler.get_execution_command(key)
+            for key, language in self.compiler.file_languages.items()
+            if language == Language.CPP
+            and key in STARTUP_PROBE_ROLES
+            and self.compiler.executables.get(key)
+        }
+
+    def _get_cpu_placement(self) -> Optional[CorePool]:
+        """
+        Get the core slots tests are placed on.
+
+        Returns:
+            Optional[CorePool]: None (tests run wherever the kernel puts
+            them); timing-sensitive runners override this
+        """
+        return None
+
+    def _get_output_limit(self) -> float:
+        """
+        Get the output limit of solutions in MB (output_limit_mb, 0 = unlimited).
+
+        Solutions printing more are killed with an Output Limit Exceeded
+        verdict instead of filling memory.
+        """
+        limit_mb = self.config.get("output_limit_mb", DEFAULT_OUTPUT_LIMIT_MB)
+        return DEFAULT_OUTPUT_LIMIT_MB if limit_mb is None else limit_mb
+
+    def _get_warm_interpreter_roles(self) -> Dict[str, str]:
+        """
+        Get the file keys served by warm interpreters.
+
+        Python roles are enabled with languages.py.warm_pool, Java roles with
+        languages.java.warm_jvm. Both need POSIX primitives (fork, named
+        pipes), so the mapping is empty on Windows.
+
+        Returns:
+            Dict[str, str]: File key -> language key ('py' or 'java')
+        """
+        languages = self.config.get("languages", {})
+        enabled = {}
+        if languages.get("py", {}).get("warm_pool", False):
+            if warm_pool_supported():
+                enabled[Language.PYTHON] = "py"
+            else:
+                logger.info("Warm Python interpreters are not supported on this platform")
+        if languages.get("java", {}).get("warm_jvm", False):
+            if warm_jvm_supported():
+                enabled[Language.JAVA] = "java"
+            else:
+                logger.info("Persistent JVMs are not supported on this platform")
+
+        if not enabled:
+            return {}
+
+        return {
+            key: enabled[language]
+            for key, language in self.compiler.file_languages.items()
+            if language in enabled
+        }
+
+    def _measure_startup_overhead(self, per_test_times: Dict[str, float]) -> Dict[str, Any]:
+        """
+        Report the process startup overhead of native (C++) solutions.
+
+        The worker ran each binary a few times on empty input after the
+        tests (see _get_startup_probe_commands()); the fastest run is the
+        fixed cost of launching it, compared with the average time the role
+        took per test.
+
+        Args:
+            per_test_times: File key -> average seconds per test of the role
+
+        Returns:
+            Dict[str, Any]: File key -> dynamic (None if unknown), stress_build,
+            min_seconds, median_seconds and share_of_test_time; timed_out
+            instead of the times if the binary does not exit on empty input
+        """
+        # Called when saving results, where the runner may not be set up
+        compiler = getattr(self, "compiler", None)
+        probes = getattr(getattr(self, "worker", None), "startup_probes", None)
+        if compiler is None or not isinstance(probes, dict):
+            return {}
+        config = getattr(self, "config", None) or {}
+
+        overhead = {}
+        for key, per_test in per_test_times.items():
+            if key not in probes:
+                continue
+            entry = {
+                "dynamic": is_dynamic_executable(compiler.executables.get(key, "")),
+                "stress_build": bool(
+                    config.get("languages", {}).get("cpp", {}).get("stress_build", False)
+                ),
+            }
+            probe = probes[key]
+            if probe is None:
+                entry["timed_out"] = True
+            else:
+                entry["min_seconds"] = probe["min_seconds"]
+                entry["median_seconds"] = probe["median_seconds"]
+                entry["share_of_test_time"] = (
+                    min(1.0, probe["min_seconds"] / per_test) if per_test > 0 else None
+                )
+            overhead[key] = entry
+        return overhead
+
     def _connect_worker_signals(self, worker):
         """
         Connect worker signals to external listeners - TEMPLATE METHOD.
@@ -260,39 +567,10 @@ class BaseRunner(QObject):
             return -1
 
         try:
-            # Get test results from worker
-            test_results = []
-            if hasattr(self.worker, "get_results"):
-                test_results = self.worker.get_results()
-            elif hasattr(self.worker, "test_results"):
-                test_results = getattr(self.worker, "test_results", [])
-
-            # Check if we have results to save
-            if not test_results:
-                logger.warning("No test results available to save")
+            test_result = self.build_test_result()
+            if test_result is None:
                 return -1
 
-            # Calculate statistics
-            if not self.test_start_time:
-                logger.error("test_start_time not set - cannot calculate total_time")
-                return -1
-
-            total_time = (datetime.now() - self.test_start_time).total_seconds()
-            passed_tests = sum(
-                1 for result in test_results if result.get("passed", False)
-            )
-            failed_tests = len(test_results) - passed_tests
-            all_passed = (failed_tests == 0) and (len(test_results) > 0)
-
-            # Create test result object using template method
-            test_result = self._create_test_result(
-                all_passed=all_passed,
-                test_results=test_results,
-                passed_tests=passed_tests,
-                failed_tests=failed_tests,
-                total_time=total_time,
-            )
-
             # Save to database
             result_id = self.db_manager.save_test_result(test_result)
             if result_id > 0:
@@ -306,6 +584,59 @@ class BaseRunner(QObject):
             logger.error(f"Error saving test results: {e}", exc_info=True)
             return -1
 
+    def build_test_result(self) -> Optional[TestResult]:
+        """
+        Build the database result of the worker's run without saving it.
+
+        Returns:
+            Optional[TestResult]: None if there are no results (or no start time)
+        """
+        # Get test results from worker
+        test_results = []
+        if hasattr(self.worker, "get_results"):
+            test_results = self.worker.get_results()
+        elif hasattr(self.worker, "test_results"):
+            test_results = getattr(self.worker, "test_results", [])
+
+        # Workers that keep only failing results count their passes
+        unrecorded_passes = getattr(self.worker, "unrecorded_passes", 0)
+        if not isinstance(unrecorded_passes, int):
+            unrecorded_passes = 0
+
+        # Check if we have results to save
+        if not test_results and not unrecorded_passes:
+            logger.warning("No test results available to save")
+            return None
+
+        # Calculate statistics
+        if not self.test_start_time:
+            logger.error("test_start_time not set - cannot calculate total_time")
+            return None
+
+        total_time = (datetime.now() - self.test_start_time).total_seconds()
+        recorded_passes = sum(
+            1 for result in test_results if result.get("passed", False)
+        )
+        passed_tests = recorded_passes + unrecorded_passes
+        failed_tests = len(test_results) - recorded_passes
+        all_passed = (failed_tests == 0) and (passed_tests > 0)
+
+        # Create test result object using template method
+        test_result = self._create_test_result(
+            all_passed=all_passed,
+            test_results=test_results,
+            passed_tests=passed_tests,
+            failed_tests=failed_tests,
+            total_time=total_time,
+        )
+
+        journal = getattr(self.worker, "journal", None)
+        if isinstance(journal, RunJournal) and test_result.mismatch_analysis:
+            analysis = json.loads(test_result.mismatch_analysis)
+            analysis["checkpoint"] = journal.summary()
+            test_result.mismatch_analysis = json.dumps(analysis)
+        return test_result
+
     def _create_test_result(
         self,
         all_passed: bool,
@@ -0,0 +1,227 @@
+"""
+Time-limit calibration against a reference (judge) machine.
+
+Raw local milliseconds are compared to limits set on judge servers, and a
+laptop can be twice as fast or slow as those depending on what a solution
+spends its time on. A fixed micro-kernel suite
+(resources/native/calibration_kernels.cpp) times four workload classes:
+
+- "alu": dependent integer arithmetic
+- "latency": a pointer chase through a random cycle far larger than caches
+- "bandwidth": a streaming triad over arrays larger than caches
+- "branchy": unpredictable data-dependent branches
+
+The suite is run once per session on the local machine and compared with
+a reference profile of the same suite measured on the judge-like machine
+(config["benchmarker"]["reference_profile"], kernel -> seconds; running
+the suite there and saving the profile is enough). speed_factors() gives
+local / reference time per kernel; a factor of 1.5 means the local machine
+needs 1.5x the judge's time, so limits are scaled up by it and local times
+divided by it to predict the judge time. The "mixed" class uses the
+geometric mean of all kernels.
+"""
+
+import json
+import logging
+import math
+import os
+import subprocess
+import threading
+from typing import Any, Dict, Optional
+
+from src.app.core.tools.base.alloc_profiler import build_native
+
+logger = logging.getLogger(__name__)
+
+KERNEL_SOURCE = os.path.normpath(
+    os.path.join(
+        os.path.dirname(os.path.abspath(__file__)),
+        "..", "..", "..", "resources", "native", "calibration_kernels.cpp",
+    )
+)
+KERNEL_EXECUTABLE = "cts_calibrate.exe" if os.name == "nt" else "cts_calibrate"
+
+KERNELS = ("alu", "latency", "bandwidth", "branchy")
+WORKLOAD_CLASSES = KERNELS + ("mixed",)
+DEFAULT_WORKLOAD_CLASS = "mixed"
+
+# Repetitions of every kernel; the fastest is kept
+CALIBRATION_REPETITIONS = 3
+
+# Seconds the whole suite may take
+CALIBRATION_TIMEOUT = 60
+
+# Profile of the local machine, measured once per session
+_local_profile: Optional[Dict[str, float]] = None
+_profile_lock = threading.Lock()
+
+
+def ensure_kernels_built(compiler: str = "g++", timeout: int = 60) -> Optional[str]:
+    """
+    Compile the kernel suite into the user cache if needed.
+
+    Args:
+        compiler: C++ compiler executable
+        timeout: Compilation timeout in seconds
+
+    Returns:
+        Optional[str]: Path of the executable, or None on failure
+    """
+    return build_native(
+        KERNEL_SOURCE, KERNEL_EXECUTABLE, ["-O2", "-std=c++17"], compiler=compiler, timeout=timeout
+    )
+
+
+def parse_profile(text: str) -> Optional[Dict[str, float]]:
+    """
+    Parse the suite's output.
+
+    Returns:
+        Optional[Dict[str, float]]: Kernel -> seconds, None unless every
+        kernel has a positive time
+    """
+    try:
+        data = json.loads(text)
+    except (TypeError, ValueError):
+        return None
+    if not isinstance(data, dict):
+        return None
+    try:
+        profile = {kernel: float(data[kernel]) for kernel in KERNELS}
+    except (KeyError, TypeError, ValueError):
+        return None
+    if any(not seconds > 0 for seconds in profile.values()):
+        return None
+    return profile
+
+
+def run_calibration(
+    executable: str,
+    repetitions: int = CALIBRATION_REPETITIONS,
+    timeout: float = CALIBRATION_TIMEOUT,
+) -> Optional[Dict[str, float]]:
+    """
+    Run the kernel suite.
+
+    Args:
+        executable: Path returned by ensure_kernels_built()
+        repetitions: Runs per kernel, the fastest is kept
+        timeout: Seconds the suite may take
+
+    Returns:
+        Optional[Dict[str, float]]: Kernel -> seconds, None on failure
+    """
+    try:
+        result = subprocess.run(
+            [executable, str(repetitions)],
+            stdin=subprocess.DEVNULL,
+            stdout=subprocess.PIPE,
+            stderr=subprocess.PIPE,
+            text=True,
+            timeout=timeout,
+        )
+    except (OSError, subprocess.TimeoutExpired) as e:
+        logger.warning(f"Calibration failed: {e}")
+        return None
+    if result.returncode != 0:
+        logger.warning(f"Calibration failed with exit code {result.returncode}")
+        return None
+    return parse_profile(result.stdout)
+
+
+def measure_machine_profile(compiler: str = "g++", refresh: bool = False) -> Optional[Dict[str, float]]:
+    """
+    Get the kernel profile of the local machine.
+
+    Measured on first use and kept for the session.
+
+    Args:
+        compiler: C++ compiler for building the suite
+        refresh: Measure again even if a profile is cached
+
+    Returns:
+        Optional[Dict[str, float]]: Kernel -> seconds, None if the suite
+        could not be built or run
+    """
+    global _local_profile
+    with _profile_lock:
+        if _local_profile is None or refresh:
+            executable = ensure_kernels_built(compiler)
+            profile = run_calibration(executable) if executable else None
+            if profile is None:
+                return None
+            _local_profile = profile
+        return dict(_local_profile)
+
+
+def speed_factors(local: Dict[str, float], reference: Dict[str, Any]) -> Optional[Dict[str, float]]:
+    """
+    Compare the local profile with the reference profile.
+
+    Returns:
+        Optional[Dict[str, float]]: Kernel -> local / reference time (above
+        1: the local machine is slower), None unless both profiles cover
+        every kernel
+    """
+    if not isinstance(reference, dict):
+        return None
+    reference_profile = parse_profile(json.dumps(reference))
+    if reference_profile is None or not local:
+        return None
+    try:
+        return {kernel: local[kernel] / reference_profile[kernel] for kernel in KERNELS}
+    except (KeyError, ZeroDivisionError):
+        return None
+
+
+def class_factor(factors: Dict[str, float], workload_class: str = DEFAULT_WORKLOAD_CLASS) -> float:
+    """
+    Get the factor limits of a workload class are scaled by.
+
+    Args:
+        factors: Result of speed_factors()
+        workload_class: A kernel name, or 'mixed' for the geometric mean
+
+    Raises:
+        ValueError: If the workload class is unknown
+    """
+    if workload_class == "mixed":
+        return math.exp(sum(math.log(factors[kernel]) for kernel in KERNELS) / len(KERNELS))
+    if workload_class not in KERNELS:
+        raise ValueError(f"Unknown workload class: {workload_class}")
+    return factors[workload_class]
+
+
+def summarize_calibration(
+    factors: Dict[str, float],
+    workload_class: str,
+    time_limit_ms: float,
+    max_execution_time: Optional[float] = None,
+) -> Dict[str, Any]:
+    """
+    Describe the calibration a run used.
+
+    Args:
+        factors: Result of speed_factors()
+        workload_class: Workload class the limit was scaled for
+        time_limit_ms: Judge time limit
+        max_execution_time: Slowest local test in seconds
+
+    Returns:
+        Dict[str, Any]: Factors per kernel, the class and its factor, the
+        judge and local limits, and the predicted judge time of the slowest
+        test with whether it fits the judge limit
+    """
+    factor = class_factor(factors, workload_class)
+    summary: Dict[str, Any] = {
+        "factors": dict(factors),
+        "workload_class": workload_class,
+        "factor": factor,
+        "time_limit_ms": time_limit_ms,
+        "local_time_limit_ms": time_limit_ms * factor,
+    }
+    if max_execution_time is not None:
+        predicted = max_execution_time / factor
+        summary["predicted_max_time"] = predicted
+        summary["predicted_within_limit"] = predicted * 1000 <= time_limit_ms
+    return summary
@@ -0,0 +1,325 @@
+"""
+Checkpoint journal of long test runs, so they can be resumed.
+
+Test N of a run always gets the same generator seed (see seeds.py), so a
+run is fully described by its run seed, test count and binaries, plus
+which tests completed. The journal is an append-only JSON-lines file:
+
+    {"type": "run", ...}          header: tool, run seed, test count, run
+                                  options, workspace and source files,
+                                  binary SHA-256s
+    {"type": "checkpoint", ...}   every interval: seed cursor (all tests up
+                                  to it completed) and the completed tests
+                                  after it, counts and time totals, and the
+                                  failures since the previous checkpoint
+    {"type": "end", ...}          last checkpoint once every test completed
+
+Passing tests are only counted, failing tests are kept in full. A line cut
+short by a crash is ignored when the journal is loaded, so a resumed run
+repeats at most the tests of one interval.
+"""
+
+import hashlib
+import json
+import logging
+import os
+import threading
+import time
+from typing import Any, Dict, Iterable, List, Optional
+
+logger = logging.getLogger(__name__)
+
+JOURNAL_VERSION = 1
+
+# Seconds between checkpoints
+DEFAULT_CHECKPOINT_INTERVAL = 30.0
+
+# Result keys summed into the journal's time totals
+_TOTAL_KEYS = (
+    "generator_time",
+    "test_time",
+    "correct_time",
+    "validator_time",
+    "comparison_time",
+    "execution_time",
+    "cpu_time",
+    "total_time",
+    "memory",
+    "memory_used",
+)
+
+
+def binary_hashes(execution_commands: Dict[str, List[str]]) -> Dict[str, Optional[str]]:
+    """
+    Hash the files each role runs.
+
+    Args:
+        execution_commands: Role -> execution command
+
+    Returns:
+        Dict[str, Optional[str]]: Role -> SHA-256 over every file argument of
+        its command (the executable, or the script after its interpreter);
+        None if the command names no file (e.g. a Java class on a classpath)
+    """
+    hashes = {}
+    for role, command in execution_commands.items():
+        digest = hashlib.sha256()
+        found = False
+        for argument in command:
+            if isinstance(argument, str) and os.path.isfile(argument):
+                with open(argument, "rb") as f:
+                    for block in iter(lambda: f.read(1 << 20), b""):
+                        digest.update(block)
+                found = True
+        hashes[role] = digest.hexdigest() if found else None
+    return hashes
+
+
+def journal_path(directory: str, run_seed: int) -> str:
+    """Path of the journal of a run in a checkpoint directory."""
+    return os.path.join(directory, f"run-{run_seed:016x}.jsonl")
+
+
+class RunJournal:
+    """
+    Journal of one run: what completed, and when to write the next checkpoint.
+
+    record() is called with each result by the thread collecting results;
+    checkpoint() appends a checkpoint once the interval has passed.
+    """
+
+    def __init__(self, path: str, header: Dict[str, Any], interval: float = DEFAULT_CHECKPOINT_INTERVAL):
+        self.path = path
+        self.header = header
+        self.interval = interval
+        self._lock = threading.Lock()
+
+        # Completed tests: all up to the cursor, plus those after it
+        self.cursor = 0
+        self._ahead: set = set()
+
+        self.passed = 0
+        self.failed = 0
+        self.totals: Dict[str, float] = {}
+        self.failures: List[Dict[str, Any]] = []
+        self._new_failures: List[Dict[str, Any]] = []
+        self.checkpoints = 0
+        self.sessions = 1
+        self.complete = False
+
+        # Run time of earlier sessions, and when this one started
+        self.previous_elapsed = 0.0
+        self._session_start = time.monotonic()
+        self._last_checkpoint = self._session_start
+
+    @classmethod
+    def create(
+        cls,
+        path: str,
+        test_type: str,
+        run_seed: int,
+        test_count: int,
+        binaries: Dict[str, Optional[str]],
+        workspace_dir: str = "",
+        files: Optional[Dict[str, str]] = None,
+        options: Optional[Dict[str, Any]] = None,
+        interval: float = DEFAULT_CHECKPOINT_INTERVAL,
+    ) -> "RunJournal":
+        """
+        Start the journal of a new run (an existing journal at path is replaced).
+
+        Raises:
+            OSError: If the journal cannot be written
+        """
+        header = {
+            "type": "run",
+            "version": JOURNAL_VERSION,
+            "test_type": test_type,
+            "run_seed": run_seed,
+            "test_count": test_count,
+            "binaries": binaries,
+            "workspace_dir": workspace_dir,
+            "files": files or {},
+            "options": options or {},
+            "interval": interval,
+            "created": time.time(),
+        }
+        os.makedirs(os.path.dirname(os.path.abspath(path)), exist_ok=True)
+        with open(path, "w", encoding="utf-8") as f:
+            f.write(json.dumps(header, default=str) + "\n")
+            f.flush()
+            os.fsync(f.fileno())
+        return cls(path, header, interval)
+
+    @classmethod
+    def load(cls, path: str, interval: Optional[float] = None) -> "RunJournal":
+        """
+        Load a journal to resume its run.
+
+        A last line cut short by a crash is removed from the file, so the
+        resumed run's checkpoints start on a line of their own.
+
+        Args:
+            path: Journal of the run
+            interval: Seconds between checkpoints (None = the run's)
+
+        Raises:
+            OSError: If the journal cannot be read
+            ValueError: If it is not a run journal of a supported version
+        """
+        with open(path, "rb+") as f:
+            data = f.read()
+            end = data.rfind(b"\n") + 1
+            if end < len(data):
+                logger.warning(f"Removing incomplete last line of {path}")
+                f.truncate(end)
+        lines = data[:end].decode("utf-8").splitlines()
+
+        entries = []
+        for number, line in enumerate(lines, 1):
+            try:
+                entries.append(json.loads(line))
+            except json.JSONDecodeError:
+                logger.warning(f"Ignoring corrupt line {number} of {path}")
+
+        if not entries or entries[0].get("type") != "run":
+            raise ValueError(f"Not a run journal: {path}")
+        header = entries[0]
+        if header.get("version") != JOURNAL_VERSION:
+            raise ValueError(f"Unsupported journal version {header.get('version')} in {path}")
+
+        if interval is None:
+            interval = header.get("interval", DEFAULT_CHECKPOINT_INTERVAL)
+        journal = cls(path, header, interval)
+        last = None
+        for entry in entries[1:]:
+            if entry.get("type") in ("checkpoint", "end"):
+                journal.failures.extend(entry.get("failures", []))
+                journal.sessions = max(journal.sessions, entry.get("session", 1))
+                last = entry
+        if last is not None:
+            journal.cursor = last["cursor"]
+            journal._ahead = set(last.get("ahead", []))
+            journal.passed = last["passed"]
+            journal.failed = last["failed"]
+            journal.totals = dict(last.get("totals", {}))
+            journal.previous_elapsed = last.get("elapsed", 0.0)
+            journal.checkpoints = last.get("checkpoint", 0)
+            journal.complete = last["type"] == "end"
+        journal.sessions += 1
+        return journal
+
+    @property
+    def run_seed(self) -> int:
+        return self.header["run_seed"]
+
+    @property
+    def test_count(self) -> int:
+        return self.header["test_count"]
+
+    @property
+    def completed(self) -> int:
+        return self.passed + self.failed
+
+    @property
+    def elapsed(self) -> float:
+        """Run time over all sessions in seconds."""
+        return self.previous_elapsed + time.monotonic() - self._session_start
+
+    def is_done(self, test_number: int) -> bool:
+        """Whether a test completed in an earlier session or this one."""
+        with self._lock:
+            return test_number <= self.cursor or test_number in self._ahead
+
+    def remaining(self, test_numbers: Iterable[int]) -> Iterable[int]:
+        """The tests of test_numbers that did not complete yet (lazily)."""
+        return (number for number in test_numbers if not self.is_done(number))
+
+    def changed_binaries(self, binaries: Dict[str, Optional[str]]) -> List[str]:
+        """Roles whose binaries differ from the ones the run started with."""
+        recorded = self.header.get("binaries", {})
+        return sorted(
+            role for role in set(recorded) | set(binaries) if recorded.get(role) != binaries.get(role)
+        )
+
+    def record(self, result: Dict[str, Any]) -> None:
+        """Count a completed test."""
+        test_number = result.get("test_number")
+        if not isinstance(test_number, int):
+            return
+        with self._lock:
+            if test_number <= self.cursor or test_number in self._ahead:
+                return
+            self._ahead.add(test_number)
+            while self.cursor + 1 in self._ahead:
+                self.cursor += 1
+                self._ahead.discard(self.cursor)
+
+            if result.get("passed", False):
+                self.passed += 1
+            else:
+                self.failed += 1
+                self.failures.append(result)
+                self._new_failures.append(result)
+            for key in _TOTAL_KEYS:
+                value = result.get(key)
+                if isinstance(value, (int, float)) and not isinstance(value, bool):
+                    self.totals[key] = self.totals.get(key, 0.0) + value
+
+    def checkpoint(self, force: bool = False) -> bool:
+        """
+        Append a checkpoint if the interval has passed (or force).
+
+        Returns:
+            bool: True if a checkpoint was written
+        """
+        now = time.monotonic()
+        if not force and now - self._last_checkpoint < self.interval:
+            return False
+        with self._lock:
+            complete = self.cursor >= self.test_count
+            self.checkpoints += 1
+            entry = {
+                "type": "end" if complete else "checkpoint",
+                "checkpoint": self.checkpoints,
+                "session": self.sessions,
+                "time": time.time(),
+                "elapsed": self.elapsed,
+                "cursor": self.cursor,
+                "ahead": sorted(self._ahead),
+                "passed": self.passed,
+                "failed": self.failed,
+                "totals": self.totals,
+                "failures": self._new_failures,
+            }
+            line = json.dumps(entry, default=str) + "\n"
+            self._new_failures = []
+            self.complete = complete
+        try:
+            with open(self.path, "a", encoding="utf-8") as f:
+                f.write(line)
+                f.flush()
+                os.fsync(f.fileno())
+        except OSError as e:
+            logger.error(f"Could not write checkpoint to {self.path}: {e}")
+            # Keep the failures for the next checkpoint
+            with self._lock:
+                self._new_failures = entry["failures"] + self._new_failures
+            return False
+        self._last_checkpoint = now
+        return True
+
+    def summary(self) -> Dict[str, Any]:
+        """Describe the journal for a run's analysis."""
+        with self._lock:
+            return {
+                "journal": self.path,
+                "sessions": self.sessions,
+                "checkpoints": self.checkpoints,
+                "completed_tests": self.completed,
+                "passed_tests": self.passed,
+                "failed_tests": self.failed,
+                "elapsed": self.elapsed,
+                "totals": dict(self.totals),
+                "complete": self.complete,
+            }
@@ -0,0 +1,265 @@
+"""
+Pressure-aware adaptive concurrency of test workers.
+
+A fixed worker count is wrong in both directions: memory-hungry tests run
+in parallel push the machine into reclaim and swap (and their timings with
+it), while light tests leave cores idle. AdaptiveConcurrency scales the
+number of tests in flight during a run from three signals:
+
+- Linux pressure stall information (/proc/pressure/{cpu,memory,io}): the
+  share of wall time in which some task was stalled on the resource,
+  computed from the cumulative 'total' counters between two decisions, so
+  it reacts within a fraction of a second instead of the 10 s averages
+- the largest per-test peak RSS seen so far against MemAvailable, which
+  bounds how many more tests fit in memory
+- completed tests per second, measured per decision window
+
+Memory pressure halves the limit and the memory headroom caps it; without
+either, the limit grows by one while tests fill every slot and CPU/IO
+pressure stays low, and a step that lowered throughput is taken back and
+not retried for a while (additive increase, multiplicative decrease).
+
+Linux only (kernel 4.20+ with PSI); elsewhere workers keep their static
+count.
+"""
+
+import os
+import time
+from typing import Any, Callable, Dict, Optional
+
+PRESSURE_DIR = "/proc/pressure"
+PRESSURE_RESOURCES = ("cpu", "memory", "io")
+MEMINFO = "/proc/meminfo"
+
+# Seconds between two decisions
+CONTROL_INTERVAL = 0.5
+
+# Completed tests a window needs before throughput is compared
+MIN_WINDOW_TESTS = 4
+
+# Share of the window with some task stalled: memory above this shrinks the
+# limit, CPU/IO above this stop it from growing
+MEMORY_PRESSURE_LIMIT = 0.05
+CPU_PRESSURE_LIMIT = 0.30
+IO_PRESSURE_LIMIT = 0.30
+
+# Share of MemAvailable further tests may take
+MEMORY_RESERVE = 0.8
+
+# Relative throughput drop that takes back the last increase
+THROUGHPUT_TOLERANCE = 0.05
+
+# Windows without an increase after a step was taken back
+HOLD_WINDOWS = 4
+
+
+def pressure_supported() -> bool:
+    """Check whether the kernel exposes pressure stall information."""
+    return all(
+        os.access(os.path.join(PRESSURE_DIR, resource), os.R_OK)
+        for resource in PRESSURE_RESOURCES
+    )
+
+
+def read_pressure_totals() -> Optional[Dict[str, int]]:
+    """
+    Read the cumulative 'some' stall time per resource.
+
+    Returns:
+        Optional[Dict[str, int]]: Resource -> stalled microseconds since
+        boot, None if unavailable
+    """
+    totals = {}
+    for resource in PRESSURE_RESOURCES:
+        try:
+            with open(os.path.join(PRESSURE_DIR, resource), encoding="ascii") as f:
+                for line in f:
+                    if line.startswith("some "):
+                        totals[resource] = int(line.rsplit("total=", 1)[1])
+                        break
+        except (OSError, IndexError, ValueError):
+            return None
+        if resource not in totals:
+            return None
+    return totals
+
+
+def read_available_mb() -> Optional[float]:
+    """Get MemAvailable in MB, None if unavailable."""
+    try:
+        with open(MEMINFO, encoding="ascii") as f:
+            for line in f:
+                if line.startswith("MemAvailable:"):
+                    return int(line.split()[1]) / 1024
+    except (OSError, IndexError, ValueError):
+        pass
+    return None
+
+
+class AdaptiveConcurrency:
+    """
+    Controller of the number of tests in flight.
+
+    The executing worker calls record() with every finished test's result
+    and update() after each batch of completions, then keeps at most
+    `limit` tests submitted. Not thread-safe: used from the collecting
+    thread only.
+    """
+
+    def __init__(
+        self,
+        initial: int,
+        ceiling: int,
+        clock: Callable[[], float] = time.monotonic,
+        read_pressure: Callable[[], Optional[Dict[str, int]]] = read_pressure_totals,
+        read_available: Callable[[], Optional[float]] = read_available_mb,
+    ):
+        """
+        Args:
+            initial: Tests in flight at the start (the static worker count)
+            ceiling: Upper bound of the limit (thread pool size)
+            clock: Monotonic clock in seconds
+            read_pressure: Source of cumulative stall times
+            read_available: Source of available memory in MB
+        """
+        self.ceiling = max(1, ceiling)
+        self.initial = min(max(1, initial), self.ceiling)
+        self.limit = self.initial
+        self._clock = clock
+        self._read_pressure = read_pressure
+        self._read_available = read_available
+
+        self.peak_rss_mb = 0.0
+        self._completed = 0
+        self._window_start = clock()
+        self._window_completed = 0
+        self._window_pressure = read_pressure()
+        self._last_sample = self._window_start
+        self._last_throughput: Optional[float] = None
+        self._last_step = 0
+        self._hold = 0
+
+        self.min_limit = self.limit
+        self.max_limit = self.limit
+        self.decisions: Dict[str, int] = {}
+        self.last_stalls: Dict[str, float] = {}
+
+    def record(self, result: Optional[Dict[str, Any]]) -> None:
+        """Count a finished test and its peak RSS (memory_used or memory, MB)."""
+        self._completed += 1
+        if not result:
+            return
+        rss = result.get("memory_used", result.get("memory"))
+        if isinstance(rss, (int, float)) and rss > self.peak_rss_mb:
+            self.peak_rss_mb = float(rss)
+
+    def memory_cap(self, in_flight: int) -> Optional[int]:
+        """
+        Get how many tests fit in memory.
+
+        Args:
+            in_flight: Tests currently running (their memory is in use)
+
+        Returns:
+            Optional[int]: Tests in flight plus those fitting in the
+            available memory at the largest peak RSS so far; None before
+            any RSS is known
+        """
+        if self.peak_rss_mb <= 0:
+            return None
+        available = self._read_available()
+        if available is None:
+            return None
+        return in_flight + int(available * MEMORY_RESERVE // self.peak_rss_mb)
+
+    def update(self, in_flight: int) -> int:
+        """
+        Decide the limit after tests completed.
+
+        Args:
+            in_flight: Tests still running
+
+        Returns:
+            int: Tests that may be in flight from now on
+        """
+        now = self._clock()
+        if now - self._last_sample < CONTROL_INTERVAL:
+            return self.limit
+        self._last_sample = now
+
+        elapsed = now - self._window_start
+        pressure = self._read_pressure()
+        stalls = {}
+        if pressure and self._window_pressure and elapsed > 0:
+            stalls = {
+                resource: max(0, pressure[resource] - self._window_pressure[resource]) / (elapsed * 1e6)
+                for resource in PRESSURE_RESOURCES
+            }
+        self.last_stalls = stalls
+        cap = self.memory_cap(in_flight)
+
+        if stalls.get("memory", 0) > MEMORY_PRESSURE_LIMIT:
+            self._step(max(1, self.limit // 2), "memory_pressure")
+        elif cap is not None and cap < self.limit:
+            self._step(max(1, cap), "memory_headroom")
+        else:
+            completed = self._completed - self._window_completed
+            if completed < max(MIN_WINDOW_TESTS, self.limit):
+                return self.limit
+            throughput = completed / elapsed
+            if (
+                self._last_step > 0
+                and self._last_throughput is not None
+                and throughput < self._last_throughput * (1 - THROUGHPUT_TOLERANCE)
+            ):
+                self._step(self.limit - 1, "throughput_drop")
+                self._hold = HOLD_WINDOWS
+            elif (
+                self._hold == 0
+                and in_flight + 1 >= self.limit
+                and self.limit < self.ceiling
+                and (cap is None or cap > self.limit)
+                and stalls.get("cpu", 0) <= CPU_PRESSURE_LIMIT
+                and stalls.get("io", 0) <= IO_PRESSURE_LIMIT
+            ):
+                self._step(self.limit + 1, "probe")
+            else:
+                self._hold = max(0, self._hold - 1)
+                self._last_step = 0
+            self._last_throughput = throughput
+
+        self._window_start = now
+        self._window_completed = self._completed
+        self._window_pressure = pressure
+        return self.limit
+
+    def _step(self, limit: int, reason: str) -> None:
+        limit = min(max(1, limit), self.ceiling)
+        self._last_step = limit - self.limit
+        if self._last_step < 0 and reason != "throughput_drop":
+            # Throughput of a window cut short by pressure is not comparable
+            self._last_throughput = None
+        self.limit = limit
+        self.min_limit = min(self.min_limit, limit)
+        self.max_limit = max(self.max_limit, limit)
+        self.decisions[reason] = self.decisions.get(reason, 0) + 1
+
+    def summary(self) -> Dict[str, Any]:
+        """
+        Describe how the limit moved during the run.
+
+        Returns:
+            Dict[str, Any]: Initial, final, lowest and highest limit, the
+            ceiling, decision counts by reason, the largest peak RSS and
+            the stall shares of the last window
+        """
+        return {
+            "initial": self.initial,
+            "final": self.limit,
+            "min": self.min_limit,
+            "max": self.max_limit,
+            "ceiling": self.ceiling,
+            "decisions": dict(self.decisions),
+            "peak_rss_mb": self.peak_rss_mb,
+            "last_stalls": dict(self.last_stalls),
+        }
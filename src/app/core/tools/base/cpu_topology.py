@@ -0,0 +1,258 @@
+"""
+CPU topology and per-test core placement of benchmark runs.
+
+Concurrent tests scheduled freely by the kernel share SMT siblings (two
+hardware threads competing for one core's execution units and caches) and
+migrate across NUMA nodes, away from the memory they allocated, which
+skews memory-bound solutions by 30% and more. read_topology() discovers
+the physical cores and NUMA nodes from sysfs (/sys/devices/system/cpu and
+/sys/devices/system/node), limited to the CPUs this process may run on.
+
+CorePool hands out one physical core per running test: the test's
+processes are pinned to the core's first hardware thread, its siblings
+stay idle, and on machines with several nodes their memory is bound to
+the core's node. Cores are ordered round-robin across nodes so a partly
+filled pool spreads over the memory controllers; on machines with more
+than two cores the core of CPU 0 is left to the harness and the kernel.
+
+Pinning is applied by the launch trampoline of process_limits
+(CTS_CPU_LIST and CTS_MEMBIND_NODE in its environment); without the
+trampoline, processes are pinned right after they start and memory is not
+bound.
+
+Linux only; elsewhere no topology is available.
+"""
+
+import os
+import sys
+import threading
+from dataclasses import dataclass, field
+from typing import Any, Dict, List, Optional, Set, Tuple
+
+SYSFS_ROOT = "/sys/devices/system"
+
+# Read (and removed) by resources/native/rlimit_exec.cpp
+CPU_LIST_ENV = "CTS_CPU_LIST"
+MEMBIND_NODE_ENV = "CTS_MEMBIND_NODE"
+
+
+@dataclass(frozen=True)
+class PhysicalCore:
+    """A physical core: its hardware threads, socket and NUMA node."""
+
+    package: int
+    core: int
+    node: int
+    cpus: Tuple[int, ...]
+
+
+@dataclass
+class CpuTopology:
+    """Physical cores of the CPUs available to this process."""
+
+    cores: List[PhysicalCore] = field(default_factory=list)
+
+    @property
+    def nodes(self) -> List[int]:
+        return sorted({core.node for core in self.cores})
+
+    @property
+    def packages(self) -> List[int]:
+        return sorted({core.package for core in self.cores})
+
+    @property
+    def logical_cpus(self) -> int:
+        return sum(len(core.cpus) for core in self.cores)
+
+    def to_dict(self) -> Dict[str, Any]:
+        return {
+            "packages": len(self.packages),
+            "nodes": len(self.nodes),
+            "physical_cores": len(self.cores),
+            "logical_cpus": self.logical_cpus,
+            "smt": any(len(core.cpus) > 1 for core in self.cores),
+        }
+
+
+@dataclass(frozen=True)
+class CoreSlot:
+    """Placement of one test: the CPUs its processes run on and its memory node."""
+
+    cpus: Tuple[int, ...]
+    node: Optional[int]
+
+    def to_dict(self) -> Dict[str, Any]:
+        return {"cpus": list(self.cpus), "node": self.node}
+
+
+def topology_supported() -> bool:
+    """Check whether the platform exposes the topology and CPU affinity."""
+    return sys.platform.startswith("linux") and hasattr(os, "sched_getaffinity")
+
+
+def parse_cpu_list(text: str) -> Set[int]:
+    """Parse a sysfs CPU list ('0-3,8,10-11')."""
+    cpus: Set[int] = set()
+    for part in text.strip().split(","):
+        if not part:
+            continue
+        if "-" in part:
+            start, end = part.split("-", 1)
+            cpus.update(range(int(start), int(end) + 1))
+        else:
+            cpus.add(int(part))
+    return cpus
+
+
+def _read(path: str) -> Optional[str]:
+    try:
+        with open(path, encoding="ascii") as f:
+            return f.read().strip()
+    except OSError:
+        return None
+
+
+def read_topology(root: str = SYSFS_ROOT, allowed: Optional[Set[int]] = None) -> Optional[CpuTopology]:
+    """
+    Discover the physical cores available to this process.
+
+    Args:
+        root: sysfs system directory
+        allowed: CPUs to consider (default: this process's affinity mask)
+
+    Returns:
+        Optional[CpuTopology]: Cores sorted by package and core ID, None if
+        the topology cannot be read
+    """
+    if allowed is None:
+        if not topology_supported():
+            return None
+        allowed = set(os.sched_getaffinity(0))
+
+    node_of: Dict[int, int] = {}
+    node_dir = os.path.join(root, "node")
+    try:
+        node_names = [n for n in os.listdir(node_dir) if n.startswith("node") and n[4:].isdigit()]
+    except OSError:
+        node_names = []
+    for name in node_names:
+        cpulist = _read(os.path.join(node_dir, name, "cpulist"))
+        if cpulist:
+            for cpu in parse_cpu_list(cpulist):
+                node_of[cpu] = int(name[4:])
+
+    cores: Dict[Tuple[int, int], Set[int]] = {}
+    for cpu in sorted(allowed):
+        topology_dir = os.path.join(root, "cpu", f"cpu{cpu}", "topology")
+        package = _read(os.path.join(topology_dir, "physical_package_id"))
+        core = _read(os.path.join(topology_dir, "core_id"))
+        if package is None or core is None:
+            return None
+        try:
+            key = (int(package), int(core))
+        except ValueError:
+            return None
+        cores.setdefault(key, set()).add(cpu)
+
+    if not cores:
+        return None
+    return CpuTopology(
+        [
+            PhysicalCore(package, core, node_of.get(min(cpus), 0), tuple(sorted(cpus)))
+            for (package, core), cpus in sorted(cores.items())
+        ]
+    )
+
+
+def placement_slots(topology: CpuTopology) -> List[CoreSlot]:
+    """
+    Get one slot per physical core, in the order tests should take them.
+
+    Args:
+        topology: Result of read_topology()
+
+    Returns:
+        List[CoreSlot]: Slots on the first hardware thread of each core,
+        interleaved across nodes; memory is bound only with several nodes
+    """
+    cores = list(topology.cores)
+    if len(cores) > 2:
+        cores = [core for core in cores if 0 not in core.cpus] or cores
+
+    bind_memory = len(topology.nodes) > 1
+    by_node: Dict[int, List[PhysicalCore]] = {}
+    for core in cores:
+        by_node.setdefault(core.node, []).append(core)
+
+    slots = []
+    queues = [by_node[node] for node in sorted(by_node)]
+    while any(queues):
+        for queue in queues:
+            if queue:
+                core = queue.pop(0)
+                slots.append(CoreSlot((core.cpus[0],), core.node if bind_memory else None))
+    return slots
+
+
+def placement_environment(slot: CoreSlot, base_env: Optional[Dict[str, str]] = None) -> Dict[str, str]:
+    """
+    Get the environment that makes the launch trampoline apply a slot.
+
+    Args:
+        slot: Placement of the test
+        base_env: Environment to extend (default: os.environ)
+    """
+    env = dict(os.environ if base_env is None else base_env)
+    env[CPU_LIST_ENV] = ",".join(str(cpu) for cpu in slot.cpus)
+    if slot.node is not None:
+        env[MEMBIND_NODE_ENV] = str(slot.node)
+    return env
+
+
+class CorePool:
+    """Thread-safe pool of core slots; every running test holds one."""
+
+    def __init__(self, topology: CpuTopology, slots: Optional[List[CoreSlot]] = None):
+        self.topology = topology
+        self.slots = slots if slots is not None else placement_slots(topology)
+        self._free = list(self.slots)
+        self._condition = threading.Condition()
+
+    def __len__(self) -> int:
+        return len(self.slots)
+
+    def acquire(self) -> CoreSlot:
+        """Take the first free slot, waiting until one is released."""
+        with self._condition:
+            while not self._free:
+                self._condition.wait()
+            return self._free.pop(0)
+
+    def release(self, slot: CoreSlot) -> None:
+        """Return a slot; it keeps its place in the preferred order."""
+        with self._condition:
+            self._free.append(slot)
+            self._free.sort(key=self.slots.index)
+            self._condition.notify()
+
+    def to_dict(self) -> Dict[str, Any]:
+        """Describe the topology and the slots tests were placed on."""
+        return {
+            **self.topology.to_dict(),
+            "slots": [slot.to_dict() for slot in self.slots],
+            "memory_binding": any(slot.node is not None for slot in self.slots),
+        }
+
+
+def create_core_pool() -> Optional[CorePool]:
+    """
+    Create a pool over the cores available to this process.
+
+    Returns:
+        Optional[CorePool]: None without topology information
+    """
+    topology = read_topology()
+    if topology is None:
+        return None
+    pool = CorePool(topology)
+    return pool if len(pool) else None
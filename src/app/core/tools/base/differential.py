@@ -0,0 +1,153 @@
+"""
+Differential runs of one C++ solution built under several flag profiles.
+
+Undefined behaviour (signed overflow, uninitialized reads, out-of-bounds
+accesses) often only shows when the optimizer changes: a solution that
+passes at -O2 prints something else at -O0 or crashes under clang++. The
+same builds also show how sensitive the solution's speed is to the
+optimization level and to -march=native, the default in CppCompiler.
+
+Each profile is a set of language config overrides (compiler,
+optimization, flags, extra_flags) registered as a build variant of the
+test solution, so it is compiled in the regular parallel pass and cached
+by timestamp like every other executable. The variant name carries a
+digest of the overrides, so editing a profile never reuses a stale binary.
+
+All builds run on the same generated inputs through the tournament worker;
+the analysis compares every profile with the regular build: output
+mismatches, crashes only one of them has, changed verdicts (a build that
+hangs where the other finishes) and the paired speed ratio with its
+significance.
+
+Profiles come from config["benchmarker"]["differential_profiles"]
+(name -> overrides); profiles naming a compiler that is not installed are
+skipped.
+"""
+
+import hashlib
+import json
+import re
+import shutil
+import statistics
+from typing import Any, Dict, List, Optional
+
+from src.app.core.tools.base.tournament import (
+    SIGNIFICANCE_LEVEL,
+    is_timed,
+    wilcoxon_signed_rank,
+)
+
+# Compared against the regular build (the 'test' key)
+DEFAULT_PROFILES: Dict[str, Dict[str, Any]] = {
+    "O0": {"optimization": "O0"},
+    "O3": {"optimization": "O3"},
+    "no-march": {"flags": ["-pipe", "-Wall"]},
+    "clang": {"compiler": "clang++"},
+}
+
+# Key of the build every profile is compared with
+BASELINE_KEY = "test"
+
+
+def profile_variant(name: str, overrides: Dict[str, Any], prefix: str = "diff") -> str:
+    """
+    Build variant name of a profile (also the executable suffix).
+
+    Args:
+        name: Profile name
+        overrides: Language config overrides of the profile
+        prefix: Mode the variant is built for
+
+    Returns:
+        str: '<prefix>_<name>_<digest>' with the name reduced to file-name characters
+    """
+    digest = hashlib.blake2b(
+        json.dumps(overrides, sort_keys=True).encode("utf-8"), digest_size=4
+    ).hexdigest()
+    safe_name = re.sub(r"[^A-Za-z0-9_-]", "_", name)
+    return f"{prefix}_{safe_name}_{digest}"
+
+
+def available_profiles(profiles: Dict[str, Dict[str, Any]]) -> Dict[str, Dict[str, Any]]:
+    """Profiles whose compiler (if overridden) is installed."""
+    return {
+        name: overrides
+        for name, overrides in profiles.items()
+        if "compiler" not in overrides or shutil.which(overrides["compiler"]) is not None
+    }
+
+
+def summarize_differential(
+    results: List[Dict[str, Any]], profiles: Dict[str, str]
+) -> Optional[Dict[str, Any]]:
+    """
+    Compare every profile build with the regular build.
+
+    Args:
+        results: Test results carrying a 'tournament' entry per build key
+        profiles: Variant key -> profile name
+
+    Returns:
+        Optional[Dict[str, Any]]: Per profile: tests compared, output
+        mismatches, tests only one build crashed on, verdict changes, the
+        median time ratio to the regular build and its significance; None
+        without differential results
+    """
+    runs = [
+        r for r in results
+        if isinstance(r.get("tournament"), dict) and BASELINE_KEY in r["tournament"]
+    ]
+    if not runs or not profiles:
+        return None
+
+    summary: Dict[str, Any] = {"significance_level": SIGNIFICANCE_LEVEL, "profiles": {}}
+    for key, name in profiles.items():
+        numbered = [
+            (r["tournament"][BASELINE_KEY], r["tournament"][key], r.get("test_number"))
+            for r in runs
+            if key in r["tournament"]
+        ]
+
+        mismatches = [
+            number for baseline, entry, number in numbered
+            if baseline.get("passed") and entry.get("passed")
+            and baseline.get("output_hash") != entry.get("output_hash")
+        ]
+        # Either build crashed where the other did not
+        crashes = [
+            number for baseline, entry, number in numbered
+            if is_timed(baseline) != is_timed(entry)
+        ]
+        # A build that hangs where the other finishes shows up here
+        verdict_changes = [
+            {
+                "test_number": number,
+                "regular": baseline.get("error_details"),
+                "profile": entry.get("error_details"),
+            }
+            for baseline, entry, number in numbered
+            if bool(baseline.get("passed")) != bool(entry.get("passed"))
+        ]
+        timed = [(b, e) for b, e, _ in numbered if is_timed(b) and is_timed(e)]
+        baseline_times = [b["execution_time"] for b, _ in timed]
+        profile_times = [e["execution_time"] for _, e in timed]
+        ratios = [p / b for b, p in zip(baseline_times, profile_times) if b > 0]
+        time_test = wilcoxon_signed_rank(profile_times, baseline_times)
+
+        summary["profiles"][name] = {
+            "key": key,
+            "tests": len(numbered),
+            "compared_tests": len(timed),
+            "output_mismatches": sorted(mismatches),
+            "crashes": sorted(crashes),
+            "verdict_changes": sorted(verdict_changes, key=lambda change: change["test_number"]),
+            "suspected_undefined_behavior": bool(mismatches or crashes),
+            "median_time_ratio": statistics.median(ratios) if ratios else None,
+            "time_p_value": time_test["p_value"],
+            "time_significant": time_test["p_value"] < SIGNIFICANCE_LEVEL,
+        }
+
+    summary["suspected_undefined_behavior"] = any(
+        p["suspected_undefined_behavior"] for p in summary["profiles"].values()
+    )
+    return summary
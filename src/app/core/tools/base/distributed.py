@@ -0,0 +1,420 @@
+"""
+Broker of distributed stress runs.
+
+A single workstation caps a stress session at its core count. The broker
+shards a run across worker agents (distributed_agent.py) on other machines
+or in local containers: agents connect to it, receive the generator, test
+and correct solution files once, and are handed jobs of consecutive test
+numbers until the run is complete.
+
+Partitioning is deterministic: the run is cut into fixed chunks of test
+numbers (shard_ranges()), and test N always gets the generator seed
+derive_test_seed(run_seed, N), whichever agent runs it. Chunks are handed
+out on demand, so faster machines take more of them; the tests of a chunk
+whose agent disconnects are handed out again (records already received
+are kept).
+
+Agents send compact verdict records (see distributed_agent.py), which
+records() yields as they arrive. Only native executables and scripts whose
+interpreter exists on the agents can be shipped; a role's command must
+contain its file as an argument.
+
+The broker listens on localhost (or a Unix socket) unless given another
+address; agents execute whatever it sends, so expose it only to trusted
+machines and set a token.
+"""
+
+import hashlib
+import hmac
+import logging
+import os
+import queue
+import socket
+import subprocess
+import sys
+import threading
+import time
+from collections import deque
+from typing import Any, Dict, Iterator, List, Optional, Tuple
+
+from src.app.core.tools.base import distributed_agent
+from src.app.core.tools.base.distributed_agent import (
+    DEFAULT_TIMEOUT,
+    PROTOCOL_VERSION,
+    recv_frame,
+    send_frame,
+)
+
+logger = logging.getLogger(__name__)
+
+AGENT_SCRIPT = os.path.abspath(distributed_agent.__file__)
+
+DEFAULT_ADDRESS = "127.0.0.1:0"
+
+# Tests per job: large enough to amortize a round trip, small enough that
+# a run spreads over every agent and a lost agent costs little
+MAX_CHUNK_TESTS = 1000
+MIN_CHUNKS = 64
+
+# Roles every distributed run executes
+ROLES = ("generator", "test", "correct")
+
+Record = Tuple[str, List[Any]]
+
+
+def shard_ranges(test_count: int, chunk_tests: Optional[int] = None) -> List[Tuple[int, int]]:
+    """
+    Cut tests 1..test_count into consecutive chunks.
+
+    Args:
+        test_count: Tests of the run
+        chunk_tests: Tests per chunk (default: test_count / MIN_CHUNKS,
+                     capped at MAX_CHUNK_TESTS)
+
+    Returns:
+        List[Tuple[int, int]]: Inclusive (first, last) test numbers
+    """
+    if chunk_tests is None:
+        chunk_tests = min(MAX_CHUNK_TESTS, -(-test_count // MIN_CHUNKS))
+    chunk_tests = max(1, chunk_tests)
+    return [
+        (first, min(first + chunk_tests - 1, test_count))
+        for first in range(1, test_count + 1, chunk_tests)
+    ]
+
+
+def missing_ranges(first: int, last: int, received: set) -> List[Tuple[int, int]]:
+    """Get the consecutive ranges of first..last not in received."""
+    ranges = []
+    start = None
+    for number in range(first, last + 2):
+        missing = number <= last and number not in received
+        if missing and start is None:
+            start = number
+        elif not missing and start is not None:
+            ranges.append((start, number - 1))
+            start = None
+    return ranges
+
+
+def shipped_command(command: List[str]) -> Tuple[List[str], str, str]:
+    """
+    Replace the file of an execution command by its placeholder.
+
+    The last argument naming an existing file is shipped (the executable,
+    or the script after its interpreter).
+
+    Returns:
+        Tuple[List[str], str, str]: Command with '{file:<sha256>}', the
+        SHA-256 and the path of the file
+
+    Raises:
+        ValueError: If the command contains no file to ship
+    """
+    for index in range(len(command) - 1, -1, -1):
+        if os.path.isfile(command[index]):
+            path = command[index]
+            with open(path, "rb") as f:
+                digest = hashlib.sha256(f.read()).hexdigest()
+            return command[:index] + [f"{{file:{digest}}}"] + command[index + 1:], digest, path
+    raise ValueError(f"No file to ship in command: {command}")
+
+
+def parse_address(address: str) -> Tuple[int, Any]:
+    """Get the socket family and address of 'unix:PATH' or 'HOST:PORT'."""
+    if address.startswith("unix:"):
+        return socket.AF_UNIX, address[5:]
+    host, _, port = address.rpartition(":")
+    return socket.AF_INET6 if ":" in host.strip("[]") else socket.AF_INET, (host.strip("[]"), int(port))
+
+
+class Broker:
+    """
+    Hands out the chunks of one run to connected agents and collects verdicts.
+
+    Usage: start(), spawn or point agents at the returned address, iterate
+    records() until it ends, then summary().
+    """
+
+    def __init__(
+        self,
+        execution_commands: Dict[str, List[str]],
+        run_seed: int,
+        test_count: int,
+        address: str = DEFAULT_ADDRESS,
+        chunk_tests: Optional[int] = None,
+        timeout: float = DEFAULT_TIMEOUT,
+        token: str = "",
+    ):
+        """
+        Args:
+            execution_commands: Commands of the generator, test and correct roles
+            run_seed: Seed of the run (test N uses derive_test_seed(run_seed, N))
+            test_count: Tests of the run
+            address: Listening address ('HOST:PORT', port 0 picks one, or 'unix:PATH')
+            chunk_tests: Tests per job (see shard_ranges())
+            timeout: Seconds each process of a test may run
+            token: Token agents must present (empty: none)
+
+        Raises:
+            ValueError: If a role's command cannot be shipped
+        """
+        self.run_seed = run_seed
+        self.test_count = test_count
+        self.timeout = timeout
+        self.token = token
+        self.address = address
+
+        self.commands: Dict[str, List[str]] = {}
+        self.files: Dict[str, str] = {}
+        for role in ROLES:
+            command, digest, path = shipped_command(list(execution_commands[role]))
+            self.commands[role] = command
+            self.files[digest] = path
+
+        self._chunks = deque(shard_ranges(test_count, chunk_tests))
+        self._received: set = set()
+        self._lock = threading.Condition()
+        self._records: "queue.Queue[Optional[Record]]" = queue.Queue()
+        self._stopped = False
+        self._server: Optional[socket.socket] = None
+        self._connections: List[socket.socket] = []
+        self._next_job = 0
+        self.agents: Dict[str, Dict[str, Any]] = {}
+        self.requeued_tests = 0
+        self.started_at: Optional[float] = None
+        self.finished_at: Optional[float] = None
+
+    def start(self) -> str:
+        """
+        Start listening for agents.
+
+        Returns:
+            str: Address agents connect to (with the chosen port)
+        """
+        family, bind_address = parse_address(self.address)
+        if family == socket.AF_UNIX:
+            if os.path.exists(bind_address):
+                os.remove(bind_address)
+            server = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+            server.bind(bind_address)
+            server.listen()
+            address = self.address
+        else:
+            server = socket.create_server(bind_address, family=family)
+            host, port = server.getsockname()[:2]
+            address = f"[{host}]:{port}" if family == socket.AF_INET6 else f"{host}:{port}"
+        self._server = server
+        self.started_at = time.monotonic()
+        threading.Thread(target=self._accept_loop, name="broker-accept", daemon=True).start()
+        if self.test_count <= 0:
+            self._finish()
+        return address
+
+    def records(self) -> Iterator[Record]:
+        """Yield (agent name, verdict record) until the run is complete or stopped."""
+        while True:
+            item = self._records.get()
+            if item is None:
+                return
+            yield item
+
+    def stop(self) -> None:
+        """Stop the run: agents are told to stop, records() ends."""
+        self._finish()
+
+    @property
+    def completed_tests(self) -> int:
+        with self._lock:
+            return len(self._received)
+
+    def summary(self) -> Dict[str, Any]:
+        """
+        Describe the run.
+
+        Returns:
+            Dict[str, Any]: Tests completed, chunks handed out again, wall
+            time, tests per second, and per agent its slots, platform,
+            completed tests, failures and jobs
+        """
+        end = self.finished_at or time.monotonic()
+        elapsed = end - self.started_at if self.started_at else 0.0
+        completed = self.completed_tests
+        return {
+            "test_count": self.test_count,
+            "completed_tests": completed,
+            "requeued_tests": self.requeued_tests,
+            "wall_time": elapsed,
+            "tests_per_second": completed / elapsed if elapsed > 0 else None,
+            "agents": {name: dict(agent) for name, agent in self.agents.items()},
+        }
+
+    def _finish(self) -> None:
+        with self._lock:
+            if self._stopped:
+                return
+            self._stopped = True
+            self.finished_at = time.monotonic()
+            self._lock.notify_all()
+            connections = list(self._connections)
+        for conn in connections:
+            try:
+                send_frame(conn, {"type": "stop"})
+            except OSError:
+                pass
+        if self._server is not None:
+            try:
+                self._server.close()
+            except OSError:
+                pass
+            if self.address.startswith("unix:") and os.path.exists(self.address[5:]):
+                os.remove(self.address[5:])
+        self._records.put(None)
+
+    def _accept_loop(self) -> None:
+        while not self._stopped:
+            try:
+                conn, _ = self._server.accept()
+            except OSError:
+                return
+            threading.Thread(target=self._serve_agent, args=(conn,), daemon=True).start()
+
+    def _take_chunk(self) -> Optional[Tuple[int, int]]:
+        """Wait for a chunk to hand out; None once the run is over."""
+        with self._lock:
+            while not self._chunks and not self._stopped:
+                self._lock.wait()
+            if self._stopped:
+                return None
+            return self._chunks.popleft()
+
+    def _serve_agent(self, conn: socket.socket) -> None:
+        name = None
+        chunk = None
+        received: set = set()
+        try:
+            hello, _ = recv_frame(conn)
+            if hello.get("type") != "hello" or hello.get("protocol") != PROTOCOL_VERSION:
+                logger.warning("Rejected agent with an unknown protocol")
+                return
+            # Constant-time comparison: the token gates running shipped binaries
+            token = str(hello.get("token", "")).encode("utf-8")
+            if self.token and not hmac.compare_digest(token, self.token.encode("utf-8")):
+                logger.warning(f"Rejected agent {hello.get('name')}: bad token")
+                return
+
+            with self._lock:
+                name = str(hello.get("name") or "agent")
+                if name in self.agents:
+                    name = f"{name}#{len(self.agents)}"
+                self.agents[name] = {
+                    "slots": hello.get("slots"),
+                    "platform": hello.get("platform"),
+                    "machine": hello.get("machine"),
+                    "tests": 0,
+                    "failures": 0,
+                    "jobs": 0,
+                    "connected": True,
+                }
+                self._connections.append(conn)
+
+            for digest, path in self.files.items():
+                with open(path, "rb") as f:
+                    send_frame(conn, {"type": "file", "sha256": digest}, f.read())
+
+            while True:
+                chunk = self._take_chunk()
+                if chunk is None:
+                    # The run ended; agents that said hello after stop() was
+                    # sent to the others are told here
+                    send_frame(conn, {"type": "stop"})
+                    return
+                with self._lock:
+                    self._next_job += 1
+                    job_id = self._next_job
+                received = set()
+                send_frame(conn, {
+                    "type": "job",
+                    "job": job_id,
+                    "run_seed": self.run_seed,
+                    "tests": list(chunk),
+                    "commands": self.commands,
+                    "timeout": self.timeout,
+                })
+                while True:
+                    header, _ = recv_frame(conn)
+                    if header.get("type") == "records" and header.get("job") == job_id:
+                        for record in header.get("records", []):
+                            received.add(record[0])
+                            self._accept_record(name, record)
+                    elif header.get("type") == "done" and header.get("job") == job_id:
+                        break
+                with self._lock:
+                    self.agents[name]["jobs"] += 1
+                missing = missing_ranges(chunk[0], chunk[1], received)
+                chunk = None
+                if missing:
+                    self._requeue(missing)
+        except (OSError, ConnectionError, ValueError) as e:
+            if not self._stopped:
+                logger.warning(f"Agent {name or 'unknown'} disconnected: {e}")
+        finally:
+            if chunk is not None:
+                self._requeue(missing_ranges(chunk[0], chunk[1], received))
+            with self._lock:
+                if conn in self._connections:
+                    self._connections.remove(conn)
+                if name in self.agents:
+                    self.agents[name]["connected"] = False
+            conn.close()
+
+    def _accept_record(self, name: str, record: List[Any]) -> None:
+        with self._lock:
+            if record[0] in self._received or self._stopped:
+                return
+            self._received.add(record[0])
+            agent = self.agents[name]
+            agent["tests"] += 1
+            if record[1] != "OK":
+                agent["failures"] += 1
+            complete = len(self._received) >= self.test_count
+        self._records.put((name, record))
+        if complete:
+            self._finish()
+
+    def _requeue(self, ranges: List[Tuple[int, int]]) -> None:
+        with self._lock:
+            if self._stopped or not ranges:
+                return
+            for first, last in reversed(ranges):
+                self._chunks.appendleft((first, last))
+                self.requeued_tests += last - first + 1
+            self._lock.notify_all()
+
+
+def spawn_local_agents(
+    address: str, count: int, slots: Optional[int] = None, token: str = ""
+) -> List[subprocess.Popen]:
+    """
+    Start agents on this machine (for testing the protocol, or to run
+    several containers' worth of agents locally).
+
+    Args:
+        address: Address returned by Broker.start()
+        count: Number of agents
+        slots: Tests per agent in parallel (default: the agent's CPU count)
+        token: Token of the broker
+
+    Returns:
+        List[subprocess.Popen]: Agent processes; they exit when the run ends
+    """
+    processes = []
+    for index in range(count):
+        command = [sys.executable, AGENT_SCRIPT, "--connect", address, "--name", f"local-{index + 1}"]
+        if slots:
+            command += ["--slots", str(slots)]
+        env = dict(os.environ)
+        if token:
+            env["CTS_AGENT_TOKEN"] = token
+        processes.append(subprocess.Popen(command, stdin=subprocess.DEVNULL, env=env))
+    return processes
@@ -0,0 +1,326 @@
+"""
+Worker agent for distributed stress runs.
+
+This script runs on the machines (or containers) that execute tests for a
+broker in the app (see distributed.py) and must only use the standard
+library, so it can be copied to a machine without the app:
+
+    python3 distributed_agent.py --connect HOST:PORT|unix:PATH
+                                 [--slots N] [--name NAME] [--token TOKEN]
+                                 [--workdir DIR]
+
+The agent dials the broker, receives the generator/test/correct files once
+(cached by SHA-256 in the work directory), then runs jobs of consecutive
+test numbers with N tests in parallel. Test N of a run always gets the
+generator seed derive_test_seed(run_seed, N), as in a local run, so any
+test can be replayed locally from its number. Verdicts stream back in
+batches of compact records; only failing tests carry excerpts of their
+input and outputs.
+
+Frames (both directions): 4-byte little-endian header length, UTF-8 JSON
+header; a header with "size" is followed by that many raw bytes.
+
+    agent -> broker: {"type": "hello", "protocol", "name", "slots",
+                      "platform", "machine", "token"}
+    broker -> agent: {"type": "file", "sha256", "size"} + bytes
+                     {"type": "job", "job", "run_seed", "tests": [first, last],
+                      "commands": {role: [...]}, "timeout"}
+                     {"type": "stop"}
+    agent -> broker: {"type": "records", "job", "records": [...]}
+                     {"type": "done", "job"}
+
+In commands, "{file:<sha256>}" stands for the path of a received file.
+A record is [test, verdict, generator_ms, test_ms, correct_ms] with
+verdict OK (outputs match), WA, RE (test solution failed), TLE (a process
+exceeded the timeout), GEN (generator failed) or CRE (correct solution
+failed); non-OK records append {"error", "input", "test_output",
+"correct_output"}.
+
+The agent executes whatever the broker sends: connect it only to brokers
+you trust (the broker listens on localhost unless told otherwise, and a
+shared token can be required).
+"""
+
+import argparse
+import hashlib
+import json
+import os
+import platform
+import socket
+import stat
+import struct
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+from concurrent.futures import FIRST_COMPLETED, ThreadPoolExecutor, wait
+
+PROTOCOL_VERSION = 1
+
+SEED_ENV_VAR = "CTS_SEED"
+
+# Seconds a generator/solution may run, unless the job says otherwise
+DEFAULT_TIMEOUT = 30.0
+
+# Records are sent once this many are pending or FLUSH_INTERVAL passed
+FLUSH_RECORDS = 512
+FLUSH_INTERVAL = 0.25
+
+# Characters of input/output excerpts in failing records
+EXCERPT_CHARS = 300
+
+_HEADER = struct.Struct("<I")
+_MASK64 = (1 << 64) - 1
+_GOLDEN_GAMMA = 0x9E3779B97F4A7C15
+
+
+def derive_test_seed(run_seed, test_number):
+    """Seed of a test; must match seeds.derive_test_seed() of the app."""
+    z = ((run_seed + test_number * _GOLDEN_GAMMA) + _GOLDEN_GAMMA) & _MASK64
+    z = ((z ^ (z >> 30)) * 0xBF58476D1CE4E5B9) & _MASK64
+    z = ((z ^ (z >> 27)) * 0x94D049BB133111EB) & _MASK64
+    return z ^ (z >> 31)
+
+
+def send_frame(sock, header, payload=b""):
+    """Send one frame; a payload sets the header's size."""
+    if payload:
+        header = dict(header, size=len(payload))
+    data = json.dumps(header, separators=(",", ":")).encode("utf-8")
+    sock.sendall(_HEADER.pack(len(data)) + data + payload)
+
+
+def _recv_exact(sock, size):
+    chunks = []
+    while size:
+        chunk = sock.recv(min(size, 1 << 20))
+        if not chunk:
+            raise ConnectionError("connection closed")
+        chunks.append(chunk)
+        size -= len(chunk)
+    return b"".join(chunks)
+
+
+def recv_frame(sock):
+    """
+    Receive one frame.
+
+    Returns:
+        (header, payload): payload is b"" for frames without a size
+    """
+    (length,) = _HEADER.unpack(_recv_exact(sock, _HEADER.size))
+    header = json.loads(_recv_exact(sock, length).decode("utf-8"))
+    size = header.get("size", 0)
+    return header, (_recv_exact(sock, size) if size else b"")
+
+
+def connect(address, timeout=None):
+    """Connect to 'unix:PATH' or 'HOST:PORT'."""
+    if address.startswith("unix:"):
+        sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        sock.settimeout(timeout)
+        sock.connect(address[5:])
+        sock.settimeout(None)
+        return sock
+    host, _, port = address.rpartition(":")
+    sock = socket.create_connection((host.strip("[]") or "127.0.0.1", int(port)), timeout=timeout)
+    sock.settimeout(None)
+    return sock
+
+
+def _excerpt(text):
+    text = text.strip()
+    return text[:EXCERPT_CHARS] + ("..." if len(text) > EXCERPT_CHARS else "")
+
+
+def _run(command, stdin_text, env, timeout):
+    """Run a process; returns (returncode or None on timeout, stdout, stderr, ms)."""
+    start = time.perf_counter()
+    try:
+        completed = subprocess.run(
+            command,
+            input=stdin_text,
+            stdout=subprocess.PIPE,
+            stderr=subprocess.PIPE,
+            text=True,
+            env=env,
+            timeout=timeout,
+        )
+    except subprocess.TimeoutExpired:
+        return None, "", "", (time.perf_counter() - start) * 1000
+    return completed.returncode, completed.stdout, completed.stderr, (time.perf_counter() - start) * 1000
+
+
+def run_test(commands, run_seed, test_number, timeout=DEFAULT_TIMEOUT):
+    """
+    Run one test: generator, then test and correct solution on its output.
+
+    Returns:
+        list: Verdict record of the test
+    """
+    env = dict(os.environ)
+    env[SEED_ENV_VAR] = str(derive_test_seed(run_seed, test_number))
+    times = [0.0, 0.0, 0.0]
+
+    def failed(verdict, error, input_text="", test_output="", correct_output=""):
+        return [test_number, verdict] + [round(t, 3) for t in times] + [{
+            "error": error,
+            "input": _excerpt(input_text),
+            "test_output": _excerpt(test_output),
+            "correct_output": _excerpt(correct_output),
+        }]
+
+    try:
+        code, input_text, stderr, times[0] = _run(commands["generator"], "", env, timeout)
+        if code is None:
+            return failed("TLE", f"Generator timeout (>{timeout:g}s)")
+        if code != 0:
+            return failed("GEN", f"Generator failed: {stderr.strip()[:EXCERPT_CHARS]}")
+
+        code, test_output, stderr, times[1] = _run(commands["test"], input_text, None, timeout)
+        if code is None:
+            return failed("TLE", f"Test solution timeout (>{timeout:g}s)", input_text)
+        if code != 0:
+            return failed("RE", f"Test solution failed: {stderr.strip()[:EXCERPT_CHARS]}", input_text, test_output)
+
+        code, correct_output, stderr, times[2] = _run(commands["correct"], input_text, None, timeout)
+        if code is None:
+            return failed("TLE", f"Correct solution timeout (>{timeout:g}s)", input_text, test_output)
+        if code != 0:
+            return failed(
+                "CRE", f"Correct solution failed: {stderr.strip()[:EXCERPT_CHARS]}", input_text, test_output
+            )
+    except OSError as e:
+        return failed("RE", f"Execution error: {e}")
+
+    if test_output.strip() != correct_output.strip():
+        return failed("WA", "Output mismatch", input_text, test_output, correct_output)
+    return [test_number, "OK"] + [round(t, 3) for t in times]
+
+
+class Agent:
+    """Connection to one broker, running its jobs until told to stop."""
+
+    def __init__(self, sock, slots, workdir):
+        self.sock = sock
+        self.slots = max(1, slots)
+        self.workdir = workdir
+        self.files = {}
+        self._send_lock = threading.Lock()
+
+    def send(self, header, payload=b""):
+        with self._send_lock:
+            send_frame(self.sock, header, payload)
+
+    def store_file(self, header, payload):
+        digest = hashlib.sha256(payload).hexdigest()
+        if digest != header.get("sha256"):
+            raise ValueError("file checksum mismatch")
+        path = os.path.join(self.workdir, digest)
+        if not os.path.exists(path):
+            partial = path + ".part"
+            with open(partial, "wb") as f:
+                f.write(payload)
+            os.chmod(partial, os.stat(partial).st_mode | stat.S_IXUSR | stat.S_IRUSR)
+            os.replace(partial, path)
+        self.files[digest] = path
+
+    def resolve(self, command):
+        resolved = []
+        for part in command:
+            if part.startswith("{file:") and part.endswith("}"):
+                resolved.append(self.files[part[6:-1]])
+            else:
+                resolved.append(part)
+        return resolved
+
+    def run_job(self, job):
+        commands = {role: self.resolve(command) for role, command in job["commands"].items()}
+        first, last = job["tests"]
+        timeout = job.get("timeout", DEFAULT_TIMEOUT)
+        pending = []
+        last_flush = time.monotonic()
+
+        def flush():
+            nonlocal last_flush
+            if pending:
+                self.send({"type": "records", "job": job["job"], "records": pending[:]})
+                del pending[:]
+            last_flush = time.monotonic()
+
+        with ThreadPoolExecutor(max_workers=self.slots) as executor:
+            # Submitted as slots free up, so a huge range never queues
+            # millions of futures
+            numbers = iter(range(first, last + 1))
+            running = set()
+
+            def submit_next():
+                number = next(numbers, None)
+                if number is not None:
+                    running.add(executor.submit(run_test, commands, job["run_seed"], number, timeout))
+
+            for _ in range(self.slots):
+                submit_next()
+            while running:
+                done, _ = wait(running, timeout=FLUSH_INTERVAL, return_when=FIRST_COMPLETED)
+                for future in done:
+                    running.discard(future)
+                    pending.append(future.result())
+                    submit_next()
+                if len(pending) >= FLUSH_RECORDS or time.monotonic() - last_flush >= FLUSH_INTERVAL:
+                    flush()
+        flush()
+        self.send({"type": "done", "job": job["job"]})
+
+    def serve(self):
+        while True:
+            header, payload = recv_frame(self.sock)
+            kind = header.get("type")
+            if kind == "file":
+                self.store_file(header, payload)
+            elif kind == "job":
+                self.run_job(header)
+            elif kind == "stop":
+                return
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description="Run distributed stress tests for a broker")
+    parser.add_argument("--connect", required=True, help="Broker address (HOST:PORT or unix:PATH)")
+    parser.add_argument("--slots", type=int, default=os.cpu_count() or 1, help="Tests run in parallel")
+    parser.add_argument("--name", default=socket.gethostname(), help="Agent name shown by the broker")
+    parser.add_argument("--token", default=os.environ.get("CTS_AGENT_TOKEN", ""), help="Shared token")
+    parser.add_argument("--workdir", default=None, help="Directory for received files")
+    args = parser.parse_args(argv)
+
+    workdir = args.workdir or tempfile.mkdtemp(prefix="cts_agent_")
+    os.makedirs(workdir, exist_ok=True)
+    try:
+        sock = connect(args.connect, timeout=30)
+    except OSError as e:
+        print(f"distributed_agent: cannot connect to {args.connect}: {e}", file=sys.stderr)
+        return 1
+
+    agent = Agent(sock, args.slots, workdir)
+    agent.send({
+        "type": "hello",
+        "protocol": PROTOCOL_VERSION,
+        "name": args.name,
+        "slots": agent.slots,
+        "platform": sys.platform,
+        "machine": platform.machine(),
+        "token": args.token,
+    })
+    try:
+        agent.serve()
+    except (ConnectionError, OSError) as e:
+        print(f"distributed_agent: connection lost: {e}", file=sys.stderr)
+        return 1
+    finally:
+        sock.close()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
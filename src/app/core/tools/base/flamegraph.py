@@ -0,0 +1,101 @@
+"""
+SVG flamegraphs from collapsed stacks.
+
+render_flamegraph() lays out collapsed stacks ("main;solve;dfs 42", root
+first) the way flamegraph.pl does: one row per stack depth, the root at the
+bottom, children sorted by name and sized by their sample count. The SVG is
+self-contained (no scripts); hovering a frame shows its name, samples and
+share of the total.
+"""
+
+import zlib
+from html import escape
+from typing import Any, Dict, Iterable, List, Sequence
+
+WIDTH = 1200
+FRAME_HEIGHT = 16
+FONT_SIZE = 11
+CHAR_WIDTH = 6.6  # Approximate advance of the monospace font
+PADDING = 10
+TITLE_HEIGHT = 30
+MIN_FRAME_WIDTH = 0.3  # Narrower frames are not drawn
+
+
+def _build_tree(collapsed: Iterable[Sequence[Any]]) -> Dict[str, Any]:
+    root: Dict[str, Any] = {"name": "all", "count": 0, "children": {}}
+    for stack, count in collapsed:
+        root["count"] += count
+        node = root
+        for name in stack.split(";"):
+            node = node["children"].setdefault(name, {"name": name, "count": 0, "children": {}})
+            node["count"] += count
+    return root
+
+
+def _depth(node: Dict[str, Any]) -> int:
+    return 1 + max((_depth(child) for child in node["children"].values()), default=0)
+
+
+def _color(name: str) -> str:
+    """Warm palette, stable per function name."""
+    value = zlib.crc32(name.encode("utf-8"))
+    red = 205 + value % 50
+    green = 80 + (value >> 8) % 130
+    blue = 40 + (value >> 16) % 50
+    return f"rgb({red},{green},{blue})"
+
+
+def render_flamegraph(collapsed: Iterable[Sequence[Any]], title: str = "Flame Graph") -> str:
+    """
+    Render collapsed stacks as an SVG flamegraph.
+
+    Args:
+        collapsed: (stack, count) pairs, frames separated by ';' root first
+        title: Heading drawn above the graph
+
+    Returns:
+        str: SVG document
+    """
+    root = _build_tree(collapsed)
+    total = root["count"]
+    depth = _depth(root)
+    height = TITLE_HEIGHT + depth * FRAME_HEIGHT + 2 * PADDING
+    scale = (WIDTH - 2 * PADDING) / total if total else 0.0
+
+    parts: List[str] = [
+        f'<svg xmlns="http://www.w3.org/2000/svg" width="{WIDTH}" height="{height}" '
+        f'viewBox="0 0 {WIDTH} {height}" font-family="monospace" font-size="{FONT_SIZE}">',
+        f'<rect width="{WIDTH}" height="{height}" fill="#f8f8f8"/>',
+        f'<text x="{WIDTH / 2}" y="{PADDING + FONT_SIZE + 4}" text-anchor="middle" '
+        f'font-size="{FONT_SIZE + 5}">{escape(title)}</text>',
+    ]
+
+    # Iterative layout: (node, x, level)
+    pending = [(root, PADDING, 0)]
+    while pending:
+        node, x, level = pending.pop()
+        width = node["count"] * scale
+        if width < MIN_FRAME_WIDTH:
+            continue
+        y = height - PADDING - (level + 1) * FRAME_HEIGHT
+        percent = 100.0 * node["count"] / total if total else 0.0
+        label = escape(node["name"])
+        parts.append(
+            f'<g><title>{label} ({node["count"]} samples, {percent:.2f}%)</title>'
+            f'<rect x="{x:.2f}" y="{y}" width="{width:.2f}" height="{FRAME_HEIGHT - 1}" '
+            f'rx="2" fill="{_color(node["name"])}"/>'
+        )
+        chars = int((width - 6) / CHAR_WIDTH)
+        if chars >= 3:
+            text = node["name"] if len(node["name"]) <= chars else node["name"][: chars - 2] + ".."
+            parts.append(f'<text x="{x + 3:.2f}" y="{y + FRAME_HEIGHT - 4}">{escape(text)}</text>')
+        parts.append("</g>")
+
+        child_x = x
+        for name in sorted(node["children"]):
+            child = node["children"][name]
+            pending.append((child, child_x, level + 1))
+            child_x += child["count"] * scale
+
+    parts.append("</svg>")
+    return "\n".join(parts)
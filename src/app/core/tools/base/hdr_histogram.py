@@ -0,0 +1,280 @@
+"""
+HDR histograms for per-run latency and memory distributions.
+
+HdrHistogram follows the layout of Gil Tene's High Dynamic Range histogram:
+values are grouped into power-of-two buckets, each split into linear
+sub-buckets, so every recorded value is kept with a fixed number of
+significant digits regardless of magnitude. Counts are stored sparsely,
+which keeps serialized histograms small and lets histograms of different
+runs be merged exactly (for trend views across runs).
+
+ResourceHistograms bundles the histograms of one benchmark run (wall time,
+CPU time, peak RSS, peak stack) and is updated incrementally as tests finish.
+"""
+
+import math
+from typing import Any, Dict, Iterable, List, Optional, Tuple
+
+# Percentiles reported in summaries
+DEFAULT_PERCENTILES = (50.0, 90.0, 95.0, 99.0, 99.9)
+
+
+class HdrHistogram:
+    """
+    Sparse High Dynamic Range histogram of non-negative integers.
+
+    Usage:
+        hist = HdrHistogram(significant_figures=3)
+        hist.record(1234)
+        hist.value_at_percentile(99.0)
+    """
+
+    def __init__(self, lowest_discernible: int = 1, significant_figures: int = 3):
+        """
+        Args:
+            lowest_discernible: Smallest value distinguished from 0 (>= 1)
+            significant_figures: Decimal digits of precision kept (1-5)
+        """
+        if lowest_discernible < 1:
+            raise ValueError("lowest_discernible must be >= 1")
+        if not 1 <= significant_figures <= 5:
+            raise ValueError("significant_figures must be between 1 and 5")
+
+        self.lowest_discernible = lowest_discernible
+        self.significant_figures = significant_figures
+
+        self._unit_magnitude = int(math.floor(math.log2(lowest_discernible)))
+        largest_single_unit = 2 * 10**significant_figures
+        self._sub_bucket_count_magnitude = int(math.ceil(math.log2(largest_single_unit)))
+        self._sub_bucket_half_count_magnitude = self._sub_bucket_count_magnitude - 1
+        self._sub_bucket_count = 1 << self._sub_bucket_count_magnitude
+        self._sub_bucket_half_count = self._sub_bucket_count // 2
+        self._sub_bucket_mask = (self._sub_bucket_count - 1) << self._unit_magnitude
+
+        self._counts: Dict[int, int] = {}
+        self.total_count = 0
+        self.min_value: Optional[int] = None
+        self.max_value: Optional[int] = None
+        self._sum = 0
+
+    # Index arithmetic (see HdrHistogram's getBucketIndex/getSubBucketIndex)
+
+    def _bucket_index(self, value: int) -> int:
+        return (
+            (value | self._sub_bucket_mask).bit_length()
+            - self._unit_magnitude
+            - (self._sub_bucket_half_count_magnitude + 1)
+        )
+
+    def _counts_index(self, value: int) -> int:
+        bucket = self._bucket_index(value)
+        sub_bucket = value >> (bucket + self._unit_magnitude)
+        return ((bucket + 1) << self._sub_bucket_half_count_magnitude) + (
+            sub_bucket - self._sub_bucket_half_count
+        )
+
+    def _split_index(self, index: int) -> Tuple[int, int]:
+        bucket = (index >> self._sub_bucket_half_count_magnitude) - 1
+        sub_bucket = (index & (self._sub_bucket_half_count - 1)) + self._sub_bucket_half_count
+        if bucket < 0:
+            sub_bucket -= self._sub_bucket_half_count
+            bucket = 0
+        return bucket, sub_bucket
+
+    def _lowest_equivalent(self, index: int) -> int:
+        bucket, sub_bucket = self._split_index(index)
+        return sub_bucket << (bucket + self._unit_magnitude)
+
+    def _highest_equivalent(self, index: int) -> int:
+        bucket, _ = self._split_index(index)
+        return self._lowest_equivalent(index) + (1 << (bucket + self._unit_magnitude)) - 1
+
+    def record(self, value: int, count: int = 1) -> None:
+        """
+        Record a value.
+
+        Args:
+            value: Non-negative integer (floats are rounded)
+            count: Number of occurrences
+        """
+        value = int(round(value))
+        if value < 0:
+            raise ValueError("HdrHistogram only records non-negative values")
+
+        index = self._counts_index(value)
+        self._counts[index] = self._counts.get(index, 0) + count
+        self.total_count += count
+        self._sum += value * count
+        self.min_value = value if self.min_value is None else min(self.min_value, value)
+        self.max_value = value if self.max_value is None else max(self.max_value, value)
+
+    @property
+    def mean(self) -> Optional[float]:
+        return self._sum / self.total_count if self.total_count else None
+
+    def value_at_percentile(self, percentile: float) -> Optional[int]:
+        """
+        Get the value below which the given percentage of recordings fall.
+
+        Returns the highest value equivalent to the matching sub-bucket,
+        capped at the largest recorded value (None if empty).
+        """
+        if not self.total_count:
+            return None
+
+        percentile = min(max(percentile, 0.0), 100.0)
+        target = max(1, int(math.ceil(percentile / 100.0 * self.total_count)))
+
+        seen = 0
+        for index in sorted(self._counts):
+            seen += self._counts[index]
+            if seen >= target:
+                return min(self._highest_equivalent(index), self.max_value)
+        return self.max_value
+
+    def percentiles(self, percentiles: Iterable[float] = DEFAULT_PERCENTILES) -> Dict[str, int]:
+        """Get several percentiles keyed like 'p50', 'p99', 'p99.9'."""
+        return {
+            f"p{p:g}": self.value_at_percentile(p)
+            for p in percentiles
+        }
+
+    def buckets(self) -> List[Dict[str, int]]:
+        """
+        Get a log2 histogram of the recorded values.
+
+        Returns:
+            List of {"from", "to", "count"} for every non-empty power-of-two range
+        """
+        merged: Dict[int, int] = {}
+        for index, count in self._counts.items():
+            bucket, _ = self._split_index(index)
+            merged[bucket] = merged.get(bucket, 0) + count
+
+        result = []
+        for bucket in sorted(merged):
+            low = 0 if bucket == 0 else self._sub_bucket_half_count << (bucket + self._unit_magnitude)
+            high = (self._sub_bucket_count << (bucket + self._unit_magnitude)) - 1
+            result.append({"from": low, "to": high, "count": merged[bucket]})
+        return result
+
+    def merge(self, other: "HdrHistogram") -> None:
+        """
+        Add the recordings of another histogram with the same configuration.
+
+        Raises:
+            ValueError: If the histograms use different precision settings
+        """
+        if (other.lowest_discernible, other.significant_figures) != (
+            self.lowest_discernible,
+            self.significant_figures,
+        ):
+            raise ValueError("Cannot merge histograms with different precision settings")
+
+        for index, count in other._counts.items():
+            self._counts[index] = self._counts.get(index, 0) + count
+        self.total_count += other.total_count
+        self._sum += other._sum
+        for attr, pick in (("min_value", min), ("max_value", max)):
+            theirs = getattr(other, attr)
+            if theirs is not None:
+                ours = getattr(self, attr)
+                setattr(self, attr, theirs if ours is None else pick(ours, theirs))
+
+    def summary(self) -> Dict[str, Any]:
+        """Get count, min, max, mean, percentiles and log2 buckets."""
+        return {
+            "count": self.total_count,
+            "min": self.min_value,
+            "max": self.max_value,
+            "mean": self.mean,
+            **self.percentiles(),
+            "histogram": self.buckets(),
+        }
+
+    def to_dict(self) -> Dict[str, Any]:
+        """Serialize (JSON-compatible) so the histogram can be merged later."""
+        return {
+            "lowest_discernible": self.lowest_discernible,
+            "significant_figures": self.significant_figures,
+            "total_count": self.total_count,
+            "sum": self._sum,
+            "min": self.min_value,
+            "max": self.max_value,
+            "counts": {str(index): count for index, count in sorted(self._counts.items())},
+        }
+
+    @classmethod
+    def from_dict(cls, data: Dict[str, Any]) -> "HdrHistogram":
+        """Restore a histogram serialized with to_dict()."""
+        histogram = cls(data["lowest_discernible"], data["significant_figures"])
+        histogram._counts = {int(index): count for index, count in data.get("counts", {}).items()}
+        histogram.total_count = data.get("total_count", sum(histogram._counts.values()))
+        histogram._sum = data.get("sum", 0)
+        histogram.min_value = data.get("min")
+        histogram.max_value = data.get("max")
+        return histogram
+
+
+class ResourceHistograms:
+    """
+    Wall time, CPU time, peak RSS and peak stack distributions of one benchmark run.
+
+    Times are recorded in microseconds and memory in kilobytes, so the
+    integer histograms keep three significant digits for both.
+    """
+
+    # Histogram name -> (test result key, scale from result unit)
+    METRICS = {
+        "wall_time_us": ("execution_time", 1e6),  # seconds
+        "cpu_time_us": ("cpu_time", 1e6),  # seconds
+        "peak_rss_kb": ("memory_used", 1024.0),  # MB
+        "peak_stack_kb": ("stack_used", 1024.0),  # MB (VmStk samples)
+    }
+
+    def __init__(self):
+        self.histograms = {name: HdrHistogram() for name in self.METRICS}
+
+    def record_result(self, result: Dict[str, Any]) -> None:
+        """Record the metrics present in one test result."""
+        # Tests in a persistent JVM have no memory of their own (see memory_measured)
+        measured = result.get("memory_measured", True)
+        for name, (key, scale) in self.METRICS.items():
+            if not measured and key in ("memory_used", "stack_used"):
+                continue
+            value = result.get(key)
+            if isinstance(value, (int, float)) and not isinstance(value, bool) and value >= 0:
+                self.histograms[name].record(value * scale)
+
+    @classmethod
+    def from_results(cls, results: Iterable[Dict[str, Any]]) -> "ResourceHistograms":
+        histograms = cls()
+        for result in results:
+            histograms.record_result(result)
+        return histograms
+
+    def merge(self, other: "ResourceHistograms") -> None:
+        for name, histogram in other.histograms.items():
+            self.histograms[name].merge(histogram)
+
+    def to_analysis(self) -> Dict[str, Any]:
+        """
+        Build the analysis section: summaries plus serialized histograms.
+
+        The "hdr" entries can be restored with from_analysis() and merged
+        with other runs.
+        """
+        return {
+            name: {**histogram.summary(), "hdr": histogram.to_dict()}
+            for name, histogram in self.histograms.items()
+        }
+
+    @classmethod
+    def from_analysis(cls, analysis: Dict[str, Any]) -> "ResourceHistograms":
+        """Restore histograms from a to_analysis() section."""
+        histograms = cls()
+        for name in cls.METRICS:
+            data = analysis.get(name, {}).get("hdr")
+            if data:
+                histograms.histograms[name] = HdrHistogram.from_dict(data)
+        return histograms
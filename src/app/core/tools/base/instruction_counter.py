@@ -0,0 +1,211 @@
+"""
+Load-independent timing of benchmarked solutions.
+
+Wall time on a shared machine depends on what else is running: the same
+solution can pass on an idle machine and exceed the limit under load. Two
+alternative timing modes measure the work of the solution instead:
+
+- "cpu": CPU time of the process (user + system), unaffected by waiting
+  for a core but still by cache and frequency effects of the neighbours
+- "instructions": retired user-space instructions, converted to seconds on
+  a reference machine (instructions / reference instructions per second);
+  identical across runs of the same input
+
+The counter (resources/native/insn_counter.cpp) is compiled once into the
+user cache and preloaded into native test solutions; it reads the
+instruction count and the task clock from perf_event counters. Hardware
+counters are missing in many VMs and containers, so estimates fall back
+to the task clock, then to the CPU time sampled from /proc, then to wall
+time; each result records the source it was timed with.
+
+The reference rate is config["benchmarker"]["reference_instructions_per_second"];
+the timing analysis reports the rate measured in a run, so running a
+benchmark on the reference machine calibrates it.
+
+Linux only; elsewhere instruction counts are reported as unsupported.
+"""
+
+import json
+import os
+import sys
+from typing import Any, Dict, List, Optional, Tuple
+
+from src.app.core.tools.base.alloc_profiler import build_preload_library
+
+COUNTER_SOURCE = os.path.normpath(
+    os.path.join(
+        os.path.dirname(os.path.abspath(__file__)),
+        "..", "..", "..", "resources", "native", "insn_counter.cpp",
+    )
+)
+COUNTER_LIBRARY = "libcts_count.so"
+
+# Environment variable read by the counter
+REPORT_ENV = "CTS_COUNT_REPORT"
+
+TIMING_MODES = ("wall", "cpu", "instructions")
+DEFAULT_TIMING_MODE = "wall"
+
+# Instructions per second of the reference machine (a ~3 GHz core at IPC 1)
+DEFAULT_REFERENCE_IPS = 3_000_000_000
+
+# In load-independent modes the wall clock only guards against hangs: a
+# test is killed after this many time limits (and at least the slack more)
+WALL_WATCHDOG_FACTOR = 3
+MIN_WATCHDOG_SLACK = 1.0
+
+
+def counter_supported() -> bool:
+    """Check whether the platform supports the perf_event counter."""
+    return sys.platform.startswith("linux")
+
+
+def ensure_counter_built(compiler: str = "g++", timeout: int = 60) -> Optional[str]:
+    """
+    Compile the counter into the user cache if needed.
+
+    Args:
+        compiler: C++ compiler executable
+        timeout: Compilation timeout in seconds
+
+    Returns:
+        Optional[str]: Path of the shared library, or None on failure
+    """
+    if not counter_supported():
+        return None
+    return build_preload_library(COUNTER_SOURCE, COUNTER_LIBRARY, compiler, timeout)
+
+
+def counter_environment(
+    library: str, report_path: str, base_env: Optional[Dict[str, str]] = None
+) -> Dict[str, str]:
+    """
+    Get the environment that preloads the counter.
+
+    Args:
+        library: Path returned by ensure_counter_built()
+        report_path: File the counts are written to on exit
+        base_env: Environment to extend (default: os.environ)
+
+    Returns:
+        Dict[str, str]: Environment for the counted process
+    """
+    env = dict(os.environ if base_env is None else base_env)
+    preload = env.get("LD_PRELOAD")
+    env["LD_PRELOAD"] = f"{library}:{preload}" if preload else library
+    env[REPORT_ENV] = report_path
+    return env
+
+
+def read_counts(path: str) -> Optional[Dict[str, Any]]:
+    """
+    Read a counter report.
+
+    Args:
+        path: Report path passed via CTS_COUNT_REPORT
+
+    Returns:
+        Optional[Dict[str, Any]]: instructions (None without hardware
+        counters), task_clock (seconds) and error; None if the process
+        wrote no report (killed, or statically linked)
+    """
+    try:
+        with open(path, encoding="utf-8") as f:
+            report = json.load(f)
+    except (OSError, ValueError):
+        return None
+    task_clock_ns = report.get("task_clock_ns")
+    if not isinstance(task_clock_ns, int) or task_clock_ns < 0:
+        task_clock_ns = None
+    counts: Dict[str, Any] = {
+        "instructions": report.get("instructions"),
+        "task_clock": task_clock_ns / 1e9 if task_clock_ns is not None else None,
+    }
+    if report.get("error"):
+        counts["error"] = report["error"]
+    return counts
+
+
+def estimate_time(
+    mode: str,
+    wall_time: float,
+    cpu_time: float,
+    counts: Optional[Dict[str, Any]] = None,
+    reference_ips: float = DEFAULT_REFERENCE_IPS,
+) -> Tuple[float, str]:
+    """
+    Get the time a test is judged by.
+
+    Args:
+        mode: One of TIMING_MODES
+        wall_time: Measured wall time in seconds
+        cpu_time: CPU time sampled from /proc in seconds (0 if unknown)
+        counts: Result of read_counts() (None if not counted)
+        reference_ips: Instructions per second of the reference machine
+
+    Returns:
+        Tuple[float, str]: Seconds and their source ('instructions',
+        'task_clock', 'cpu_time' or 'wall')
+    """
+    counts = counts or {}
+    if mode == "instructions" and counts.get("instructions") is not None and reference_ips > 0:
+        return counts["instructions"] / reference_ips, "instructions"
+    if mode in ("instructions", "cpu"):
+        if counts.get("task_clock") is not None:
+            return counts["task_clock"], "task_clock"
+        if cpu_time > 0:
+            return cpu_time, "cpu_time"
+    return wall_time, "wall"
+
+
+def watchdog_timeout(mode: str, time_limit: float) -> float:
+    """Wall time after which a test is killed in the given timing mode."""
+    if mode == "wall":
+        return time_limit
+    return max(time_limit * WALL_WATCHDOG_FACTOR, time_limit + MIN_WATCHDOG_SLACK)
+
+
+def summarize_timing(
+    results: List[Dict[str, Any]], mode: str, reference_ips: float = DEFAULT_REFERENCE_IPS
+) -> Optional[Dict[str, Any]]:
+    """
+    Summarize how the tests of a run were timed.
+
+    Returns:
+        Optional[Dict[str, Any]]: Mode, tests per timing source, instruction
+        totals and the measured instructions per second; None in wall mode
+    """
+    if mode == "wall":
+        return None
+
+    sources: Dict[str, int] = {}
+    for r in results:
+        source = r.get("timing_source")
+        if source:
+            sources[source] = sources.get(source, 0) + 1
+
+    counted = [
+        r for r in results
+        if r.get("instructions") is not None and (r.get("task_clock") or 0) > 0
+    ]
+    instructions = sum(r["instructions"] for r in counted)
+    seconds = sum(r["task_clock"] for r in counted)
+
+    summary: Dict[str, Any] = {
+        "mode": mode,
+        "sources": sources,
+        "max_wall_time": max((r.get("wall_time", r.get("execution_time", 0)) for r in results), default=0),
+        "max_estimated_time": max((r.get("execution_time", 0) for r in results), default=0),
+    }
+    if mode == "instructions":
+        summary["reference_instructions_per_second"] = reference_ips
+        summary["total_instructions"] = sum(
+            r["instructions"] for r in results if r.get("instructions") is not None
+        )
+        if seconds > 0:
+            # Set this as the reference rate after a run on the reference machine
+            summary["measured_instructions_per_second"] = instructions / seconds
+    errors = sorted({r["counter_error"] for r in results if r.get("counter_error")})
+    if errors:
+        summary["counter_errors"] = errors
+    return summary
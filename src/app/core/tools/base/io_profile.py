@@ -0,0 +1,156 @@
+"""
+Syscall-level I/O profile of solution processes.
+
+Unbuffered output (endl flushing every line, printf to an unbuffered
+stream) shows up as thousands of tiny write() calls, and the time goes to
+the kernel rather than to the solution. Linux keeps exact per-process
+counters of read/write syscalls and bytes in /proc/<pid>/io, and user and
+system CPU time in /proc/<pid>/stat. Both stay readable after the process
+exits until it is reaped, so the runner waits with WNOWAIT, reads the
+final counters of the zombie, and only then collects the exit status.
+
+System CPU time is used as the cost of I/O syscalls: for contest solutions
+the kernel time is spent almost entirely in read()/write() and page faults.
+
+Linux only; elsewhere no profile is produced.
+"""
+
+import os
+import sys
+from typing import Any, Dict, List, Optional
+
+# Warn about tiny chunks only when there are enough calls to matter
+MIN_SYSCALLS_FOR_WARNING = 256
+TINY_CHUNK_BYTES = 64
+
+# Warn when the kernel takes this share of the CPU time (and enough time is spent)
+SYSTEM_TIME_WARNING_RATIO = 0.3
+MIN_CPU_TIME_FOR_WARNING = 0.05
+
+
+def io_profiling_supported() -> bool:
+    """Check whether exact I/O counters can be read at process exit."""
+    return sys.platform.startswith("linux") and hasattr(os, "WNOWAIT")
+
+
+def has_exited(pid: int) -> Optional[bool]:
+    """
+    Check whether a child has exited without reaping it.
+
+    Args:
+        pid: Child process ID
+
+    Returns:
+        Optional[bool]: True if exited (still waitable), False if running,
+        None if the state cannot be checked (not our child, already reaped)
+    """
+    try:
+        result = os.waitid(os.P_PID, pid, os.WEXITED | os.WNOHANG | os.WNOWAIT)
+    except (ChildProcessError, OSError):
+        return None
+    return result is not None
+
+
+def read_io_counters(pid: int) -> Optional[Dict[str, float]]:
+    """
+    Read the syscall and CPU time counters of a process.
+
+    Args:
+        pid: Process ID (running, or exited but not yet reaped)
+
+    Returns:
+        Optional[Dict[str, float]]: read_syscalls, write_syscalls, bytes_read,
+        bytes_written, user_time, system_time; None if unavailable
+    """
+    try:
+        with open(f"/proc/{pid}/io", "rb") as f:
+            fields = dict(line.split(b":", 1) for line in f.read().splitlines() if b":" in line)
+        with open(f"/proc/{pid}/stat", "rb") as f:
+            # Fields after the command name; utime and stime are fields 14 and 15
+            stat = f.read().rsplit(b")", 1)[1].split()
+        ticks = os.sysconf("SC_CLK_TCK")
+        return {
+            "read_syscalls": int(fields[b"syscr"]),
+            "write_syscalls": int(fields[b"syscw"]),
+            "bytes_read": int(fields[b"rchar"]),
+            "bytes_written": int(fields[b"wchar"]),
+            "user_time": int(stat[11]) / ticks,
+            "system_time": int(stat[12]) / ticks,
+        }
+    except (OSError, KeyError, IndexError, ValueError):
+        return None
+
+
+def summarize_io(counters: Dict[str, float]) -> Dict[str, Any]:
+    """
+    Derive chunk sizes, the kernel time share and warnings from raw counters.
+
+    Args:
+        counters: Result of read_io_counters()
+
+    Returns:
+        Dict[str, Any]: Counters plus avg_read_bytes, avg_write_bytes,
+        system_time_ratio and a list of warnings
+    """
+    summary: Dict[str, Any] = dict(counters)
+    reads, writes = counters["read_syscalls"], counters["write_syscalls"]
+    summary["avg_read_bytes"] = counters["bytes_read"] / reads if reads else 0.0
+    summary["avg_write_bytes"] = counters["bytes_written"] / writes if writes else 0.0
+
+    cpu_time = counters["user_time"] + counters["system_time"]
+    summary["system_time_ratio"] = counters["system_time"] / cpu_time if cpu_time else 0.0
+
+    warnings: List[str] = []
+    if writes >= MIN_SYSCALLS_FOR_WARNING and summary["avg_write_bytes"] < TINY_CHUNK_BYTES:
+        warnings.append(
+            f"Output written in {writes} write() calls of {summary['avg_write_bytes']:.0f} bytes "
+            f"on average; avoid endl/flush and use '\\n'"
+        )
+    if reads >= MIN_SYSCALLS_FOR_WARNING and summary["avg_read_bytes"] < TINY_CHUNK_BYTES:
+        warnings.append(
+            f"Input read in {reads} read() calls of {summary['avg_read_bytes']:.0f} bytes "
+            f"on average; read through a buffered stream"
+        )
+    if (
+        cpu_time >= MIN_CPU_TIME_FOR_WARNING
+        and summary["system_time_ratio"] >= SYSTEM_TIME_WARNING_RATIO
+    ):
+        warnings.append(
+            f"{summary['system_time_ratio']:.0%} of CPU time spent in the kernel "
+            f"({counters['system_time']:.2f}s system vs {counters['user_time']:.2f}s user)"
+        )
+    summary["warnings"] = warnings
+    return summary
+
+
+def summarize_io_results(results: List[Dict[str, Any]]) -> Optional[Dict[str, Any]]:
+    """
+    Aggregate the per-test I/O profiles of a run.
+
+    Returns:
+        Optional[Dict[str, Any]]: Totals, the worst tests and warning counts,
+        or None when no test was profiled
+    """
+    profiled = [r for r in results if isinstance(r.get("io"), dict)]
+    if not profiled:
+        return None
+
+    profiles = [r["io"] for r in profiled]
+    writes = sum(p["write_syscalls"] for p in profiles)
+    written = sum(p["bytes_written"] for p in profiles)
+    user = sum(p["user_time"] for p in profiles)
+    system = sum(p["system_time"] for p in profiles)
+    flagged = [r.get("test_number") for r in profiled if r["io"].get("warnings")]
+
+    return {
+        "profiled_tests": len(profiled),
+        "write_syscalls": writes,
+        "read_syscalls": sum(p["read_syscalls"] for p in profiles),
+        "avg_write_bytes": written / writes if writes else 0.0,
+        "max_write_syscalls": max(p["write_syscalls"] for p in profiles),
+        "user_time": user,
+        "system_time": system,
+        "system_time_ratio": system / (user + system) if user + system else 0.0,
+        "tests_with_warnings": flagged,
+        "warnings": sorted({w for p in profiles for w in p.get("warnings", [])})[:10],
+    }
@@ -7,6 +7,8 @@ for language-specific compilation and execution handling.
 
 import logging
 import os
+import re
+import shutil
 import subprocess
 from abc import ABC, abstractmethod
 from typing import Any, Dict, List, Optional, Tuple
@@ -180,7 +182,12 @@ class CppCompiler(BaseLanguageCompiler):
             )
             cmd.extend(default_flags)
 
+        # Extra flags are appended on top of the defaults (used by build variants)
+        cmd.extend(self.config.get("extra_flags", []))
+
         cmd.append(source_file)
+        # Linker flags follow the source (used by stress builds)
+        cmd.extend(self.config.get("link_flags", []))
         cmd.extend(["-o", output_file])
 
         logger.debug(f"C++ compile command: {' '.join(cmd)}")
@@ -229,7 +236,14 @@ class CppCompiler(BaseLanguageCompiler):
 
 
 class PythonCompiler(BaseLanguageCompiler):
-    """Python interpreter handler (no compilation needed)."""
+    """
+    Python interpreter handler (no compilation needed).
+
+    Supports the CPython and PyPy backends: selecting a pypy/pypy3
+    interpreter runs solutions under PyPy's JIT. If the configured PyPy is
+    not installed, the handler falls back to `fallback_interpreter`
+    (default: python) instead of failing every test.
+    """
 
     def get_language(self) -> Language:
         return Language.PYTHON
@@ -237,8 +251,20 @@ class PythonCompiler(BaseLanguageCompiler):
     def needs_compilation(self) -> bool:
         return False
 
+    def get_backend(self) -> str:
+        """Return 'pypy' or 'cpython' for the configured interpreter."""
+        interpreter = os.path.basename(self.config.get("interpreter", "python"))
+        return "pypy" if interpreter.lower().startswith("pypy") else "cpython"
+
     def get_compiler_executable(self) -> str:
-        return self.config.get("interpreter", "python")
+        interpreter = self.config.get("interpreter", "python")
+        if self.get_backend() == "pypy" and shutil.which(interpreter) is None:
+            fallback = self.config.get("fallback_interpreter", "python")
+            logger.warning(
+                f"PyPy interpreter '{interpreter}' not found, using {fallback} instead"
+            )
+            return fallback
+        return interpreter
 
     def get_executable_extension(self) -> str:
         return ".py"  # Python "executable" is the source file
@@ -293,7 +319,21 @@ class PythonCompiler(BaseLanguageCompiler):
 
 
 class JavaCompiler(BaseLanguageCompiler):
-    """Java compiler implementation using javac."""
+    """
+    Java compiler implementation using javac.
+
+    With config "cds" enabled, every successful compile also dumps an AppCDS
+    archive (<Class>.jsa next to the .class file) by running the class once
+    with -XX:ArchiveClassesAtExit; later runs map the archived classes with
+    -XX:SharedArchiveFile, which cuts JVM startup. Requires JDK 13+; older
+    runtimes (or failed dumps) simply run without an archive.
+    """
+
+    # Runtime executable -> feature version (None if unknown)
+    _runtime_versions: Dict[str, Optional[int]] = {}
+
+    # Lowest feature version supporting -XX:ArchiveClassesAtExit
+    CDS_MIN_VERSION = 13
 
     def get_language(self) -> Language:
         return Language.JAVA
@@ -360,6 +400,8 @@ class JavaCompiler(BaseLanguageCompiler):
             )
 
             if result.returncode == 0:
+                if output_file and self.config.get("cds", False):
+                    self._dump_class_archive(output_file)
                 return True, f"Successfully compiled {os.path.basename(source_file)}"
 
             return False, result.stderr or result.stdout
@@ -398,7 +440,100 @@ class JavaCompiler(BaseLanguageCompiler):
         # Get class directory
         class_dir = os.path.dirname(executable_path) or "."
 
-        return [runtime, "-cp", class_dir, class_name]
+        command = [runtime]
+        if self.config.get("cds", False):
+            archive = self._get_archive_path(executable_path)
+            if self._is_archive_current(archive, executable_path):
+                command.extend([f"-XX:SharedArchiveFile={archive}", "-Xlog:disable"])
+
+        return command + ["-cp", class_dir, class_name]
+
+    def get_runtime_version(self) -> Optional[int]:
+        """
+        Get the feature version of the configured Java runtime.
+
+        Returns:
+            Optional[int]: e.g. 17 for "17.0.2" and 8 for "1.8.0"; None if unknown
+        """
+        runtime = self.config.get("runtime", "java")
+        if runtime not in JavaCompiler._runtime_versions:
+            version = None
+            try:
+                result = subprocess.run(
+                    [runtime, "-version"],
+                    stdout=subprocess.PIPE,
+                    stderr=subprocess.PIPE,
+                    text=True,
+                    timeout=10,
+                    creationflags=0x08000000 if os.name == "nt" else 0,
+                )
+                match = re.search(r'version "(\d+)(?:\.(\d+))?', result.stderr + result.stdout)
+                if match:
+                    major = int(match.group(1))
+                    version = int(match.group(2) or 0) if major == 1 else major
+            except (OSError, subprocess.TimeoutExpired):
+                pass
+            JavaCompiler._runtime_versions[runtime] = version
+        return JavaCompiler._runtime_versions[runtime]
+
+    @staticmethod
+    def _get_archive_path(class_file: str) -> str:
+        return os.path.splitext(class_file)[0] + ".jsa"
+
+    @staticmethod
+    def _is_archive_current(archive: str, class_file: str) -> bool:
+        """An archive is only valid for the class file it was dumped from."""
+        try:
+            return os.path.getmtime(archive) >= os.path.getmtime(class_file)
+        except OSError:
+            return False
+
+    def _dump_class_archive(self, class_file: str, timeout: int = 10) -> bool:
+        """
+        Dump an AppCDS archive for a freshly compiled class.
+
+        The class runs once with empty input; failures only mean the next
+        runs start without an archive.
+
+        Args:
+            class_file: Path of the compiled .class file
+            timeout: Seconds to allow for the dump run
+
+        Returns:
+            bool: True if a current archive exists afterwards
+        """
+        archive = self._get_archive_path(class_file)
+        try:
+            os.remove(archive)  # A stale archive would be rejected anyway
+        except OSError:
+            pass
+
+        version = self.get_runtime_version()
+        if version is None or version < self.CDS_MIN_VERSION:
+            return False
+
+        class_dir = os.path.dirname(class_file) or "."
+        class_name = os.path.splitext(os.path.basename(class_file))[0]
+        try:
+            subprocess.run(
+                [
+                    self.config.get("runtime", "java"),
+                    f"-XX:ArchiveClassesAtExit={archive}",
+                    "-Xlog:disable",
+                    "-cp",
+                    class_dir,
+                    class_name,
+                ],
+                stdin=subprocess.DEVNULL,
+                stdout=subprocess.DEVNULL,
+                stderr=subprocess.DEVNULL,
+                timeout=timeout,
+                creationflags=0x08000000 if os.name == "nt" else 0,
+            )
+        except (OSError, subprocess.TimeoutExpired) as e:
+            logger.debug(f"AppCDS dump for {class_name} failed: {e}")
+
+        return self._is_archive_current(archive, class_file)
 
 
 class LanguageCompilerFactory:
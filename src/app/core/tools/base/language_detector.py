@@ -3,13 +3,20 @@ Language Detection System for Multi-Language Compilation Support.
 
 This module provides language detection from file extensions and content analysis,
 mapping to appropriate compiler configurations for C++, Python, and Java.
+
+Content analysis scores all languages at once with precompiled
+CONTENT_PATTERNS and caches the scores by content hash, so repeated
+detections never rescan unchanged content.
 """
 
+import hashlib
 import logging
 import os
 import re
+import threading
+from collections import OrderedDict
 from enum import Enum
-from typing import Any, Dict, List, Optional
+from typing import Any, Dict, List, Optional, Pattern, Tuple
 
 logger = logging.getLogger(__name__)
 
@@ -70,6 +77,13 @@ class LanguageDetector:
         ],
     }
 
+    # Maximum number of cached content scores (LRU)
+    CACHE_SIZE = 256
+
+    # Shared by all detector instances (compilers create a detector each)
+    _score_cache: "OrderedDict[Tuple, Dict[Language, int]]" = OrderedDict()
+    _cache_lock = threading.Lock()
+
     # Default compiler configurations per language
     DEFAULT_CONFIGS = {
         Language.CPP: {
@@ -182,22 +196,16 @@ class LanguageDetector:
         if not content:
             return Language.UNKNOWN
 
+        scores = self._content_scores(content)
+
         # If hint provided, try that first
         if hint_extension:
             hint_lang = self.detect_from_extension(f"file{hint_extension}")
             if hint_lang != Language.UNKNOWN:
                 # Verify with content patterns
-                if self._matches_language_patterns(content, hint_lang):
+                if scores.get(hint_lang, 0) > 0:
                     return hint_lang
 
-        # Try all language patterns
-        scores = {}
-        for language, patterns in self.CONTENT_PATTERNS.items():
-            score = sum(
-                1 for pattern in patterns if re.search(pattern, content, re.MULTILINE)
-            )
-            scores[language] = score
-
         # Return language with highest score
         if scores:
             best_match = max(scores.items(), key=lambda x: x[1])
@@ -208,8 +216,68 @@ class LanguageDetector:
 
     def _matches_language_patterns(self, content: str, language: Language) -> bool:
         """Check if content matches patterns for given language."""
-        patterns = self.CONTENT_PATTERNS.get(language, [])
-        return any(re.search(pattern, content, re.MULTILINE) for pattern in patterns)
+        return self._content_scores(content).get(language, 0) > 0
+
+    @classmethod
+    def _get_pattern_index(cls) -> List[Tuple[Language, Pattern]]:
+        """Compile the content patterns once per class, in CONTENT_PATTERNS order."""
+        compiled = cls.__dict__.get("_compiled_patterns")
+        if compiled is None:
+            compiled = [
+                (language, re.compile(pattern, re.MULTILINE))
+                for language, patterns in cls.CONTENT_PATTERNS.items()
+                for pattern in patterns
+            ]
+            cls._compiled_patterns = compiled
+        return compiled
+
+    @classmethod
+    def _scan_content(cls, content: str) -> Dict[Language, int]:
+        """
+        Count the distinct patterns of each language found in content.
+
+        Every pattern starts with a literal, which the regex engine turns
+        into a fast substring search; that beats one combined alternation
+        (which loses the literal prefilter), so patterns are searched one by one.
+        """
+        scores = {language: 0 for language in cls.CONTENT_PATTERNS}
+        for language, pattern in cls._get_pattern_index():
+            if pattern.search(content):
+                scores[language] += 1
+        return scores
+
+    @classmethod
+    def _cache_get(cls, cache: OrderedDict, key: Tuple):
+        with cls._cache_lock:
+            value = cache.get(key)
+            if value is not None:
+                cache.move_to_end(key)
+            return value
+
+    @classmethod
+    def _cache_put(cls, cache: OrderedDict, key: Tuple, value) -> None:
+        with cls._cache_lock:
+            cache[key] = value
+            cache.move_to_end(key)
+            while len(cache) > cls.CACHE_SIZE:
+                cache.popitem(last=False)
+
+    def _content_scores(self, content: str) -> Dict[Language, int]:
+        """Get per-language pattern scores, cached by content hash."""
+        data = content.encode("utf-8", "surrogatepass")
+        key = (len(data), hashlib.blake2b(data, digest_size=16).digest())
+
+        scores = self._cache_get(self._score_cache, key)
+        if scores is None:
+            scores = self._scan_content(content)
+            self._cache_put(self._score_cache, key, scores)
+        return dict(scores)
+
+    @classmethod
+    def clear_cache(cls) -> None:
+        """Drop all cached detections."""
+        with cls._cache_lock:
+            cls._score_cache.clear()
 
     def detect_language(
         self, file_path: str, content: Optional[str] = None
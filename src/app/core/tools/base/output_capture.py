@@ -0,0 +1,241 @@
+"""
+Bounded capture of solution output.
+
+A solution printing in an infinite loop fills memory long before the time
+limit triggers when its output is read with a single stream.read(). The
+capture reads the stream in chunks on a background thread, stops at the
+output limit and calls back (the worker kills the process), so the
+memory held per in-flight test is bounded by the limit.
+
+Results store only a display excerpt of large outputs (the first and last
+DISPLAY_HEAD_CHARS/DISPLAY_TAIL_CHARS characters) instead of the full text.
+
+For output comparison the capture also hashes the stream as it is read.
+The hash covers the output with leading and trailing whitespace removed,
+the same normalization the comparator applies to strings, so equal
+digests mean equal outputs and a passing test needs neither the text nor
+a string comparison. Beyond a retention budget only the head and tail of
+the text are kept; mismatches are diffed from the retained text.
+
+The limit comes from config["output_limit_mb"] (0 = unlimited). Sizes are
+counted in characters of the decoded stream, which equals bytes for the
+ASCII output of typical solutions.
+"""
+
+import hashlib
+import threading
+from typing import Any, Callable, Dict, List, Optional
+
+DEFAULT_OUTPUT_LIMIT_MB = 64
+
+READ_CHUNK_CHARS = 64 * 1024
+
+# Excerpt of large outputs kept in results for display
+DISPLAY_HEAD_CHARS = 32 * 1024
+DISPLAY_TAIL_CHARS = 32 * 1024
+
+# Comparison outputs kept in full for diffing mismatches
+COMPARISON_RETAIN_CHARS = 4 * 1024 * 1024
+
+DIGEST_SIZE = 16
+
+# Characters of the longest lines shown by first_difference()
+DIFF_LINE_CHARS = 200
+
+
+class NormalizedHasher:
+    """
+    Incremental hash of a text with leading and trailing whitespace removed.
+
+    Whitespace at the start is skipped; a whitespace run is hashed only once
+    non-whitespace follows it, so a run at the end never is.
+    """
+
+    def __init__(self):
+        self._hash = hashlib.blake2b(digest_size=DIGEST_SIZE)
+        self._started = False
+        self._pending: List[str] = []
+
+    def update(self, chunk: str) -> None:
+        if not self._started:
+            chunk = chunk.lstrip()
+            if not chunk:
+                return
+            self._started = True
+        body = chunk.rstrip()
+        if body:
+            for pending in self._pending:
+                self._hash.update(pending.encode("utf-8", "surrogatepass"))
+            self._pending = []
+            self._hash.update(body.encode("utf-8", "surrogatepass"))
+        if len(body) < len(chunk):
+            self._pending.append(chunk[len(body):])
+
+    def hexdigest(self) -> str:
+        return self._hash.hexdigest()
+
+
+def normalized_digest(text: str) -> str:
+    """Digest of a complete text, equal to a capture's digest of the same output."""
+    hasher = NormalizedHasher()
+    hasher.update(text)
+    return hasher.hexdigest()
+
+
+def first_difference(actual: str, expected: str) -> Optional[Dict[str, Any]]:
+    """
+    Locate the first differing line of two outputs (whitespace-stripped at the ends).
+
+    Returns:
+        Optional[Dict[str, Any]]: 1-based line number, the expected and actual
+        lines (None past the end of an output) and both line counts; None if
+        the outputs are equal
+    """
+    actual_lines = actual.strip().split("\n")
+    expected_lines = expected.strip().split("\n")
+    for number in range(max(len(actual_lines), len(expected_lines))):
+        got = actual_lines[number] if number < len(actual_lines) else None
+        want = expected_lines[number] if number < len(expected_lines) else None
+        if got != want:
+            return {
+                "line": number + 1,
+                "expected": want[:DIFF_LINE_CHARS] if want is not None else None,
+                "actual": got[:DIFF_LINE_CHARS] if got is not None else None,
+                "expected_lines": len(expected_lines),
+                "actual_lines": len(actual_lines),
+            }
+    return None
+
+
+def output_limit_chars(limit_mb: Optional[float]) -> Optional[int]:
+    """Convert a limit in MB (0 or None = unlimited) to characters."""
+    if not limit_mb or limit_mb < 0:
+        return None
+    return int(limit_mb * 1024 * 1024)
+
+
+def display_excerpt(
+    text: str, head: int = DISPLAY_HEAD_CHARS, tail: int = DISPLAY_TAIL_CHARS
+) -> str:
+    """
+    Shorten an output to its first and last characters for display.
+
+    Args:
+        text: Full output
+        head: Characters kept from the start
+        tail: Characters kept from the end
+
+    Returns:
+        str: The text itself if short enough, else head and tail around an
+        omission marker
+    """
+    if len(text) <= head + tail:
+        return text
+    omitted = len(text) - head - tail
+    return f"{text[:head]}\n... [{omitted} characters omitted] ...\n{text[-tail:] if tail else ''}"
+
+
+class OutputCapture:
+    """
+    Read an output stream on a background thread, up to a size limit.
+
+    Once the stream grows past the limit, reading stops, on_limit is called
+    once and exceeded is set; text then holds the first limit characters.
+    With a retention budget, only the head and tail of longer outputs are
+    kept (complete is False); with hashing enabled, digest is the
+    normalized hash of everything read.
+    """
+
+    def __init__(
+        self,
+        stream: Any,
+        limit: Optional[int] = None,
+        on_limit: Optional[Callable[[], None]] = None,
+        retain: Optional[int] = None,
+        hash_output: bool = False,
+    ):
+        """
+        Args:
+            stream: Readable stream (a process's stdout pipe)
+            limit: Maximum characters to accept (None = unlimited)
+            on_limit: Called from the reader thread when the limit is exceeded
+            retain: Maximum characters of text kept in full (None = all)
+            hash_output: Compute the normalized digest while reading
+        """
+        self._stream = stream
+        self.limit = limit
+        self._on_limit = on_limit
+        self.retain = retain
+        self._hasher = NormalizedHasher() if hash_output else None
+        self._chunks: List[str] = []
+        self._head = ""
+        self._tail = ""
+        self.size = 0
+        self.exceeded = False
+        self.complete = True
+        self._thread = threading.Thread(target=self._read, daemon=True)
+
+    def start(self) -> "OutputCapture":
+        self._thread.start()
+        return self
+
+    def join(self, timeout: Optional[float] = None) -> None:
+        self._thread.join(timeout)
+
+    def is_alive(self) -> bool:
+        return self._thread.is_alive()
+
+    @property
+    def text(self) -> str:
+        """Output read so far (at most limit characters), or its excerpt if not complete."""
+        if not self.complete:
+            return self.excerpt()
+        return "".join(self._chunks)
+
+    @property
+    def digest(self) -> Optional[str]:
+        """Normalized digest of the output read (None without hashing)."""
+        return self._hasher.hexdigest() if self._hasher else None
+
+    def excerpt(self) -> str:
+        """Head and tail of the output for display."""
+        if self.complete:
+            return display_excerpt("".join(self._chunks))
+        omitted = self.size - len(self._head) - len(self._tail)
+        return f"{self._head}\n... [{omitted} characters omitted] ...\n{self._tail}"
+
+    def _accept(self, chunk: str) -> None:
+        if self._hasher:
+            self._hasher.update(chunk)
+        self.size += len(chunk)
+        if self.complete and (self.retain is None or self.size <= self.retain):
+            self._chunks.append(chunk)
+            return
+
+        if self.complete:
+            # Retention budget exceeded: keep only the head and tail from now on
+            text = "".join(self._chunks) + chunk
+            self._chunks = []
+            self.complete = False
+            self._head = text[:DISPLAY_HEAD_CHARS]
+            self._tail = text[len(self._head):][-DISPLAY_TAIL_CHARS:]
+            return
+        self._tail = (self._tail + chunk)[-DISPLAY_TAIL_CHARS:]
+
+    def _read(self) -> None:
+        try:
+            while True:
+                chunk = self._stream.read(READ_CHUNK_CHARS)
+                if not chunk or not isinstance(chunk, str):
+                    break
+                if self.limit is not None and self.size + len(chunk) > self.limit:
+                    kept = self.limit - self.size
+                    self._accept(chunk[:kept])
+                    self.size += len(chunk) - kept
+                    self.exceeded = True
+                    if self._on_limit:
+                        self._on_limit()
+                    break
+                self._accept(chunk)
+        except (OSError, ValueError):
+            pass  # Stream closed while reading (process killed)
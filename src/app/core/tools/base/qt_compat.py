@@ -0,0 +1,151 @@
+"""
+Qt classes of the core tools, with pure-Python stand-ins for headless runs.
+
+Runners, compilers and test workers are QObjects that report through
+signals, which costs the PySide6 import (most of the app's startup) even
+where no event loop runs. With CTS_HEADLESS=1 in the environment (set by
+the CLI in src/app/cli.py) or without PySide6 installed, this module
+provides minimal replacements instead:
+
+- Signal: connected callables (or other signals) are called synchronously
+  in the emitting thread, with trailing arguments dropped for callables
+  that take fewer, as Qt does
+- QObject: moveToThread() and deleteLater() do nothing
+- QThread: start() emits started, then finished, on a plain thread
+- Slot: returns the function unchanged
+
+Core tool modules import QObject, QThread, Signal and Slot from here; the
+presentation layer imports PySide6 directly.
+"""
+
+import inspect
+import os
+import threading
+
+HEADLESS_ENV = "CTS_HEADLESS"
+
+HEADLESS = os.environ.get(HEADLESS_ENV, "") not in ("", "0")
+
+if not HEADLESS:
+    try:
+        from PySide6.QtCore import QObject, QThread, Signal, Slot
+    except ImportError:
+        HEADLESS = True
+
+if HEADLESS:
+
+    def _max_arguments(slot):
+        """Positional arguments a slot accepts (None = any number)."""
+        if isinstance(slot, _BoundSignal):
+            return None
+        try:
+            parameters = inspect.signature(slot).parameters.values()
+        except (TypeError, ValueError):
+            return None
+        count = 0
+        for parameter in parameters:
+            if parameter.kind == parameter.VAR_POSITIONAL:
+                return None
+            if parameter.kind in (parameter.POSITIONAL_ONLY, parameter.POSITIONAL_OR_KEYWORD):
+                count += 1
+        return count
+
+    class _BoundSignal:
+        """Signal of one object: its connections."""
+
+        def __init__(self):
+            self._slots = []
+            self._lock = threading.Lock()
+
+        def connect(self, slot):
+            with self._lock:
+                self._slots.append((slot, _max_arguments(slot)))
+
+        def disconnect(self, slot=None):
+            with self._lock:
+                if slot is None:
+                    self._slots.clear()
+                    return
+                remaining = [entry for entry in self._slots if entry[0] != slot]
+                if len(remaining) == len(self._slots):
+                    raise RuntimeError("Signal was not connected to this slot")
+                self._slots = remaining
+
+        def emit(self, *args):
+            with self._lock:
+                slots = list(self._slots)
+            for slot, max_arguments in slots:
+                slot(*(args if max_arguments is None else args[:max_arguments]))
+
+        __call__ = emit
+
+    class Signal:
+        """Class attribute declaring a signal; instances get their own connections."""
+
+        def __init__(self, *types, **kwargs):
+            self.types = types
+            self._attribute = None
+
+        def __set_name__(self, owner, name):
+            self._attribute = f"_signal_{name}"
+
+        def __get__(self, instance, owner=None):
+            if instance is None:
+                return self
+            bound = instance.__dict__.get(self._attribute)
+            if bound is None:
+                bound = instance.__dict__.setdefault(self._attribute, _BoundSignal())
+            return bound
+
+    def Slot(*types, **kwargs):  # noqa: N802 - mirrors the Qt decorator
+        return lambda function: function
+
+    class _QObjectMeta(type):
+        """Metaclass of the stand-in, so it combines with ABCMeta like Qt's does."""
+
+    class QObject(metaclass=_QObjectMeta):
+        def __init__(self, parent=None, *args, **kwargs):
+            super().__init__()
+            self._parent = parent
+
+        def moveToThread(self, thread):  # noqa: N802
+            pass
+
+        def deleteLater(self):  # noqa: N802
+            pass
+
+    class QThread(QObject):
+        started = Signal()
+        finished = Signal()
+
+        def __init__(self, parent=None):
+            super().__init__(parent)
+            self._thread = None
+
+        def start(self):
+            def run():
+                try:
+                    self.started.emit()
+                finally:
+                    self.finished.emit()
+
+            self._thread = threading.Thread(target=run, daemon=True)
+            self._thread.start()
+
+        def quit(self):
+            pass
+
+        def isRunning(self):  # noqa: N802
+            return self._thread is not None and self._thread.is_alive()
+
+        def wait(self, msecs=None):
+            if self._thread is not None:
+                self._thread.join(None if msecs is None else msecs / 1000)
+            return not self.isRunning()
+
+        @staticmethod
+        def currentThread():  # noqa: N802
+            return threading.current_thread()
+
+
+__all__ = ["HEADLESS", "HEADLESS_ENV", "QObject", "QThread", "Signal", "Slot"]
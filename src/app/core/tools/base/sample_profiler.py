@@ -0,0 +1,228 @@
+"""
+Sampling CPU profiles of native solutions via an LD_PRELOAD SIGPROF sampler.
+
+The sampler (resources/native/sample_profiler.cpp) is compiled once into
+the user cache and preloaded into a build of the test solution with debug
+info and frame pointers. Every CPU millisecond it records the call stack
+of the main thread; the most frequent stacks are written as a JSON report
+on exit.
+
+read_profile() symbolizes the stacks with addr2line, expands inlined
+functions into their own frames and folds the result into collapsed stacks
+("main;solve;dfs 42"), the input format of flamegraph tools, plus the
+functions and source lines with the most samples.
+
+Linux (x86-64, AArch64) only; elsewhere profiling is reported as unsupported.
+"""
+
+import json
+import os
+import platform
+import sys
+from typing import Any, Dict, List, Optional
+
+from src.app.core.tools.base.alloc_profiler import build_preload_library, symbolize_frames
+
+SAMPLER_SOURCE = os.path.normpath(
+    os.path.join(
+        os.path.dirname(os.path.abspath(__file__)),
+        "..", "..", "..", "resources", "native", "sample_profiler.cpp",
+    )
+)
+SAMPLER_LIBRARY = "libcts_prof.so"
+
+# Environment variables read by the sampler
+REPORT_ENV = "CTS_PROF_REPORT"
+HZ_ENV = "CTS_PROF_HZ"
+
+DEFAULT_SAMPLE_HZ = 1000
+
+# Slowest tests re-run under the sampler when profiling is enabled
+DEFAULT_PROFILE_COUNT = 3
+
+# Profiled runs may take this many time limits (at least the minimum) before
+# they are stopped; stopped runs still report their samples
+PROFILE_TIME_LIMIT_FACTOR = 5
+MIN_PROFILE_TIMEOUT = 10.0
+
+# Flags of the profiled build variant of the test solution
+PROFILE_BUILD_FLAGS = ["-g", "-fno-omit-frame-pointer", "-mno-omit-leaf-frame-pointer"]
+
+# Collapsed stacks kept per test (most frequent first)
+MAX_COLLAPSED_STACKS = 500
+
+# Entries in the top function and line tables
+TOP_ENTRIES = 15
+
+# Runtime frames below main() that only add noise to the flamegraph
+_STARTUP_FRAMES = ("_start", "__libc_start_main", "__libc_start_call_main", "__libc_init_first")
+
+
+def sampling_profiler_supported() -> bool:
+    """Check whether the platform supports the SIGPROF sampler."""
+    return sys.platform.startswith("linux") and platform.machine() in ("x86_64", "aarch64")
+
+
+def ensure_sampler_built(compiler: str = "g++", timeout: int = 60) -> Optional[str]:
+    """
+    Compile the sampler into the user cache if needed.
+
+    Args:
+        compiler: C++ compiler executable
+        timeout: Compilation timeout in seconds
+
+    Returns:
+        Optional[str]: Path of the shared library, or None on failure
+    """
+    if not sampling_profiler_supported():
+        return None
+    return build_preload_library(SAMPLER_SOURCE, SAMPLER_LIBRARY, compiler, timeout)
+
+
+def sampler_environment(
+    library: str, report_path: str, hz: Optional[int] = None, base_env: Optional[Dict[str, str]] = None
+) -> Dict[str, str]:
+    """
+    Get the environment that preloads the sampler.
+
+    Args:
+        library: Path returned by ensure_sampler_built()
+        report_path: File the report is written to on exit
+        hz: Samples per CPU second (None = library default)
+        base_env: Environment to extend (default: os.environ)
+
+    Returns:
+        Dict[str, str]: Environment for the profiled process
+    """
+    env = dict(os.environ if base_env is None else base_env)
+    preload = env.get("LD_PRELOAD")
+    env["LD_PRELOAD"] = f"{library}:{preload}" if preload else library
+    env[REPORT_ENV] = report_path
+    if hz is not None:
+        env[HZ_ENV] = str(hz)
+    return env
+
+
+def _frame_names(frame: Dict[str, Any]) -> List[str]:
+    """Names of a frame, outermost first (inlined functions get their own frame)."""
+    inlined = frame.get("inlined") or []
+    if inlined:
+        return list(reversed(inlined))
+    name = frame.get("function") or frame.get("symbol")
+    if name:
+        return [name]
+    return [f"{os.path.basename(frame['module'])}+{frame['offset']:#x}"]
+
+
+def _ranked(counts: Dict[str, int], samples: int, key: str) -> List[Dict[str, Any]]:
+    top = sorted(counts.items(), key=lambda item: item[1], reverse=True)[:TOP_ENTRIES]
+    return [
+        {key: name, "samples": count, "percent": 100.0 * count / samples if samples else 0.0}
+        for name, count in top
+    ]
+
+
+def read_profile(path: str, symbolize: bool = True) -> Optional[Dict[str, Any]]:
+    """
+    Read a sampler report and fold it into collapsed stacks.
+
+    Args:
+        path: Report path passed via CTS_PROF_REPORT
+        symbolize: Resolve frames with addr2line (dladdr symbols otherwise)
+
+    Returns:
+        Optional[Dict[str, Any]]: samples, hz, collapsed ([stack, count] pairs,
+        root first, ';'-separated), top_self, top_total and hot_lines; None if
+        the process wrote no report (killed, or statically linked)
+    """
+    try:
+        with open(path, encoding="utf-8") as f:
+            report = json.load(f)
+    except (OSError, ValueError):
+        return None
+
+    modules = report.get("modules", [])
+    frames: Dict[tuple, Dict[str, Any]] = {}
+    stacks = []
+    for stack in report.get("stacks", []):
+        keys = []
+        for module, offset, address, symbol in stack.get("frames", []):
+            # Frames after one outside any module come from code without frame pointers
+            if module < 0 or module >= len(modules):
+                break
+            key = (modules[module], offset)
+            frames.setdefault(
+                key, {"module": modules[module], "offset": offset, "address": address, "symbol": symbol}
+            )
+            keys.append(key)
+        if keys:
+            stacks.append((keys, stack.get("count", 0)))
+
+    if symbolize:
+        symbolize_frames(list(frames.values()))
+
+    collapsed: Dict[str, int] = {}
+    self_counts: Dict[str, int] = {}
+    total_counts: Dict[str, int] = {}
+    line_counts: Dict[str, int] = {}
+    for keys, count in stacks:
+        names = []
+        for key in reversed(keys):
+            names.extend(_frame_names(frames[key]))
+        while names and names[0] in _STARTUP_FRAMES:
+            names.pop(0)
+        if not names:
+            continue
+
+        folded = ";".join(name.replace(";", ",") for name in names)
+        collapsed[folded] = collapsed.get(folded, 0) + count
+        self_counts[names[-1]] = self_counts.get(names[-1], 0) + count
+        for name in set(names):
+            total_counts[name] = total_counts.get(name, 0) + count
+        location = frames[keys[0]].get("location")
+        if location:
+            line_counts[location] = line_counts.get(location, 0) + count
+
+    samples = report.get("samples", 0)
+    hz = report.get("hz", DEFAULT_SAMPLE_HZ)
+    shown = sorted(collapsed.items(), key=lambda item: item[1], reverse=True)
+    return {
+        "samples": samples,
+        "hz": hz,
+        "sampled_cpu_time": samples / hz if hz else 0.0,
+        "dropped_samples": report.get("dropped", 0),
+        "collapsed": [[stack, count] for stack, count in shown[:MAX_COLLAPSED_STACKS]],
+        "top_self": _ranked(self_counts, samples, "function"),
+        "top_total": _ranked(total_counts, samples, "function"),
+        "hot_lines": _ranked(line_counts, samples, "location"),
+    }
+
+
+def collapsed_text(profile: Dict[str, Any]) -> str:
+    """Collapsed stacks in the text format of flamegraph.pl/speedscope."""
+    return "".join(f"{stack} {count}\n" for stack, count in profile.get("collapsed", []))
+
+
+def summarize_profiles(results: List[Dict[str, Any]]) -> Optional[Dict[str, Any]]:
+    """
+    Summarize the profiled tests of a run for the benchmark analysis.
+
+    Returns:
+        Optional[Dict[str, Any]]: Profiled tests with their hottest functions,
+        or None when no test was profiled
+    """
+    profiled = [r for r in results if isinstance(r.get("profile"), dict)]
+    if not profiled:
+        return None
+    return {
+        "profiled_tests": [
+            {
+                "test_number": r.get("test_number"),
+                "execution_time": r.get("execution_time", 0),
+                "samples": r["profile"].get("samples", 0),
+                "top_self": r["profile"].get("top_self", [])[:5],
+                **({"error": r["profile"]["error"]} if r["profile"].get("error") else {}),
+            }
+            for r in sorted(profiled, key=lambda r: r.get("execution_time", 0), reverse=True)
+        ],
+    }
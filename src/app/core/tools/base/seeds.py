@@ -0,0 +1,110 @@
+"""
+Per-test seed derivation for reproducible test runs.
+
+Every test in a run gets a 64-bit seed derived from the run seed and the
+test number. The seed is exported to the generator process through the
+CTS_SEED environment variable, so generators built on generator.h (or the
+shipped templates) produce the same input whenever a test is replayed.
+
+The same seed doubles as a stable key for sampling decisions, e.g. which
+passing tests get replayed through the sanitizer build in tiered mode.
+"""
+
+import os
+from typing import Dict, Mapping, Optional
+
+# Environment variable read by generator.h and the generator templates
+SEED_ENV_VAR = "CTS_SEED"
+
+_MASK64 = (1 << 64) - 1
+_GOLDEN_GAMMA = 0x9E3779B97F4A7C15
+
+# Salt that decorrelates sampling decisions from the generator's own use of the seed
+_SAMPLING_SALT = 0xD1B54A32D192ED03
+
+
+def splitmix64(value: int) -> int:
+    """
+    Mix a 64-bit integer with the SplitMix64 finalizer.
+
+    Args:
+        value: Input value (only the low 64 bits are used)
+
+    Returns:
+        Well-distributed 64-bit hash of the input
+    """
+    z = (value + _GOLDEN_GAMMA) & _MASK64
+    z = ((z ^ (z >> 30)) * 0xBF58476D1CE4E5B9) & _MASK64
+    z = ((z ^ (z >> 27)) * 0x94D049BB133111EB) & _MASK64
+    return z ^ (z >> 31)
+
+
+def new_run_seed() -> int:
+    """Create a fresh random 64-bit run seed."""
+    return int.from_bytes(os.urandom(8), "little")
+
+
+def derive_test_seed(run_seed: int, test_number: int) -> int:
+    """
+    Derive the seed of a single test from the run seed.
+
+    Args:
+        run_seed: Seed identifying the whole run
+        test_number: 1-based test number
+
+    Returns:
+        64-bit seed for the test (stable across runs with the same run seed)
+    """
+    return splitmix64((run_seed + test_number * _GOLDEN_GAMMA) & _MASK64)
+
+
+def seed_fraction(seed: int) -> float:
+    """
+    Map a test seed to a uniform value in [0, 1).
+
+    Args:
+        seed: Test seed
+
+    Returns:
+        float: Deterministic pseudo-random fraction for the seed
+    """
+    return splitmix64(seed ^ _SAMPLING_SALT) / float(1 << 64)
+
+
+def is_sampled(seed: int, rate: float) -> bool:
+    """
+    Decide whether a test belongs to a sampled subset.
+
+    The decision depends only on the seed, so the same test is always
+    selected (or not) for a given rate.
+
+    Args:
+        seed: Test seed
+        rate: Fraction of tests to select (0.0 - 1.0)
+
+    Returns:
+        bool: True if the test is part of the sample
+    """
+    if rate <= 0.0:
+        return False
+    if rate >= 1.0:
+        return True
+    return seed_fraction(seed) < rate
+
+
+def generator_environment(
+    seed: int, base_env: Optional[Mapping[str, str]] = None
+) -> Dict[str, str]:
+    """
+    Build the environment for a generator process.
+
+    Args:
+        seed: Test seed to export
+        base_env: Environment to extend (defaults to os.environ)
+
+    Returns:
+        Dict[str, str]: Environment with CTS_SEED set
+    """
+    env = dict(os.environ if base_env is None else base_env)
+    env[SEED_ENV_VAR] = str(seed)
+    return env
@@ -0,0 +1,115 @@
+"""
+Process startup overhead of solution binaries.
+
+On tiny stress inputs a dynamically linked C++ binary spends a measurable
+part of every test in the dynamic loader (relocations, libstdc++) and in
+static initialization before main() reads anything. measure_startup()
+times a few runs of a binary on empty input; the fastest run is close to
+the fixed cost every test pays for launching the process, and the runners
+report it next to the average per-test time.
+
+A solution that does not exit on empty input (e.g. loops waiting for a
+test count) hits the probe timeout and is reported without a measurement.
+
+is_dynamic_executable() tells whether an ELF executable needs the dynamic
+loader (has a PT_INTERP segment), which is how stress builds
+(languages.cpp.stress_build, see BaseCompiler) are told apart from
+regular ones.
+"""
+
+import os
+import statistics
+import struct
+import subprocess
+import time
+from typing import Any, Dict, List, Optional
+
+# Runs per binary; the minimum is reported as the overhead
+STARTUP_RUNS = 5
+
+# Seconds a run on empty input may take before the probe gives up
+STARTUP_TIMEOUT = 1.0
+
+_PT_INTERP = 3
+
+
+def measure_startup(
+    command: List[str], runs: int = STARTUP_RUNS, timeout: float = STARTUP_TIMEOUT
+) -> Optional[Dict[str, Any]]:
+    """
+    Time runs of a command on empty input.
+
+    Args:
+        command: Execution command of the binary
+        runs: Number of runs
+        timeout: Seconds per run before the probe gives up
+
+    Returns:
+        Optional[Dict[str, Any]]: min_seconds, median_seconds, runs and the
+        exit code of the last run; None if the command could not be started
+        or did not finish within the timeout
+    """
+    times = []
+    exit_code = None
+    for _ in range(runs):
+        start = time.perf_counter()
+        try:
+            completed = subprocess.run(
+                command,
+                stdin=subprocess.DEVNULL,
+                stdout=subprocess.DEVNULL,
+                stderr=subprocess.DEVNULL,
+                timeout=timeout,
+                creationflags=0x08000000 if os.name == "nt" else 0,
+            )
+        except (OSError, subprocess.TimeoutExpired):
+            return None
+        times.append(time.perf_counter() - start)
+        exit_code = completed.returncode
+
+    if not times:
+        return None
+    return {
+        "min_seconds": min(times),
+        "median_seconds": statistics.median(times),
+        "runs": len(times),
+        "exit_code": exit_code,
+    }
+
+
+def is_dynamic_executable(path: str) -> Optional[bool]:
+    """
+    Check whether an ELF executable is loaded by the dynamic loader.
+
+    Args:
+        path: Executable path
+
+    Returns:
+        Optional[bool]: True if it has a PT_INTERP segment, False if not,
+        None if the file is not a readable ELF file
+    """
+    try:
+        with open(path, "rb") as f:
+            header = f.read(64)
+            if len(header) < 52 or header[:4] != b"\x7fELF":
+                return None
+            is_64 = header[4] == 2
+            endian = "<" if header[5] == 1 else ">"
+            if is_64:
+                phoff, = struct.unpack_from(endian + "Q", header, 32)
+                phentsize, phnum = struct.unpack_from(endian + "HH", header, 54)
+            else:
+                phoff, = struct.unpack_from(endian + "I", header, 28)
+                phentsize, phnum = struct.unpack_from(endian + "HH", header, 42)
+            f.seek(phoff)
+            table = f.read(phentsize * phnum)
+    except (OSError, struct.error):
+        return None
+
+    for index in range(phnum):
+        entry = table[index * phentsize:index * phentsize + 4]
+        if len(entry) < 4:
+            return None
+        if struct.unpack(endian + "I", entry)[0] == _PT_INTERP:
+            return True
+    return False
@@ -0,0 +1,256 @@
+"""
+Ranking of several solutions benchmarked on the same inputs.
+
+In tournament mode every generated input is run through all solutions,
+so each test is a paired sample: the solutions are compared on identical
+work, and the per-test differences are free of the input-size variance
+that dominates unpaired comparisons. The run order of the solutions is
+shuffled per test (seeded from the test seed), so warm caches, CPU
+frequency ramps and thermal throttling favour no solution systematically.
+
+The analysis ranks solutions by their median time over the tests all of
+them finished, and compares each solution with its neighbour in the
+ranking and with the fastest one using the Wilcoxon signed-rank test on
+the paired times and peak memory. The test is exact (all 2^n sign
+assignments, counted by dynamic programming) up to EXACT_TEST_MAX_PAIRS
+non-zero differences and uses the normal approximation beyond.
+"""
+
+import math
+from typing import Any, Dict, List, Optional, Sequence
+
+# Differences are judged significant below this two-sided p-value
+SIGNIFICANCE_LEVEL = 0.05
+
+# Largest number of non-zero differences tested exactly
+EXACT_TEST_MAX_PAIRS = 60
+
+# Verdicts of runs whose time is comparable (killed runs count at the limit)
+_TIMED_VERDICTS = ("Accepted", "Time Limit Exceeded", "Memory Limit Exceeded")
+
+
+def is_timed(entry: Dict[str, Any]) -> bool:
+    """Check whether a solution's run on a test ran to a comparable time (no crash)."""
+    return str(entry.get("error_details", "")).startswith(_TIMED_VERDICTS)
+
+
+def _median(values: Sequence[float]) -> float:
+    ordered = sorted(values)
+    middle = len(ordered) // 2
+    if len(ordered) % 2:
+        return ordered[middle]
+    return (ordered[middle - 1] + ordered[middle]) / 2
+
+
+def _percentile(values: Sequence[float], percent: float) -> float:
+    """Nearest-rank percentile."""
+    ordered = sorted(values)
+    rank = max(1, math.ceil(percent / 100 * len(ordered)))
+    return ordered[rank - 1]
+
+
+def wilcoxon_signed_rank(first: Sequence[float], second: Sequence[float]) -> Dict[str, Any]:
+    """
+    Two-sided Wilcoxon signed-rank test of paired samples.
+
+    Zero differences are dropped; tied absolute differences get their
+    average rank.
+
+    Args:
+        first: Values of the first sample
+        second: Paired values of the second sample
+
+    Returns:
+        Dict[str, Any]: pairs (non-zero differences), statistic (rank sum
+        of positive differences first - second), p_value and method
+        ('exact' or 'normal'); p_value is 1.0 without differences
+    """
+    differences = [a - b for a, b in zip(first, second) if a != b]
+    n = len(differences)
+    if n == 0:
+        return {"pairs": 0, "statistic": 0.0, "p_value": 1.0, "method": "exact"}
+
+    # Average ranks of the absolute differences
+    order = sorted(range(n), key=lambda i: abs(differences[i]))
+    ranks = [0.0] * n
+    tie_correction = 0.0
+    start = 0
+    while start < n:
+        end = start
+        while end + 1 < n and abs(differences[order[end + 1]]) == abs(differences[order[start]]):
+            end += 1
+        for position in range(start, end + 1):
+            ranks[order[position]] = (start + end) / 2 + 1
+        tied = end - start + 1
+        tie_correction += tied**3 - tied
+        start = end + 1
+
+    statistic = sum(rank for rank, d in zip(ranks, differences) if d > 0)
+    expected = n * (n + 1) / 4
+
+    if n <= EXACT_TEST_MAX_PAIRS:
+        # Distribution of the positive rank sum under random signs; doubled
+        # ranks are integers even with ties
+        doubled = [int(round(rank * 2)) for rank in ranks]
+        counts = [0] * (sum(doubled) + 1)
+        counts[0] = 1
+        reach = 0
+        for rank in doubled:
+            reach += rank
+            for total in range(reach, rank - 1, -1):
+                counts[total] += counts[total - rank]
+        observed = int(round(statistic * 2))
+        mirrored = sum(doubled) - observed
+        low, high = min(observed, mirrored), max(observed, mirrored)
+        tail = sum(counts[: low + 1]) + sum(counts[high:]) if low != high else sum(counts)
+        p_value = min(1.0, tail / 2**n)
+        method = "exact"
+    else:
+        variance = n * (n + 1) * (2 * n + 1) / 24 - tie_correction / 48
+        if variance <= 0:
+            p_value = 1.0
+        else:
+            # Continuity correction towards the mean
+            z = max(0.0, abs(statistic - expected) - 0.5) / math.sqrt(variance)
+            p_value = min(1.0, math.erfc(z / math.sqrt(2)))
+        method = "normal"
+
+    return {"pairs": n, "statistic": statistic, "p_value": p_value, "method": method}
+
+
+def _compare(
+    results: List[Dict[str, Any]], tests: List[int], first: str, second: str
+) -> Dict[str, Any]:
+    """Paired comparison of two solutions (first is the faster one)."""
+    by_test = {r["test_number"]: r["tournament"] for r in results}
+    first_times = [by_test[t][first]["execution_time"] for t in tests]
+    second_times = [by_test[t][second]["execution_time"] for t in tests]
+    first_memory = [by_test[t][first]["memory_used"] for t in tests]
+    second_memory = [by_test[t][second]["memory_used"] for t in tests]
+
+    time_test = wilcoxon_signed_rank(second_times, first_times)
+    memory_test = wilcoxon_signed_rank(second_memory, first_memory)
+    ratios = [s / f for f, s in zip(first_times, second_times) if f > 0]
+    return {
+        "faster": first,
+        "slower": second,
+        "tests": len(tests),
+        "median_time_ratio": _median(ratios) if ratios else None,
+        "time_p_value": time_test["p_value"],
+        "time_significant": time_test["p_value"] < SIGNIFICANCE_LEVEL,
+        "memory_difference_mb": _median([s - f for f, s in zip(first_memory, second_memory)]),
+        "memory_p_value": memory_test["p_value"],
+        "memory_significant": memory_test["p_value"] < SIGNIFICANCE_LEVEL,
+        "method": time_test["method"],
+    }
+
+
+def summarize_tournament(
+    results: List[Dict[str, Any]], labels: Dict[str, str]
+) -> Optional[Dict[str, Any]]:
+    """
+    Rank the solutions of a tournament run.
+
+    Args:
+        results: Test results carrying a 'tournament' entry per solution key
+        labels: Solution key -> display label (file name)
+
+    Returns:
+        Optional[Dict[str, Any]]: ranking (fastest first), comparisons of
+        ranking neighbours and against the fastest, output disagreements and
+        mean relative time per run position; None without tournament results
+    """
+    runs = [r for r in results if isinstance(r.get("tournament"), dict)]
+    if not runs:
+        return None
+    keys = list(labels)
+
+    # Tests every solution finished are the paired samples
+    common = [
+        r["test_number"]
+        for r in runs
+        if all(key in r["tournament"] and is_timed(r["tournament"][key]) for key in keys)
+    ]
+    by_test = {r["test_number"]: r["tournament"] for r in runs}
+
+    wins = {key: 0 for key in keys}
+    for test in common:
+        fastest = min(keys, key=lambda key: by_test[test][key]["execution_time"])
+        wins[fastest] += 1
+
+    standings = []
+    for key in keys:
+        entries = [r["tournament"][key] for r in runs if key in r["tournament"]]
+        times = [by_test[t][key]["execution_time"] for t in common]
+        memory = [by_test[t][key]["memory_used"] for t in common]
+        standings.append(
+            {
+                "key": key,
+                "label": labels[key],
+                "passed": sum(1 for e in entries if e.get("passed")),
+                "failed": sum(1 for e in entries if not e.get("passed")),
+                "median_time": _median(times) if times else None,
+                "mean_time": sum(times) / len(times) if times else None,
+                "p95_time": _percentile(times, 95) if times else None,
+                "median_memory": _median(memory) if memory else None,
+                "max_memory": max(memory) if memory else None,
+                "wins": wins[key],
+            }
+        )
+
+    # Solutions without comparable tests rank last, by failures
+    standings.sort(
+        key=lambda s: (
+            s["median_time"] is None,
+            s["median_time"] if s["median_time"] is not None else 0,
+            s["median_memory"] or 0,
+            s["failed"],
+        )
+    )
+    for rank, standing in enumerate(standings, start=1):
+        standing["rank"] = rank
+
+    comparisons = []
+    if common:
+        ranked = [s["key"] for s in standings]
+        pairs = list(zip(ranked, ranked[1:]))
+        pairs += [(ranked[0], key) for key in ranked[2:]]
+        comparisons = [_compare(runs, common, first, second) for first, second in pairs]
+
+    # Tests whose solutions printed different outputs (when hashed)
+    disagreements = []
+    for r in runs:
+        hashes = {
+            entry["output_hash"]
+            for entry in r["tournament"].values()
+            if entry.get("passed") and entry.get("output_hash")
+        }
+        if len(hashes) > 1:
+            disagreements.append(r["test_number"])
+
+    # Time relative to the test's median by run position; flat when the
+    # shuffled order cancels warm-up and throttling effects
+    position_ratios: Dict[int, List[float]] = {}
+    for test in common:
+        test_median = _median([by_test[test][key]["execution_time"] for key in keys])
+        if test_median <= 0:
+            continue
+        for key in keys:
+            position = by_test[test][key].get("position")
+            if position is not None:
+                position_ratios.setdefault(position, []).append(
+                    by_test[test][key]["execution_time"] / test_median
+                )
+
+    return {
+        "solutions": len(keys),
+        "compared_tests": len(common),
+        "significance_level": SIGNIFICANCE_LEVEL,
+        "ranking": standings,
+        "comparisons": comparisons,
+        "output_disagreements": sorted(disagreements),
+        "position_effect": {
+            str(position): sum(ratios) / len(ratios)
+            for position, ratios in sorted(position_ratios.items())
+        },
+    }
@@ -0,0 +1,462 @@
+"""
+Persistent JVM runner for Java solutions.
+
+JVM startup and JIT warmup (100-300 ms) dwarf the runtime of small tests.
+WarmJvmPool keeps a few JVMs running the WarmRunner helper
+(resources/java/WarmRunner.java), each of which loads the solution class
+and invokes its main() per test in a fresh classloader. Test streams are
+named pipes, so WarmJavaProcess offers the same Popen subset as
+WarmProcess (pipes, pid, poll, wait, kill, communicate).
+
+System streams are global inside a JVM, so every JVM runs one test at a
+time; the pool holds one JVM per worker thread. Each finished test reports
+the in-JVM time of main() and whether it was the first (cold) invocation of
+its JVM, so warm and cold timings can be told apart.
+
+POSIX only (named pipes); the per-test CTS_SEED is forwarded as the
+`cts.seed` system property because a running JVM cannot change its environment.
+"""
+
+import errno
+import logging
+import os
+import queue
+import select
+import shutil
+import signal
+import subprocess
+import tempfile
+import threading
+import time
+from typing import Any, Dict, List, Optional
+
+from src.app.shared.constants.paths import USER_DATA_DIR
+
+logger = logging.getLogger(__name__)
+
+RUNNER_SOURCE = os.path.normpath(
+    os.path.join(
+        os.path.dirname(os.path.abspath(__file__)),
+        "..", "..", "..", "resources", "java", "WarmRunner.java",
+    )
+)
+RUNNER_CACHE_DIR = os.path.join(USER_DATA_DIR, "cache", "java")
+RUNNER_CLASS = "WarmRunner"
+
+# JVM options that must not reach the runner (archives are tied to the class path)
+_RUNNER_EXCLUDED_OPTIONS = ("-XX:SharedArchiveFile=",)
+
+
+def warm_jvm_supported() -> bool:
+    """Check whether the platform supports the persistent JVM runner."""
+    return hasattr(os, "mkfifo")
+
+
+def ensure_runner_compiled(javac: str = "javac", timeout: int = 60) -> Optional[str]:
+    """
+    Compile WarmRunner.java into the user cache if needed.
+
+    Args:
+        javac: Java compiler executable
+        timeout: Compilation timeout in seconds
+
+    Returns:
+        Optional[str]: Directory containing WarmRunner.class, or None on failure
+    """
+    class_file = os.path.join(RUNNER_CACHE_DIR, f"{RUNNER_CLASS}.class")
+    try:
+        if os.path.getmtime(class_file) >= os.path.getmtime(RUNNER_SOURCE):
+            return RUNNER_CACHE_DIR
+    except OSError:
+        pass
+
+    os.makedirs(RUNNER_CACHE_DIR, exist_ok=True)
+    try:
+        result = subprocess.run(
+            [javac, "-d", RUNNER_CACHE_DIR, RUNNER_SOURCE],
+            stdout=subprocess.PIPE,
+            stderr=subprocess.PIPE,
+            text=True,
+            timeout=timeout,
+        )
+    except (OSError, subprocess.TimeoutExpired) as e:
+        logger.warning(f"Could not compile the persistent JVM runner: {e}")
+        return None
+
+    if result.returncode != 0:
+        logger.warning(f"Could not compile the persistent JVM runner: {result.stderr}")
+        return None
+    return RUNNER_CACHE_DIR
+
+
+class _JvmSlot:
+    """One running JVM with its control channel."""
+
+    def __init__(self, command: List[str]):
+        start = time.perf_counter()
+        self.process = subprocess.Popen(
+            command,
+            stdin=subprocess.PIPE,
+            stdout=subprocess.PIPE,
+            stderr=subprocess.DEVNULL,
+        )
+        self.startup_time: Optional[float] = None
+        self._buffer = b""
+        self._start = start
+
+    def wait_ready(self, timeout: float) -> bool:
+        line = self.read_line(timeout)
+        if line == "READY":
+            self.startup_time = time.perf_counter() - self._start
+            return True
+        return False
+
+    @property
+    def alive(self) -> bool:
+        return self.process.poll() is None
+
+    def send(self, line: str) -> None:
+        self.process.stdin.write(line.encode("utf-8") + b"\n")
+        self.process.stdin.flush()
+
+    def read_line(self, timeout: Optional[float]) -> Optional[str]:
+        """
+        Read one control line.
+
+        Returns:
+            The line, "" if the timeout expired, or None on EOF (JVM exited)
+        """
+        deadline = None if timeout is None else time.perf_counter() + timeout
+        fd = self.process.stdout.fileno()
+        while b"\n" not in self._buffer:
+            remaining = None if deadline is None else max(0.0, deadline - time.perf_counter())
+            readable, _, _ = select.select([fd], [], [], remaining)
+            if not readable:
+                return ""
+            chunk = os.read(fd, 4096)
+            if not chunk:
+                return None
+            self._buffer += chunk
+        line, self._buffer = self._buffer.split(b"\n", 1)
+        return line.decode("utf-8").strip()
+
+    def close(self) -> None:
+        try:
+            self.process.stdin.close()
+            self.process.wait(timeout=2)
+        except Exception:
+            self.process.kill()
+            try:
+                self.process.wait(timeout=1)
+            except Exception:
+                pass
+        try:
+            self.process.stdout.close()
+        except Exception:
+            pass
+
+
+class WarmJavaProcess:
+    """Popen-like handle of one main() invocation inside a warm JVM."""
+
+    def __init__(self, pool: "WarmJvmPool", slot: _JvmSlot, args: List[str], fifo_dir: str, stdin, stdout, stderr):
+        self.args = args
+        self.pid = slot.process.pid
+        self.stdin = stdin
+        self.stdout = stdout
+        self.stderr = stderr
+        self.returncode: Optional[int] = None
+        self.warm_timing: Optional[Dict[str, Any]] = None
+        self._pool = pool
+        self._slot = slot
+        self._fifo_dir = fifo_dir
+        self._lock = threading.Lock()
+
+    def _finish(self, returncode: int, timing: Optional[Dict[str, Any]] = None) -> None:
+        self.returncode = returncode
+        self.warm_timing = timing
+        shutil.rmtree(self._fifo_dir, ignore_errors=True)
+        self._pool._release(self._slot)
+
+    def _read_status(self, timeout: Optional[float]) -> bool:
+        with self._lock:
+            if self.returncode is not None:
+                return True
+
+            line = self._slot.read_line(timeout)
+            if line == "":
+                return False
+
+            if line is None:
+                # JVM ended (System.exit() or killed): its exit status is the test's
+                try:
+                    code = self._slot.process.wait(timeout=5)
+                except subprocess.TimeoutExpired:
+                    self._slot.process.kill()
+                    code = -signal.SIGKILL
+                self._finish(code)
+                return True
+
+            parts = line.split("\t")
+            if parts[0] != "DONE" or len(parts) < 4:
+                logger.warning(f"Unexpected message from persistent JVM: {line}")
+                self._slot.process.kill()
+                self._slot.process.wait()
+                self._finish(-signal.SIGKILL)
+                return True
+
+            self._finish(
+                int(parts[1]),
+                {
+                    "mode": "warm_jvm",
+                    "main_time": int(parts[2]) / 1e9,
+                    "invocation": int(parts[3]),
+                    "cold": int(parts[3]) == 1,
+                    "jvm_startup_time": self._slot.startup_time,
+                },
+            )
+            return True
+
+    def poll(self) -> Optional[int]:
+        self._read_status(0)
+        return self.returncode
+
+    def wait(self, timeout: Optional[float] = None) -> int:
+        if not self._read_status(timeout):
+            raise subprocess.TimeoutExpired(self.args, timeout)
+        return self.returncode
+
+    def kill(self) -> None:
+        # main() cannot be interrupted safely - the whole JVM goes away
+        if self.returncode is None:
+            self._slot.process.kill()
+
+    terminate = kill
+
+    def communicate(self, input: Optional[str] = None, timeout: Optional[float] = None):
+        """Write input, read both pipes to EOF and wait (like Popen.communicate)."""
+        results: Dict[str, str] = {}
+
+        def drain(name, stream):
+            results[name] = stream.read() if stream else None
+
+        readers = [
+            threading.Thread(target=drain, args=(name, stream), daemon=True)
+            for name, stream in (("stdout", self.stdout), ("stderr", self.stderr))
+        ]
+        for reader in readers:
+            reader.start()
+
+        if self.stdin:
+            try:
+                if input:
+                    self.stdin.write(input)
+                self.stdin.close()
+            except BrokenPipeError:
+                pass
+
+        deadline = None if timeout is None else time.time() + timeout
+        for reader in readers:
+            reader.join(None if deadline is None else max(0.0, deadline - time.time()))
+            if reader.is_alive():
+                raise subprocess.TimeoutExpired(self.args, timeout)
+
+        self.wait(None if deadline is None else max(0.0, deadline - time.time()))
+        return results.get("stdout"), results.get("stderr")
+
+
+class WarmJvmPool:
+    """
+    Pool of persistent JVMs for one Java role.
+
+    Usage:
+        pool = WarmJvmPool(["java", "-cp", "/ws/benchmarker", "Test"], size=4)
+        if pool.start():
+            process = pool.spawn(stdin=subprocess.PIPE)
+        ...
+        pool.close()
+    """
+
+    def __init__(
+        self,
+        command: List[str],
+        size: int = 1,
+        runner_command: Optional[List[str]] = None,
+        startup_timeout: float = 30.0,
+    ):
+        """
+        Args:
+            command: Regular execution command ([java, *options, -cp, dir, Class])
+            size: Number of JVMs (one test runs per JVM at a time)
+            runner_command: Command starting a runner (default: WarmRunner with
+                            the solution's JVM options)
+            startup_timeout: Seconds to wait for a JVM to load the class
+        """
+        self.command = command
+        self.size = max(1, size)
+        self.startup_timeout = startup_timeout
+        self._runner_command = runner_command
+        self._idle: "queue.Queue[_JvmSlot]" = queue.Queue()
+        self._slots: List[_JvmSlot] = []
+        self._slots_lock = threading.Lock()
+        self._closed = False
+
+    def _build_runner_command(self) -> Optional[List[str]]:
+        runtime = self.command[0]
+        class_dir, class_name = self.command[-2], self.command[-1]
+        options = [
+            option
+            for option in self.command[1:-3]
+            if not option.startswith(_RUNNER_EXCLUDED_OPTIONS)
+        ]
+
+        runtime_dir = os.path.dirname(runtime)
+        javac = os.path.join(runtime_dir, "javac") if runtime_dir else "javac"
+        runner_dir = ensure_runner_compiled(javac)
+        if runner_dir is None:
+            return None
+        return [runtime, *options, "-cp", runner_dir, RUNNER_CLASS, class_dir, class_name]
+
+    def _new_slot(self) -> Optional[_JvmSlot]:
+        try:
+            slot = _JvmSlot(self._runner_command)
+        except OSError as e:
+            logger.warning(f"Could not start persistent JVM: {e}")
+            return None
+        if not slot.wait_ready(self.startup_timeout):
+            slot.close()
+            return None
+        with self._slots_lock:
+            self._slots.append(slot)
+        return slot
+
+    def start(self) -> bool:
+        """
+        Start the JVMs and wait until each has loaded the solution class.
+
+        Returns:
+            bool: True if the pool is usable; False means callers should fall
+                  back to a fresh JVM per test
+        """
+        if not warm_jvm_supported():
+            return False
+        if self._runner_command is None:
+            self._runner_command = self._build_runner_command()
+            if self._runner_command is None:
+                return False
+
+        for _ in range(self.size):
+            slot = self._new_slot()
+            if slot is None:
+                logger.warning("Persistent JVM failed to start, using a fresh JVM per test")
+                self.close()
+                return False
+            self._idle.put(slot)
+        return True
+
+    def _acquire(self) -> _JvmSlot:
+        slot = self._idle.get()
+        if slot.alive:
+            return slot
+
+        # Replace JVMs that ended through System.exit() or a kill
+        with self._slots_lock:
+            if slot in self._slots:
+                self._slots.remove(slot)
+        slot.close()
+        replacement = self._new_slot()
+        if replacement is None:
+            self._idle.put(slot)  # Keep the pool size so other threads don't block forever
+            raise OSError("persistent JVM could not be restarted")
+        return replacement
+
+    def _release(self, slot: _JvmSlot) -> None:
+        if not self._closed:
+            self._idle.put(slot)
+
+    def spawn(
+        self,
+        stdin=None,
+        env: Optional[Dict[str, str]] = None,
+        args: Optional[List[str]] = None,
+    ) -> WarmJavaProcess:
+        """
+        Run the solution's main() once in a warm JVM.
+
+        Args:
+            stdin: subprocess.PIPE to get a writable stdin, otherwise empty input
+            env: Environment; only CTS_SEED is forwarded (as cts.seed)
+            args: Arguments passed to main()
+
+        Returns:
+            WarmJavaProcess: Handle with text-mode stdin/stdout/stderr pipes
+        """
+        slot = self._acquire()
+        fifo_dir = tempfile.mkdtemp(prefix="cts_jvm_")
+        paths = [os.path.join(fifo_dir, name) for name in ("stdin", "stdout", "stderr")]
+        handles = []
+        try:
+            for path in paths:
+                os.mkfifo(path, 0o600)
+
+            seed = (env or {}).get("CTS_SEED", "")
+            slot.send("\t".join(["RUN", *paths, seed, *(args or [])]))
+
+            # Readers first (non-blocking open never waits for the JVM) ...
+            out_fd = os.open(paths[1], os.O_RDONLY | os.O_NONBLOCK)
+            handles.append(out_fd)
+            err_fd = os.open(paths[2], os.O_RDONLY | os.O_NONBLOCK)
+            handles.append(err_fd)
+
+            # ... then the writer, which succeeds once the JVM has opened stdin
+            in_fd = self._open_writer(paths[0], slot)
+            handles.append(in_fd)
+
+            # Only read after the JVM holds the write ends, otherwise we'd see EOF
+            if slot.read_line(self.startup_timeout) != "STARTED":
+                raise OSError("persistent JVM did not start the test")
+
+            for fd in (out_fd, err_fd, in_fd):
+                os.set_blocking(fd, True)
+        except Exception:
+            for fd in handles:
+                os.close(fd)
+            shutil.rmtree(fifo_dir, ignore_errors=True)
+            slot.process.kill()
+            self._release(slot)
+            raise
+
+        stdin_stream = open(in_fd, "w")
+        if stdin != subprocess.PIPE:
+            stdin_stream.close()
+            stdin_stream = None
+
+        return WarmJavaProcess(
+            self,
+            slot,
+            self.command + list(args or []),
+            fifo_dir,
+            stdin_stream,
+            open(out_fd, "r"),
+            open(err_fd, "r"),
+        )
+
+    def _open_writer(self, path: str, slot: _JvmSlot) -> int:
+        deadline = time.perf_counter() + self.startup_timeout
+        while True:
+            try:
+                return os.open(path, os.O_WRONLY | os.O_NONBLOCK)
+            except OSError as e:
+                if e.errno != errno.ENXIO:
+                    raise
+            if not slot.alive or time.perf_counter() > deadline:
+                raise OSError("persistent JVM did not open the test input")
+            time.sleep(0.0005)
+
+    def close(self) -> None:
+        """Shut down all JVMs."""
+        self._closed = True
+        with self._slots_lock:
+            slots, self._slots = self._slots, []
+        for slot in slots:
+            slot.close()
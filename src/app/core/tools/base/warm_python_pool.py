@@ -0,0 +1,291 @@
+"""
+Warm interpreter pool for Python solutions.
+
+Starting a Python interpreter and importing the solution costs 20-40 ms per
+test, which dominates small stress tests. A WarmInterpreter keeps one
+interpreter per solution alive (see warm_python_server.py) and forks a child
+per test instead; WarmProcess exposes the child with the subset of the
+subprocess.Popen API the test workers use (pipes, pid, poll, wait, kill,
+communicate), so psutil memory tracking keeps working unchanged.
+
+Requires fork() and Unix sockets with fd passing; warm_pool_supported()
+reports whether the current platform qualifies.
+"""
+
+import json
+import logging
+import os
+import select
+import shutil
+import signal
+import socket
+import struct
+import subprocess
+import tempfile
+import threading
+import time
+from typing import Dict, List, Optional
+
+logger = logging.getLogger(__name__)
+
+SERVER_SCRIPT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "warm_python_server.py")
+
+_HEADER = struct.Struct("<I")
+_STATUS = struct.Struct("<i")
+
+
+def warm_pool_supported() -> bool:
+    """Check whether the platform supports forked warm interpreters."""
+    return (
+        hasattr(os, "fork")
+        and hasattr(socket, "AF_UNIX")
+        and hasattr(socket, "send_fds")
+    )
+
+
+class WarmProcess:
+    """
+    Popen-like handle of a test process forked from a warm interpreter.
+
+    The exit status arrives on the control connection once the server has
+    reaped the child; returncode follows the Popen convention (-signal for
+    killed processes).
+    """
+
+    def __init__(self, args: List[str], pid: int, conn: socket.socket, stdin, stdout, stderr):
+        self.args = args
+        self.pid = pid
+        self.stdin = stdin
+        self.stdout = stdout
+        self.stderr = stderr
+        self.returncode: Optional[int] = None
+        self._conn = conn
+
+    def _read_status(self, timeout: Optional[float]) -> bool:
+        """Read the exit status if it arrives within timeout."""
+        if self.returncode is not None:
+            return True
+
+        readable, _, _ = select.select([self._conn], [], [], timeout)
+        if not readable:
+            return False
+
+        data = b""
+        while len(data) < _STATUS.size:
+            chunk = self._conn.recv(_STATUS.size - len(data))
+            if not chunk:
+                break
+            data += chunk
+
+        # A closed connection without status means the server went away
+        self.returncode = _STATUS.unpack(data)[0] if len(data) == _STATUS.size else -signal.SIGKILL
+        self._conn.close()
+        return True
+
+    def poll(self) -> Optional[int]:
+        self._read_status(0)
+        return self.returncode
+
+    def wait(self, timeout: Optional[float] = None) -> int:
+        if not self._read_status(timeout):
+            raise subprocess.TimeoutExpired(self.args, timeout)
+        return self.returncode
+
+    def send_signal(self, sig: int) -> None:
+        if self.returncode is None:
+            try:
+                os.kill(self.pid, sig)
+            except ProcessLookupError:
+                pass
+
+    def kill(self) -> None:
+        self.send_signal(signal.SIGKILL)
+
+    def terminate(self) -> None:
+        self.send_signal(signal.SIGTERM)
+
+    def communicate(self, input: Optional[str] = None, timeout: Optional[float] = None):
+        """Write input, read both pipes to EOF and wait (like Popen.communicate)."""
+        results: Dict[str, str] = {}
+
+        def drain(name, stream):
+            results[name] = stream.read() if stream else None
+
+        readers = [
+            threading.Thread(target=drain, args=(name, stream), daemon=True)
+            for name, stream in (("stdout", self.stdout), ("stderr", self.stderr))
+        ]
+        for reader in readers:
+            reader.start()
+
+        if self.stdin:
+            try:
+                if input:
+                    self.stdin.write(input)
+                self.stdin.close()
+            except BrokenPipeError:
+                pass
+
+        deadline = None if timeout is None else time.time() + timeout
+        for reader in readers:
+            reader.join(None if deadline is None else max(0.0, deadline - time.time()))
+            if reader.is_alive():
+                raise subprocess.TimeoutExpired(self.args, timeout)
+
+        self.wait(None if deadline is None else max(0.0, deadline - time.time()))
+        return results.get("stdout"), results.get("stderr")
+
+
+class WarmInterpreter:
+    """
+    One warm interpreter (fork server) for a Python solution.
+
+    Usage:
+        warm = WarmInterpreter(["pypy3", "-u", "test.py"])
+        if warm.start():
+            process = warm.spawn(stdin=subprocess.PIPE)
+        ...
+        warm.close()
+    """
+
+    def __init__(self, command: List[str], startup_timeout: float = 10.0):
+        """
+        Args:
+            command: Regular execution command ([interpreter, *flags, script])
+            startup_timeout: Seconds to wait for the server to become ready
+        """
+        self.command = command
+        self.interpreter = command[0]
+        self.source = command[-1]
+        self.startup_timeout = startup_timeout
+
+        self._server: Optional[subprocess.Popen] = None
+        self._socket_dir: Optional[str] = None
+        self._socket_path: Optional[str] = None
+
+    @property
+    def is_running(self) -> bool:
+        return self._server is not None and self._server.poll() is None
+
+    def start(self) -> bool:
+        """
+        Start the server and wait until the solution is compiled and warm.
+
+        Returns:
+            bool: True if the server is ready; False means callers should fall
+                  back to launching the interpreter per test
+        """
+        if not warm_pool_supported():
+            return False
+
+        self._socket_dir = tempfile.mkdtemp(prefix="cts_warm_")
+        self._socket_path = os.path.join(self._socket_dir, "server.sock")
+
+        try:
+            self._server = subprocess.Popen(
+                [self.interpreter, SERVER_SCRIPT, self.source, self._socket_path],
+                stdin=subprocess.PIPE,
+                stdout=subprocess.PIPE,
+                stderr=subprocess.PIPE,
+            )
+        except OSError as e:
+            logger.warning(f"Could not start warm interpreter {self.interpreter}: {e}")
+            self.close()
+            return False
+
+        readable, _, _ = select.select([self._server.stdout], [], [], self.startup_timeout)
+        if readable and self._server.stdout.readline().strip() == b"ready":
+            logger.debug(f"Warm interpreter ready for {os.path.basename(self.source)}")
+            return True
+
+        error = ""
+        if self._server.poll() is not None:
+            error = self._server.stderr.read().decode(errors="replace").strip()
+        logger.warning(
+            f"Warm interpreter for {os.path.basename(self.source)} failed to start: "
+            f"{error or 'timeout'}"
+        )
+        self.close()
+        return False
+
+    def spawn(
+        self,
+        stdin=None,
+        env: Optional[Dict[str, str]] = None,
+        args: Optional[List[str]] = None,
+    ) -> WarmProcess:
+        """
+        Fork a fresh child of the warm interpreter for one test.
+
+        Args:
+            stdin: subprocess.PIPE to get a writable stdin, otherwise /dev/null
+            env: Environment of the child (None = inherit the server's)
+            args: Extra command line arguments (sys.argv[1:] of the child)
+
+        Returns:
+            WarmProcess: Handle with text-mode stdin/stdout/stderr pipes
+        """
+        if stdin == subprocess.PIPE:
+            child_stdin, parent_stdin = os.pipe()
+        else:
+            child_stdin, parent_stdin = os.open(os.devnull, os.O_RDONLY), None
+        parent_stdout, child_stdout = os.pipe()
+        parent_stderr, child_stderr = os.pipe()
+        child_fds = [child_stdin, child_stdout, child_stderr]
+
+        conn = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        try:
+            conn.connect(self._socket_path)
+            payload = json.dumps(
+                {"env": dict(env) if env is not None else None, "argv": list(args or [])}
+            ).encode("utf-8")
+            socket.send_fds(conn, [_HEADER.pack(len(payload)) + payload], child_fds)
+
+            data = b""
+            while len(data) < _HEADER.size:
+                chunk = conn.recv(_HEADER.size - len(data))
+                if not chunk:
+                    raise OSError("warm interpreter closed the connection")
+                data += chunk
+            (pid,) = _HEADER.unpack(data)
+        except OSError:
+            conn.close()
+            for fd in (parent_stdin, parent_stdout, parent_stderr):
+                if fd is not None:
+                    os.close(fd)
+            raise
+        finally:
+            for fd in child_fds:
+                os.close(fd)
+
+        return WarmProcess(
+            self.command + list(args or []),
+            pid,
+            conn,
+            open(parent_stdin, "w") if parent_stdin is not None else None,
+            open(parent_stdout, "r"),
+            open(parent_stderr, "r"),
+        )
+
+    def close(self) -> None:
+        """Shut down the server and remove its socket."""
+        if self._server is not None:
+            try:
+                self._server.stdin.close()  # EOF makes the server exit
+                self._server.wait(timeout=2)
+            except Exception:
+                self._server.kill()
+                try:
+                    self._server.wait(timeout=1)
+                except Exception:
+                    pass
+            for stream in (self._server.stdout, self._server.stderr):
+                try:
+                    stream.close()
+                except Exception:
+                    pass
+            self._server = None
+
+        if self._socket_dir:
+            shutil.rmtree(self._socket_dir, ignore_errors=True)
+            self._socket_dir = None
@@ -0,0 +1,229 @@
+"""
+Warm Python interpreter server (fork server) for Python solutions.
+
+This script is started once per Python solution with the configured
+interpreter (CPython or PyPy) and must only use the standard library:
+
+    <interpreter> warm_python_server.py <solution.py> <socket_path>
+
+It compiles the solution once, pre-imports modules commonly used by
+competitive programming solutions and then waits on a Unix socket. For
+every test the client sends its stdin/stdout/stderr pipe ends (SCM_RIGHTS)
+plus the environment; the server forks a child that runs the pre-compiled
+code with those pipes as fds 0/1/2. The client receives the child's pid
+right away and its exit status once the child has been reaped.
+
+Protocol (all integers little-endian):
+    client -> server: fds [stdin, stdout, stderr] + 4-byte length
+                      + JSON {"env": {...} | null, "argv": [...]}
+    server -> client: 4-byte pid, later 4-byte signed return code (Popen convention)
+
+The server exits when its own stdin reaches EOF (i.e. the owner went away).
+"""
+
+import builtins
+import json
+import os
+import select
+import signal
+import socket
+import struct
+import sys
+import traceback
+
+# Imported once in the server so forked children get them for free
+WARM_MODULES = (
+    "bisect",
+    "collections",
+    "functools",
+    "heapq",
+    "itertools",
+    "math",
+    "random",
+    "re",
+    "string",
+    "typing",
+)
+
+_HEADER = struct.Struct("<I")
+_STATUS = struct.Struct("<i")
+
+
+def _recv_exact(conn, size):
+    data = b""
+    while len(data) < size:
+        chunk = conn.recv(size - len(data))
+        if not chunk:
+            raise ConnectionError("client closed connection")
+        data += chunk
+    return data
+
+
+def _receive_request(conn):
+    """Receive the pipe fds and the JSON payload of a spawn request."""
+    data, fds, _flags, _addr = socket.recv_fds(conn, 65536, 3)
+    if len(fds) != 3:
+        for fd in fds:
+            os.close(fd)
+        raise ConnectionError("expected 3 file descriptors")
+
+    while len(data) < _HEADER.size:
+        data += _recv_exact(conn, _HEADER.size - len(data))
+    (length,) = _HEADER.unpack(data[: _HEADER.size])
+    payload = data[_HEADER.size :]
+    if len(payload) < length:
+        payload += _recv_exact(conn, length - len(payload))
+
+    return fds, json.loads(payload.decode("utf-8"))
+
+
+def _run_solution(code, source):
+    """Execute the solution in the child and return its exit code."""
+    namespace = {
+        "__name__": "__main__",
+        "__file__": source,
+        "__builtins__": builtins,
+    }
+    exit_code = 0
+    try:
+        exec(code, namespace)
+    except SystemExit as e:
+        if e.code is None:
+            exit_code = 0
+        elif isinstance(e.code, int):
+            exit_code = e.code
+        else:
+            print(e.code, file=sys.stderr)
+            exit_code = 1
+    except BaseException:
+        traceback.print_exc()
+        exit_code = 1
+
+    for stream in (sys.stdout, sys.stderr):
+        try:
+            stream.flush()
+        except Exception:
+            exit_code = exit_code or 1
+    return exit_code
+
+
+def _child(code, source, fds, request, close_fds):
+    """Body of the forked child: rewire stdio and run the solution."""
+    signal.set_wakeup_fd(-1)
+    signal.signal(signal.SIGCHLD, signal.SIG_DFL)
+    for fd in close_fds:
+        try:
+            os.close(fd)
+        except OSError:
+            pass
+
+    for target, fd in enumerate(fds):
+        os.dup2(fd, target)
+        os.close(fd)
+
+    env = request.get("env")
+    if env is not None:
+        os.environ.clear()
+        os.environ.update(env)
+
+    sys.stdin = open(0, "r", closefd=False)
+    sys.stdout = open(1, "w", closefd=False)
+    sys.stderr = open(2, "w", closefd=False)
+    sys.argv = [source] + list(request.get("argv", []))
+
+    os._exit(_run_solution(code, source))
+
+
+def main():
+    source, socket_path = sys.argv[1], sys.argv[2]
+
+    with open(source, "rb") as f:
+        code = compile(f.read(), source, "exec")
+
+    sys.path.insert(0, os.path.dirname(os.path.abspath(source)))
+    for name in WARM_MODULES:
+        try:
+            __import__(name)
+        except ImportError:
+            pass
+
+    listener = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+    listener.bind(socket_path)
+    listener.listen(64)
+
+    # Self-pipe: SIGCHLD wakes up select() so exits are reported immediately
+    wake_r, wake_w = os.pipe()
+    os.set_blocking(wake_r, False)
+    os.set_blocking(wake_w, False)
+    signal.set_wakeup_fd(wake_w)
+    signal.signal(signal.SIGCHLD, lambda signum, frame: None)
+
+    children = {}  # pid -> client connection waiting for the exit status
+
+    sys.stdout.write("ready\n")
+    sys.stdout.flush()
+
+    while True:
+        try:
+            readable, _, _ = select.select([listener, wake_r, sys.stdin], [], [])
+        except InterruptedError:
+            continue
+
+        if sys.stdin in readable and not os.read(sys.stdin.fileno(), 1):
+            break  # Owner closed our stdin - shut down
+
+        if wake_r in readable:
+            try:
+                while os.read(wake_r, 512):
+                    pass
+            except BlockingIOError:
+                pass
+
+        # Reap every finished child and report its status
+        while children:
+            try:
+                pid, status = os.waitpid(-1, os.WNOHANG)
+            except ChildProcessError:
+                break
+            if pid == 0:
+                break
+            conn = children.pop(pid, None)
+            if conn is not None:
+                try:
+                    conn.sendall(_STATUS.pack(os.waitstatus_to_exitcode(status)))
+                except OSError:
+                    pass
+                conn.close()
+
+        if listener in readable:
+            conn, _ = listener.accept()
+            try:
+                fds, request = _receive_request(conn)
+            except (ConnectionError, OSError, ValueError):
+                conn.close()
+                continue
+
+            pid = os.fork()
+            if pid == 0:
+                close_fds = [listener.fileno(), conn.fileno(), wake_r, wake_w]
+                close_fds += [c.fileno() for c in children.values()]
+                _child(code, source, fds, request, close_fds)
+
+            for fd in fds:
+                os.close(fd)
+            children[pid] = conn
+            try:
+                conn.sendall(_HEADER.pack(pid))
+            except OSError:
+                pass
+
+    for pid in list(children):
+        try:
+            os.kill(pid, signal.SIGKILL)
+        except OSError:
+            pass
+    listener.close()
+
+
+if __name__ == "__main__":
+    main()
@@ -5,7 +5,57 @@ This module has been refactored as part of Phase 4 migration to inherit
 from BaseRunner, eliminating ~100 lines of duplicate runner code while
 maintaining 100% API compatibility.
 
-Also contains BenchmarkCompilerRunner for specialized compilation handling.
+BenchmarkCompilerRunner, the editor's compiler runner for benchmarking,
+lives in compiler_runner.py and is still importable from here.
+
+Allocation profiling (config["benchmarker"]["alloc_profile"]) preloads a
+malloc/new interposer into C++ test solutions and reports allocation
+counts, peak live bytes and the top call sites per test.
+
+Sampling profiles (config["benchmarker"]["profile_slowest"] = K) re-run the
+inputs of the K slowest tests under a SIGPROF sampler against a build of the
+test solution with debug info and frame pointers; each profiled test gets
+collapsed stacks (flamegraph input) and its hottest functions and lines.
+
+On Linux every test also gets a syscall I/O profile (read/write calls and
+bytes, kernel vs user time) with warnings about tiny-chunk output.
+
+Timing modes (config["benchmarker"]["timing_mode"]) judge tests by wall
+time (default), CPU time, or retired instructions converted to seconds at
+config["benchmarker"]["reference_instructions_per_second"], for stable
+results on loaded machines.
+
+Tournament mode (enable_tournament()) benchmarks further solutions against
+the test solution: every input is generated once and run through all
+solutions in a shuffled order, and the analysis ranks them by time and
+memory with paired significance tests.
+
+Differential mode (enable_differential()) builds the test solution under
+the flag profiles of config["benchmarker"]["differential_profiles"] (-O0,
+-O3, without -march=native, clang++ by default) and runs every build on
+the same inputs; output mismatches and crashes against the regular build
+point at undefined behaviour, time ratios at flag sensitivity.
+
+Autotuning (enable_autotune()) searches a curated flag space for the test
+solution with successive halving and reports the fastest flag set with a
+confidence interval; save_flag_overrides() stores it for the source file.
+
+Allocator experiments (enable_allocator_experiments()) run the test
+solution on every input under the allocators installed locally (jemalloc,
+mimalloc, tcmalloc via LD_PRELOAD) and with transparent huge pages toggled;
+the spread of their times shows whether the solution is allocator-bound.
+
+Calibration (config["benchmarker"]["calibrate"]) times a micro-kernel suite
+locally and compares it with config["benchmarker"]["reference_profile"],
+measured on the judge machine (save_reference_profile()); time limits are
+scaled by the speed factor of the workload class
+(config["benchmarker"]["workload_class"]) and the analysis predicts the
+judge time of the slowest test.
+
+On Linux every test runs on its own physical core (one hardware thread,
+SMT siblings idle, memory bound to the core's NUMA node); the topology
+used is recorded in the analysis. config["benchmarker"]["cpu_pinning"] =
+False lets the kernel place tests freely.
 """
 
 import json
@@ -13,78 +63,61 @@ import logging
 import os
 from datetime import datetime
 
-from PySide6.QtCore import Signal
-
+from src.app.core.tools.base.alloc_profiler import (
+    alloc_profiler_supported,
+    ensure_profiler_built,
+    summarize_allocations,
+)
+from src.app.core.tools.base.allocators import (
+    VARIANT_SEPARATOR,
+    allocator_variants,
+    summarize_allocators,
+)
+from src.app.core.tools.base.autotune import FLAG_SPACE, summarize_autotune
 from src.app.core.tools.base.base_runner import BaseRunner
-from src.app.core.tools.compiler_runner import CompilerRunner
+from src.app.core.tools.base.calibration import (
+    DEFAULT_WORKLOAD_CLASS,
+    WORKLOAD_CLASSES,
+    measure_machine_profile,
+    summarize_calibration,
+)
+from src.app.core.tools.base.concurrency import AdaptiveConcurrency
+from src.app.core.tools.base.cpu_topology import CorePool, create_core_pool
+from src.app.core.tools.base.differential import (
+    DEFAULT_PROFILES,
+    available_profiles,
+    profile_variant,
+    summarize_differential,
+)
+from src.app.core.tools.base.hdr_histogram import ResourceHistograms
+from src.app.core.tools.base.instruction_counter import (
+    DEFAULT_REFERENCE_IPS,
+    DEFAULT_TIMING_MODE,
+    TIMING_MODES,
+    counter_supported,
+    ensure_counter_built,
+    summarize_timing,
+)
+from src.app.core.tools.base.io_profile import summarize_io_results
+from src.app.core.tools.base.language_detector import Language
+from src.app.core.tools.base.process_limits import ensure_launcher_built
+from src.app.core.tools.base.qt_compat import Signal
+from src.app.core.tools.base.sample_profiler import (
+    DEFAULT_PROFILE_COUNT,
+    PROFILE_BUILD_FLAGS,
+    ensure_sampler_built,
+    sampling_profiler_supported,
+    summarize_profiles,
+)
+from src.app.core.tools.base.tournament import summarize_tournament
+from src.app.core.tools.specialized.autotune_test_worker import AutotuneTestWorker
 from src.app.core.tools.specialized.benchmark_test_worker import BenchmarkTestWorker
+from src.app.core.tools.specialized.tournament_test_worker import TournamentTestWorker
 from src.app.database import TestResult
 
 logger = logging.getLogger(__name__)
 
 
-class BenchmarkCompilerRunner(CompilerRunner):
-    """Specialized compiler runner for benchmarking"""
-
-    # Additional signals specific to benchmarking
-    compilationStarted = Signal()
-    compilationFinished = Signal(bool)  # True if successful
-    outputAvailable = Signal(str, str)  # message, type
-
-    def __init__(self, console_output):
-        # Initialize the base compiler runner (which already handles threading)
-        super().__init__(console_output)
-
-        # Connect additional signals for benchmark-specific behavior
-        if self.worker:
-            self.worker.output.connect(self._handle_output_for_benchmark)
-            self.worker.error.connect(self._handle_error_for_benchmark)
-
-        logger.debug("BenchmarkCompilerRunner initialized")
-
-    def _handle_output_for_benchmark(self, output_data):
-        """Handle output with benchmark-specific signals"""
-        if isinstance(output_data, tuple) and len(output_data) == 2:
-            text, format_type = output_data
-        else:
-            text, format_type = str(output_data), "default"
-
-        # Emit benchmark-specific signal
-        self.outputAvailable.emit(text, format_type)
-
-    def _handle_error_for_benchmark(self, error_data):
-        """Handle error with benchmark-specific signals"""
-        if isinstance(error_data, tuple) and len(error_data) == 2:
-            text, format_type = error_data
-        else:
-            text, format_type = str(error_data), "error"
-
-        # Emit benchmark-specific signal
-        self.outputAvailable.emit(text, format_type)
-
-    def compile_and_run_code(self, filepath):
-        """Compile and run code for benchmarking"""
-        logger.debug(f"Starting benchmark compilation for {filepath}")
-
-        # Emit TLE-specific signal
-        self.compilationStarted.emit()
-
-        # Connect to finished signal to emit compilation result
-        def on_finished():
-            # Assume success if we get here without errors
-            self.compilationFinished.emit(True)
-            self.finished.disconnect(on_finished)
-
-        self.finished.connect(on_finished)
-
-        # Use base class method
-        super().compile_and_run_code(filepath)
-
-    def stop(self):
-        """Stop any running process (alias for compatibility)"""
-        self.stop_execution()
-
-
 class Benchmarker(BaseRunner):
     """
     Main controller for benchmarking workflow.
@@ -113,6 +146,448 @@ class Benchmarker(BaseRunner):
         self.time_limit = 0
         self.memory_limit = 0
 
+        # Allocation profiling of the test solution (None: follow the config)
+        self.alloc_profile = None
+
+        # Slowest tests to re-run under the sampler (None: follow the config)
+        self.profile_slowest = None
+        self.profile_key = None
+
+        # Timing mode of the next runs (None: follow the config)
+        self.timing_mode = None
+
+        # Tournament solutions (key -> label), including 'test'; empty when off
+        self.tournament = {}
+
+        # Differential builds of the test solution (variant key -> profile name)
+        self.differential = {}
+
+        # Autotuning candidates (variant key -> flag set name, and overrides)
+        self.autotune = {}
+        self.autotune_overrides = {}
+
+        # Allocator/THP variant runs of the test solution (key -> variant
+        # name, and environment overrides)
+        self.allocators = {}
+        self.allocator_environments = {}
+
+        # Workload class of the next runs (None: follow the config), and the
+        # speed factors the last run was calibrated with
+        self.workload_class = None
+        self.calibration = None
+
+    def enable_allocation_profiling(self, enabled=True):
+        """
+        Profile allocations of the test solution in the next runs.
+
+        Args:
+            enabled: Whether to preload the allocation interposer
+
+        Returns:
+            bool: True if profiling is active (C++ test solution on Linux)
+        """
+        self.alloc_profile = enabled
+        return enabled and self._can_profile_allocations()
+
+    def _can_profile_allocations(self):
+        """The interposer only works for native solutions on Linux/glibc."""
+        return (
+            alloc_profiler_supported()
+            and self.compiler.file_languages.get("test") == Language.CPP
+        )
+
+    def _get_alloc_profiler(self):
+        """
+        Get the interposer library for this run.
+
+        Returns:
+            str or None: Library path, None if profiling is off or unavailable
+        """
+        enabled = self.alloc_profile
+        if enabled is None:
+            enabled = self.config.get("benchmarker", {}).get("alloc_profile", False)
+        if not enabled or not self._can_profile_allocations():
+            return None
+        compiler = (
+            self.config.get("languages", {}).get("cpp", {}).get("compiler", "g++")
+        )
+        library = ensure_profiler_built(compiler)
+        if library is None:
+            logger.warning("Allocation profiler unavailable, running without it")
+        return library
+
+    def enable_sampling_profile(self, count=DEFAULT_PROFILE_COUNT):
+        """
+        Profile the slowest tests of the next runs.
+
+        Registers the profiled build of the test solution; must be called
+        before compile_all() so it is compiled with the regular builds.
+
+        Args:
+            count: Number of slowest tests to profile (0 = off)
+
+        Returns:
+            bool: True if profiling is active (C++ test solution on Linux)
+        """
+        self.profile_slowest = count
+        return self._register_profile_build()
+
+    def _get_profile_count(self):
+        count = self.profile_slowest
+        if count is None:
+            count = self.config.get("benchmarker", {}).get("profile_slowest", 0)
+        return max(0, int(count or 0))
+
+    def _register_profile_build(self):
+        """Register the frame-pointer build used by the profiling post-pass."""
+        if self._get_profile_count() == 0 or not sampling_profiler_supported():
+            return False
+        if self.profile_key is None:
+            self.profile_key = self.compiler.add_build_variant(
+                "test", "profiled", {"extra_flags": PROFILE_BUILD_FLAGS}
+            )
+        return self.profile_key is not None
+
+    def compile_all(self, blocking=False):
+        """Compile all files, including the profiled build when profiling is on."""
+        self._register_profile_build()
+        return super().compile_all(blocking=blocking)
+
+    def _get_profile_options(self):
+        """
+        Get the worker arguments of the profiling post-pass.
+
+        Returns:
+            dict: profile_command, sampler and profile_count (empty if off)
+        """
+        count = self._get_profile_count()
+        if count == 0 or self.profile_key is None:
+            return {}
+        compiler = (
+            self.config.get("languages", {}).get("cpp", {}).get("compiler", "g++")
+        )
+        sampler = ensure_sampler_built(compiler)
+        if sampler is None:
+            logger.warning("Sampling profiler unavailable, skipping profiles")
+            return {}
+        return {
+            "profile_command": self.compiler.get_execution_command(self.profile_key),
+            "sampler": sampler,
+            "profile_count": count,
+        }
+
+    def set_timing_mode(self, mode):
+        """
+        Set the time tests are judged by in the next runs.
+
+        Args:
+            mode: 'wall', 'cpu' or 'instructions'
+
+        Raises:
+            ValueError: If the mode is unknown
+        """
+        if mode not in TIMING_MODES:
+            raise ValueError(f"Unknown timing mode: {mode}")
+        self.timing_mode = mode
+
+    def _get_timing_mode(self):
+        mode = self.timing_mode
+        if mode is None:
+            # Also called when saving results, where no config may be loaded
+            config = getattr(self, "config", None) or {}
+            mode = config.get("benchmarker", {}).get("timing_mode", DEFAULT_TIMING_MODE)
+        if mode not in TIMING_MODES:
+            logger.warning(f"Unknown timing mode '{mode}', timing by wall time")
+            return DEFAULT_TIMING_MODE
+        return mode
+
+    def _get_reference_ips(self):
+        config = getattr(self, "config", None) or {}
+        return config.get("benchmarker", {}).get(
+            "reference_instructions_per_second", DEFAULT_REFERENCE_IPS
+        )
+
+    def _get_timing_options(self):
+        """
+        Get the worker arguments of the timing mode.
+
+        Returns:
+            dict: timing_mode, reference_ips and the counter library for
+            native solutions in instruction mode (empty in wall mode)
+        """
+        mode = self._get_timing_mode()
+        if mode == DEFAULT_TIMING_MODE:
+            return {}
+        options = {"timing_mode": mode, "reference_ips": self._get_reference_ips()}
+        if (
+            mode == "instructions"
+            and counter_supported()
+            and self.compiler.file_languages.get("test") == Language.CPP
+        ):
+            counter = ensure_counter_built(self._get_cpp_compiler())
+            if counter is None:
+                logger.warning("Instruction counter unavailable, timing by CPU time")
+            else:
+                options["counter"] = counter
+        return options
+
+    def set_workload_class(self, workload_class):
+        """
+        Set the workload class time limits are calibrated for in the next runs.
+
+        Args:
+            workload_class: 'alu', 'latency', 'bandwidth', 'branchy' or 'mixed'
+
+        Raises:
+            ValueError: If the workload class is unknown
+        """
+        if workload_class not in WORKLOAD_CLASSES:
+            raise ValueError(f"Unknown workload class: {workload_class}")
+        self.workload_class = workload_class
+
+    def _get_workload_class(self):
+        workload_class = self.workload_class
+        if workload_class is None:
+            workload_class = self.config.get("benchmarker", {}).get(
+                "workload_class", DEFAULT_WORKLOAD_CLASS
+            )
+        if workload_class not in WORKLOAD_CLASSES:
+            logger.warning(f"Unknown workload class '{workload_class}', calibrating for mixed")
+            return DEFAULT_WORKLOAD_CLASS
+        return workload_class
+
+    def _get_cpp_compiler(self):
+        return self.config.get("languages", {}).get("cpp", {}).get("compiler", "g++")
+
+    def _get_calibration_reference(self):
+        """
+        Get the reference profile the next run is calibrated against.
+
+        Returns:
+            dict or None: Reference kernel profile; None when calibration is
+            off, no reference profile is configured, or tests are timed by
+            instructions (already converted at the reference rate)
+        """
+        settings = self.config.get("benchmarker", {})
+        reference = settings.get("reference_profile")
+        if not settings.get("calibrate") or not reference:
+            return None
+        if self._get_timing_mode() == "instructions":
+            return None
+        return reference
+
+    def save_reference_profile(self, profile=None, config_manager=None):
+        """
+        Save a kernel profile as the reference the time limits are calibrated against.
+
+        Run on the judge-like machine without arguments, this stores its own
+        profile; the config can then be shared with the other machines.
+
+        Args:
+            profile: Kernel -> seconds (default: measure this machine)
+            config_manager: Config persistence (default: ConfigManager.instance())
+
+        Returns:
+            dict or None: The saved profile, None if it could not be measured
+        """
+        if profile is None:
+            profile = measure_machine_profile(self._get_cpp_compiler())
+            if profile is None:
+                return None
+        if config_manager is None:
+            # Imported here: the config module pulls in Qt widgets
+            from src.app.core.config.core import ConfigManager
+
+            config_manager = ConfigManager.instance()
+        config = config_manager.load_config()
+        for target in (config, self.config):
+            target.setdefault("benchmarker", {})["reference_profile"] = dict(profile)
+        config_manager.save_config(config)
+        return dict(profile)
+
+    def enable_tournament(self, solution_files):
+        """
+        Benchmark further solutions against the test solution in the next runs.
+
+        The files are registered as solution_1, solution_2, ... and must be
+        added before compile_all() so they are compiled with the regular
+        builds. An empty list turns tournament mode off.
+
+        Args:
+            solution_files: Paths of the competing solution sources
+
+        Returns:
+            dict: Solution key -> label (file name), empty when off
+        """
+        self.tournament = {}
+        if not solution_files:
+            return self.tournament
+
+        self.tournament["test"] = os.path.basename(self.compiler.files["test"])
+        for index, path in enumerate(solution_files, start=1):
+            key = f"solution_{index}"
+            self.tournament[key] = os.path.basename(self.compiler.add_source(key, path))
+        return self.tournament
+
+    def enable_differential(self, profiles=None):
+        """
+        Run builds of the test solution under several flag profiles in the next runs.
+
+        Each profile is registered as a build variant, so it must be enabled
+        before compile_all(). Profiles whose compiler is not installed are
+        skipped; interpreted solutions have no profiles.
+
+        Args:
+            profiles: Profile name -> language config overrides (None: the
+                      configured differential_profiles, else DEFAULT_PROFILES);
+                      an empty dict turns differential mode off
+
+        Returns:
+            dict: Variant key -> profile name of the registered builds
+        """
+        if profiles is None:
+            profiles = self.config.get("benchmarker", {}).get(
+                "differential_profiles", DEFAULT_PROFILES
+            )
+
+        self.differential = {}
+        for name, overrides in available_profiles(profiles).items():
+            key = self.compiler.add_build_variant(
+                "test", profile_variant(name, overrides), overrides
+            )
+            if key is None:
+                return {}
+            self.differential[key] = name
+        return self.differential
+
+    def enable_autotune(self, flag_space=None):
+        """
+        Search the fastest compiler flags for the test solution in the next runs.
+
+        Each candidate is registered as a build variant, so it must be
+        enabled before compile_all(). While autotuning, tournament,
+        differential and allocator modes are not run.
+
+        Args:
+            flag_space: Flag set name -> language config overrides (None: the
+                        configured autotune_flag_space, else FLAG_SPACE); an
+                        empty dict turns autotuning off
+
+        Returns:
+            dict: Variant key -> flag set name of the registered candidates
+        """
+        if flag_space is None:
+            flag_space = self.config.get("benchmarker", {}).get("autotune_flag_space", FLAG_SPACE)
+
+        self.autotune = {}
+        self.autotune_overrides = {}
+        for name, overrides in available_profiles(flag_space).items():
+            key = self.compiler.add_build_variant(
+                "test", profile_variant(name, overrides, prefix="tune"), overrides
+            )
+            if key is None:
+                self.autotune_overrides = {}
+                return {}
+            self.autotune[key] = name
+            self.autotune_overrides[key] = dict(overrides)
+        return self.autotune
+
+    def enable_allocator_experiments(self, variants=None):
+        """
+        Run the test solution under several allocators and THP settings in the next runs.
+
+        Only native (C++) solutions are run; not combined with autotuning.
+
+        Args:
+            variants: Variant name -> environment overrides (None: the
+                      variants available locally, with the allocator paths of
+                      config["benchmarker"]["allocators"]); an empty dict
+                      turns the experiments off
+
+        Returns:
+            dict: Variant key -> variant name of the registered runs
+        """
+        self.allocators = {}
+        self.allocator_environments = {}
+        if self.compiler.file_languages.get("test") != Language.CPP:
+            return {}
+        if variants is None:
+            variants = allocator_variants(
+                self.config.get("benchmarker", {}).get("allocators"),
+                # THP is disabled by the launch trampoline of stack-limited roles
+                thp_disable=bool(self._get_stack_limits()) and ensure_launcher_built() is not None,
+            )
+
+        for name, overrides in variants.items():
+            key = f"test{VARIANT_SEPARATOR}{name}"
+            self.allocators[key] = name
+            self.allocator_environments[key] = dict(overrides)
+        return self.allocators
+
+    def save_flag_overrides(self, overrides, config_manager=None):
+        """
+        Save compiler config overrides (e.g. autotuned flags) for the test source.
+
+        Stored in languages.cpp.file_overrides under the source path, where
+        BaseCompiler applies them to every build of the file. The regular
+        executable is removed so the next compilation uses the new flags.
+
+        Args:
+            overrides: Language config overrides (empty: remove the entry)
+            config_manager: Config persistence (default: ConfigManager.instance())
+        """
+        source = self.compiler.files["test"]
+        if config_manager is None:
+            # Imported here: the config module pulls in Qt widgets
+            from src.app.core.config.core import ConfigManager
+
+            config_manager = ConfigManager.instance()
+        config = config_manager.load_config()
+        for target in (config, self.config):
+            cpp_config = target.setdefault("languages", {}).setdefault("cpp", {})
+            file_overrides = cpp_config.setdefault("file_overrides", {})
+            if overrides:
+                file_overrides[source] = dict(overrides)
+            else:
+                file_overrides.pop(source, None)
+        config_manager.save_config(config)
+
+        executable = self.compiler.executables.get("test")
+        if executable and os.path.exists(executable):
+            os.remove(executable)
+
+    def _get_solutions(self):
+        """
+        Get the solutions every input is run through.
+
+        Returns:
+            dict: Key -> label of the tournament solutions and differential
+            builds and allocator runs (or of the autotuning candidates),
+            including 'test'; empty when no such mode is on
+        """
+        if self.autotune:
+            return {"test": "default flags", **self.autotune}
+        if not self.tournament and not self.differential and not self.allocators:
+            return {}
+        solutions = dict(self.tournament) or {"test": "regular build"}
+        solutions.update(self.differential)
+        solutions.update(self.allocators)
+        return solutions
+
+    def _get_stack_limits(self):
+        """Stack limits of the roles; allocator runs share the test solution's."""
+        limits = super()._get_stack_limits()
+        if "test" in limits:
+            for key in self.allocators:
+                limits[key] = limits["test"]
+        return limits
+
+    def _get_cpu_placement(self):
+        """Place each test on its own physical core unless cpu_pinning is off."""
+        if not self.config.get("benchmarker", {}).get("cpu_pinning", True):
+            return None
+        return create_core_pool()
+
     def _get_compiler_flags(self):
         """Get benchmark-specific compiler optimization flags"""
         return [
@@ -133,15 +608,50 @@ class Benchmarker(BaseRunner):
         self.time_limit = time_limit or 1000  # Default 1000ms
         self.memory_limit = memory_limit or 256  # Default 256MB
 
-        return BenchmarkTestWorker(
+        # Speed factors come from the worker once it has run the kernel suite
+        self.calibration = None
+
+        # Generate execution commands for multi-language support
+        execution_commands = {
+            "generator": self.compiler.get_execution_command("generator"),
+            "test": self.compiler.get_execution_command("test"),
+        }
+
+        worker_class = BenchmarkTestWorker
+        tournament_options = {}
+        solutions = self._get_solutions()
+        if solutions:
+            for key in solutions:
+                # Allocator runs execute the test solution itself
+                command_key = "test" if key in self.allocators else key
+                execution_commands[key] = self.compiler.get_execution_command(command_key)
+            worker_class = AutotuneTestWorker if self.autotune else TournamentTestWorker
+            tournament_options["solutions"] = solutions
+            if self.allocators and not self.autotune:
+                tournament_options["role_environments"] = self.allocator_environments
+
+        worker = worker_class(
             self.workspace_dir,
             self.executables,
             self.time_limit,
             self.memory_limit,
             test_count,
             max_workers,
+            execution_commands=execution_commands,
+            alloc_profiler=self._get_alloc_profiler(),
+            **({} if self.autotune else self._get_profile_options()),
+            **self._get_timing_options(),
+            **tournament_options,
         )
 
+        # The worker runs the kernel suite on its own thread and judges local
+        # times against the limit scaled to this machine; self.time_limit
+        # stays the judge limit
+        reference = self._get_calibration_reference()
+        if reference:
+            worker.set_calibration(reference, self._get_cpp_compiler(), self._get_workload_class())
+        return worker
+
     def _connect_worker_signals(self, worker):
         """Connect benchmark-specific signals"""
         # Call parent to connect common signals
@@ -166,6 +676,9 @@ class Benchmarker(BaseRunner):
         # Create files snapshot
         files_snapshot = self._create_files_snapshot()
 
+        # Tests in a persistent JVM have no memory reading of their own
+        memory_results = [r for r in test_results if r.get("memory_measured", True)]
+
         # Compile benchmark-specific analysis
         benchmark_analysis = {
             "test_count": self.test_count,
@@ -201,18 +714,106 @@ class Benchmarker(BaseRunner):
                     (r.get("execution_time", 0) for r in test_results), default=0
                 ),
                 "avg_memory_usage": (
-                    sum(r.get("memory_used", 0) for r in test_results)
-                    / len(test_results)
-                    if test_results
+                    sum(r.get("memory_used", 0) for r in memory_results)
+                    / len(memory_results)
+                    if memory_results
                     else 0
                 ),
                 "max_memory_usage": max(
-                    (r.get("memory_used", 0) for r in test_results), default=0
+                    (r.get("memory_used", 0) for r in memory_results), default=0
+                ),
+                "max_stack_usage": max(
+                    (r.get("stack_used", 0) for r in memory_results), default=0
                 ),
             },
             "failed_tests": [r for r in test_results if not r.get("passed", True)],
         }
 
+        # Tail behaviour: percentiles and mergeable HDR histograms of the run
+        benchmark_analysis["latency_distribution"] = self._get_resource_histograms(
+            test_results
+        ).to_analysis()
+
+        # Stack limit the solution ran with (0 = unlimited)
+        stack_limits = getattr(getattr(self, "worker", None), "stack_limits", None)
+        if isinstance(stack_limits, dict) and "test" in stack_limits:
+            benchmark_analysis["stack_limit_mb"] = stack_limits["test"]
+
+        # Cores the tests were placed on
+        core_pool = getattr(getattr(self, "worker", None), "core_pool", None)
+        if isinstance(core_pool, CorePool):
+            benchmark_analysis["cpu_topology"] = core_pool.to_dict()
+
+        # How the number of tests in flight adapted to the machine's pressure
+        concurrency = getattr(getattr(self, "worker", None), "concurrency", None)
+        if isinstance(concurrency, AdaptiveConcurrency):
+            benchmark_analysis["concurrency"] = concurrency.summary()
+
+        # How much of the per-test time is process startup
+        if test_results:
+            startup = self._measure_startup_overhead(
+                {"test": benchmark_analysis["performance_metrics"]["avg_execution_time"]}
+            )
+            if startup:
+                benchmark_analysis["startup_overhead"] = startup
+
+        allocation_profile = summarize_allocations(test_results)
+        if allocation_profile:
+            benchmark_analysis["allocation_profile"] = allocation_profile
+
+        sampling_profile = summarize_profiles(test_results)
+        if sampling_profile:
+            benchmark_analysis["sampling_profile"] = sampling_profile
+
+        io_profile = summarize_io_results(test_results)
+        if io_profile:
+            benchmark_analysis["io_profile"] = io_profile
+
+        timing = summarize_timing(
+            test_results, self._get_timing_mode(), self._get_reference_ips()
+        )
+        if timing:
+            benchmark_analysis["timing"] = timing
+
+        if self.autotune:
+            rounds = getattr(getattr(self, "worker", None), "autotune_rounds", None)
+            autotune = summarize_autotune(
+                test_results,
+                self.autotune,
+                self.autotune_overrides,
+                rounds if isinstance(rounds, list) else None,
+            )
+            if autotune:
+                benchmark_analysis["autotune"] = autotune
+        elif self.tournament:
+            tournament = summarize_tournament(test_results, self.tournament)
+            if tournament:
+                benchmark_analysis["tournament"] = tournament
+
+        if self.differential and not self.autotune:
+            differential = summarize_differential(test_results, self.differential)
+            if differential:
+                benchmark_analysis["differential"] = differential
+
+        if self.allocators and not self.autotune:
+            allocators = summarize_allocators(test_results, self.allocators)
+            if allocators:
+                benchmark_analysis["allocators"] = allocators
+
+        calibration = getattr(self.worker, "calibration", None)
+        self.calibration = calibration if isinstance(calibration, dict) else None
+        if self.calibration:
+            benchmark_analysis["calibration"] = summarize_calibration(
+                self.calibration,
+                self._get_workload_class(),
+                self.time_limit,
+                benchmark_analysis["performance_metrics"]["max_execution_time"] if test_results else None,
+            )
+
+        jvm_timing = self._summarize_warm_timings(test_results)
+        if jvm_timing:
+            benchmark_analysis["jvm_timing"] = jvm_timing
+
         # Create and return TestResult object
         return TestResult(
             test_type="benchmark",
@@ -228,6 +829,71 @@ class Benchmarker(BaseRunner):
             mismatch_analysis=json.dumps(benchmark_analysis),
         )
 
+    def _create_files_snapshot(self):
+        """Snapshot the benchmark files plus the tournament's competing solutions."""
+        snapshot = super()._create_files_snapshot()
+        files = snapshot.setdefault("files", {})
+        for key in self.tournament:
+            if key == "test":
+                continue
+            path = self.compiler.files[key]
+            try:
+                with open(path, "r", encoding="utf-8") as f:
+                    content = f.read()
+            except OSError as e:
+                logger.warning(f"Could not snapshot {path}: {e}")
+                continue
+            files[os.path.basename(path)] = {
+                "content": content,
+                "language": self.compiler.file_languages[key].value,
+                "role": "solution",
+            }
+        return snapshot
+
+    def _get_resource_histograms(self, test_results):
+        """
+        Get the run's wall/CPU/RSS histograms.
+
+        Uses the histograms the worker filled while tests completed when they
+        cover the same results, otherwise rebuilds them from test_results.
+        """
+        worker = getattr(self, "worker", None)
+        histograms = getattr(worker, "resource_histograms", None)
+        if (
+            isinstance(histograms, ResourceHistograms)
+            and histograms.histograms["wall_time_us"].total_count == len(test_results)
+        ):
+            return histograms
+        return ResourceHistograms.from_results(test_results)
+
+    @staticmethod
+    def _summarize_warm_timings(test_results):
+        """
+        Summarize main() timings reported by persistent JVMs.
+
+        The first invocation in each JVM is cold (class loading, interpreter
+        before JIT); later ones are warm. Keeping both apart shows how much
+        of the measured time is JVM overhead rather than the solution.
+
+        Returns:
+            dict or None: Startup/cold/warm averages in seconds, None without warm runs
+        """
+        timings = [r["warm_timing"] for r in test_results if isinstance(r.get("warm_timing"), dict)]
+        if not timings:
+            return None
+
+        cold = [t["main_time"] for t in timings if t.get("cold")]
+        warm = [t["main_time"] for t in timings if not t.get("cold")]
+        startups = {t["jvm_startup_time"] for t in timings if t.get("jvm_startup_time") is not None}
+
+        return {
+            "jvm_startup_time": sum(startups) / len(startups) if startups else None,
+            "cold_runs": len(cold),
+            "warm_runs": len(warm),
+            "cold_main_avg": sum(cold) / len(cold) if cold else None,
+            "warm_main_avg": sum(warm) / len(warm) if warm else None,
+        }
+
     def run_benchmark_test(
         self, test_count, time_limit=1000, memory_limit=256, max_workers=None
     ):
@@ -250,3 +916,12 @@ class Benchmarker(BaseRunner):
             memory_limit=memory_limit,
             max_workers=max_workers,
         )
+
+
+def __getattr__(name: str):
+    """Lazy import of BenchmarkCompilerRunner, which needs Qt (QProcess)."""
+    if name == "BenchmarkCompilerRunner":
+        from src.app.core.tools.compiler_runner import BenchmarkCompilerRunner
+
+        return BenchmarkCompilerRunner
+    raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
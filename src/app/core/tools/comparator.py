@@ -4,18 +4,34 @@ Comparator - Main controller for comparison testing workflow.
 This module has been refactored as part of Phase 4 migration to inherit
 from BaseRunner, eliminating ~100 lines of duplicate runner code while
 maintaining 100% API compatibility.
+
+Tiered mode (config["comparator"]["tiered"]) additionally builds an
+ASan/UBSan variant of the test solution, compiled in the same parallel pass,
+which replays failures and a seed-sampled fraction of passing tests.
+
+The analysis reports the startup overhead of the native binaries (an
+empty-input run) next to their average time per test; stress builds
+(languages.cpp.stress_build) link them statically to cut it.
+
+Distributed mode (config["comparator"]["distributed"]) hands the tests to
+worker agents through a broker instead of the local thread pool; only
+failing tests are stored in full.
 """
 
 import json
 import os
 from datetime import datetime
 
-from PySide6.QtCore import Signal
-
 from src.app.core.tools.base.base_runner import BaseRunner
+from src.app.core.tools.base.distributed import DEFAULT_ADDRESS
+from src.app.core.tools.base.qt_compat import Signal
 from src.app.core.tools.specialized.comparison_test_worker import ComparisonTestWorker
+from src.app.core.tools.specialized.distributed_test_worker import DistributedTestWorker
 from src.app.database import TestResult
 
+# Fraction of passing tests replayed through the sanitized build in tiered mode
+DEFAULT_SANITIZER_SAMPLE_RATE = 0.05
+
 
 class Comparator(BaseRunner):
     """
@@ -59,6 +75,75 @@ class Comparator(BaseRunner):
         # Initialize BaseRunner with comparison test type for nested structure
         super().__init__(workspace_dir, files, test_type="comparison", config=config)
 
+        # Tiered stress mode: optimized run + sanitizer replays
+        comparator_config = self.config.get("comparator", {})
+        self.sanitizer_key = None
+        self.sanitizer_sample_rate = comparator_config.get(
+            "sanitizer_sample_rate", DEFAULT_SANITIZER_SAMPLE_RATE
+        )
+        if comparator_config.get("tiered", False):
+            self.enable_tiered_mode()
+
+        # Distributed mode: broker settings, None for local runs
+        self.distributed = None
+        distributed_config = comparator_config.get("distributed", {})
+        if distributed_config.get("enabled", False):
+            self.enable_distributed_mode(
+                address=distributed_config.get("address", DEFAULT_ADDRESS),
+                local_agents=distributed_config.get("local_agents", 0),
+                agent_slots=distributed_config.get("agent_slots"),
+                chunk_tests=distributed_config.get("chunk_tests"),
+                token=distributed_config.get("token", ""),
+            )
+
+    def enable_tiered_mode(self, sample_rate=None):
+        """
+        Register the sanitized test build used for replays.
+
+        Must be called before compile_all() so both builds are compiled together.
+
+        Args:
+            sample_rate: Fraction of passing tests to replay (None = keep current)
+
+        Returns:
+            bool: True if tiered mode is active (test solution is C++)
+        """
+        if sample_rate is not None:
+            self.sanitizer_sample_rate = sample_rate
+        if self.sanitizer_key is None:
+            self.sanitizer_key = self.compiler.add_sanitizer_build("test")
+        return self.sanitizer_key is not None
+
+    def enable_distributed_mode(
+        self,
+        address=DEFAULT_ADDRESS,
+        local_agents=0,
+        agent_slots=None,
+        chunk_tests=None,
+        token="",
+    ):
+        """
+        Run the next comparison tests on worker agents.
+
+        Agents are started with distributed_agent.py --connect <address>;
+        the address the broker listens on is logged when the run starts.
+        Tiered mode does not apply to distributed runs.
+
+        Args:
+            address: Broker address ('HOST:PORT', port 0 picks one, or 'unix:PATH')
+            local_agents: Agents started on this machine
+            agent_slots: Tests each local agent runs in parallel (None = its CPU count)
+            chunk_tests: Tests per job handed to an agent (None = automatic)
+            token: Token agents must present
+        """
+        self.distributed = {
+            "address": address,
+            "local_agents": local_agents,
+            "agent_slots": agent_slots,
+            "chunk_tests": chunk_tests,
+            "token": token,
+        }
+
     def _get_compiler_flags(self):
         """Get comparison-specific compiler optimization flags"""
         return [
@@ -70,7 +155,7 @@ class Comparator(BaseRunner):
             "-Wall",  # Enable common warnings
         ]
 
-    def _create_test_worker(self, test_count, max_workers=None, **kwargs):
+    def _create_test_worker(self, test_count, max_workers=None, run_seed=None, **kwargs):
         """Create ComparisonTestWorker for comparison testing"""
         # Generate execution commands for multi-language support
         execution_commands = {
@@ -79,12 +164,30 @@ class Comparator(BaseRunner):
             "correct": self.compiler.get_execution_command("correct"),
         }
 
+        if self.distributed is not None:
+            return DistributedTestWorker(
+                self.workspace_dir,
+                self.executables,
+                test_count,
+                max_workers,
+                execution_commands=execution_commands,
+                run_seed=run_seed,
+                **self.distributed,
+            )
+
+        sanitizer_command = None
+        if self.sanitizer_key:
+            sanitizer_command = self.compiler.get_execution_command(self.sanitizer_key)
+
         return ComparisonTestWorker(
             self.workspace_dir,
             self.executables,
             test_count,
             max_workers,
             execution_commands=execution_commands,
+            run_seed=run_seed,
+            sanitizer_command=sanitizer_command,
+            sanitizer_sample_rate=self.sanitizer_sample_rate,
         )
 
     def _connect_worker_signals(self, worker):
@@ -168,8 +271,49 @@ class Comparator(BaseRunner):
                 ),
             },
             "failed_tests": [r for r in test_results if not r.get("passed", True)],
+            "run_seed": getattr(self.worker, "run_seed", None),
         }
 
+        # Only the broker worker has a distribution; isinstance() against the
+        # QObject/ABC worker classes raises under PySide6
+        distribution = getattr(self.worker, "distribution", None)
+        if isinstance(distribution, dict):
+            # Passing tests are only counted, averages cover every test
+            completed = passed_tests + failed_tests
+            totals = self.worker.time_totals
+            stress_analysis["comparison_summary"]["matching_outputs"] = passed_tests
+            stress_analysis["execution_times"] = {
+                "avg_generator": totals["generator"] / completed if completed else 0,
+                "avg_test": totals["test"] / completed if completed else 0,
+                "avg_correct": totals["correct"] / completed if completed else 0,
+                "avg_comparison": 0,
+            }
+            stress_analysis["distributed"] = distribution
+
+        # How much of the per-test time is process startup
+        if test_results:
+            times = stress_analysis["execution_times"]
+            startup = self._measure_startup_overhead(
+                {"test": times["avg_test"], "correct": times["avg_correct"]}
+            )
+            if startup:
+                stress_analysis["startup_overhead"] = startup
+
+        if self.sanitizer_key:
+            replays = [r["sanitizer_replay"] for r in test_results if "sanitizer_replay" in r]
+            stress_analysis["sanitizer_tier"] = {
+                "sample_rate": self.sanitizer_sample_rate,
+                "replayed_failures": sum(1 for r in replays if r["reason"] == "failure"),
+                "replayed_samples": sum(1 for r in replays if r["reason"] == "sample"),
+                "ub_detected": sum(1 for r in replays if r["ub_detected"]),
+                "ub_tests": [
+                    r["test_number"]
+                    for r in test_results
+                    if r.get("sanitizer_replay", {}).get("ub_detected")
+                ],
+                "replay_time": sum(r.get("time", 0.0) for r in replays),
+            }
+
         # Create and return TestResult object
         return TestResult(
             test_type="comparison",
@@ -195,12 +339,20 @@ class Comparator(BaseRunner):
         # Use BaseRunner's run_tests method with comparison-specific parameters
         self.run_tests(test_count, max_workers=max_workers)
 
-    def run_comparison_test(self, test_count, max_workers=None):
+    def run_comparison_test(self, test_count, max_workers=None, run_seed=None):
         """
         Start comparison tests - modern API.
 
         This method provides the modern API while using
         the BaseRunner infrastructure for thread management.
+
+        Args:
+            test_count: Number of tests to run
+            max_workers: Maximum parallel workers (None = auto)
+            run_seed: Seed to reproduce a previous run (None = fresh seed)
         """
         # Use BaseRunner's run_tests method with comparison-specific parameters
-        self.run_tests(test_count, max_workers=max_workers)
+        if run_seed is None:
+            self.run_tests(test_count, max_workers=max_workers)
+        else:
+            self.run_tests(test_count, max_workers=max_workers, run_seed=run_seed)
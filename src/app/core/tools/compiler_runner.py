@@ -517,3 +517,65 @@ class CompilerRunner(QObject):
                 self.worker, "reload_config", Qt.QueuedConnection
             )
             logger.info("CompilerRunner config reload queued")
+
+
+class BenchmarkCompilerRunner(CompilerRunner):
+    """Specialized compiler runner for benchmarking"""
+
+    # Additional signals specific to benchmarking
+    compilationStarted = Signal()
+    compilationFinished = Signal(bool)  # True if successful
+    outputAvailable = Signal(str, str)  # message, type
+
+    def __init__(self, console_output):
+        # Initialize the base compiler runner (which already handles threading)
+        super().__init__(console_output)
+
+        # Connect additional signals for benchmark-specific behavior
+        if self.worker:
+            self.worker.output.connect(self._handle_output_for_benchmark)
+            self.worker.error.connect(self._handle_error_for_benchmark)
+
+        logger.debug("BenchmarkCompilerRunner initialized")
+
+    def _handle_output_for_benchmark(self, output_data):
+        """Handle output with benchmark-specific signals"""
+        if isinstance(output_data, tuple) and len(output_data) == 2:
+            text, format_type = output_data
+        else:
+            text, format_type = str(output_data), "default"
+
+        # Emit benchmark-specific signal
+        self.outputAvailable.emit(text, format_type)
+
+    def _handle_error_for_benchmark(self, error_data):
+        """Handle error with benchmark-specific signals"""
+        if isinstance(error_data, tuple) and len(error_data) == 2:
+            text, format_type = error_data
+        else:
+            text, format_type = str(error_data), "error"
+
+        # Emit benchmark-specific signal
+        self.outputAvailable.emit(text, format_type)
+
+    def compile_and_run_code(self, filepath):
+        """Compile and run code for benchmarking"""
+        logger.debug(f"Starting benchmark compilation for {filepath}")
+
+        # Emit TLE-specific signal
+        self.compilationStarted.emit()
+
+        # Connect to finished signal to emit compilation result
+        def on_finished():
+            # Assume success if we get here without errors
+            self.compilationFinished.emit(True)
+            self.finished.disconnect(on_finished)
+
+        self.finished.connect(on_finished)
+
+        # Use base class method
+        super().compile_and_run_code(filepath)
+
+    def stop(self):
+        """Stop any running process (alias for compatibility)"""
+        self.stop_execution()
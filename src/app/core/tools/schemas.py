@@ -5,7 +5,7 @@ Phase 5 (Issue #5): TypedDict schemas for type safety
 Provides structured types for different test result formats.
 """
 
-from typing import TypedDict
+from typing import Dict, Optional, TypedDict
 
 
 class BaseTestDetail(TypedDict, total=False):
@@ -22,6 +22,69 @@ class BaseTestDetail(TypedDict, total=False):
     memory: float
     status: str  # "pass" or "fail"
     test: int  # Test number (alternative naming)
+    test_seed: int  # Generator seed (CTS_SEED) to reproduce the input
+    output_limit_exceeded: bool  # Solution killed for printing past the output limit
+
+
+class SanitizerReplay(TypedDict, total=False):
+    """Result of replaying a test through the sanitized build (tiered mode)"""
+
+    reason: str  # "failure" or "sample"
+    exit_code: Optional[int]  # None if the replay did not finish
+    report: str  # Sanitizer report (truncated), empty when clean
+    ub_detected: bool
+    output_matches: Optional[bool]  # None if unknown
+    time: float
+
+
+class WarmTiming(TypedDict, total=False):
+    """In-process timing reported by a persistent JVM"""
+
+    mode: str  # "warm_jvm"
+    main_time: float  # Seconds spent in main()
+    invocation: int  # 1-based invocation count of the JVM
+    cold: bool  # First invocation (class loading, no JIT yet)
+    jvm_startup_time: Optional[float]
+
+
+class AllocationSite(TypedDict, total=False):
+    """Allocation call site merged from the interposer report"""
+
+    count: int
+    bytes: int
+    growth: bool  # Requests of many power-of-two sizes (a growing buffer)
+    size_class: int  # Size class bucket of all its requests, when they share one
+    frames: list  # [{"module", "function", "location", "caller"?}], innermost first
+
+
+class AllocationSummary(TypedDict, total=False):
+    """Allocation profile of one test run (LD_PRELOAD interposer)"""
+
+    allocations: int  # malloc + new + realloc calls
+    new_calls: int
+    reallocations: int
+    frees: int
+    bytes_allocated: int
+    peak_live_bytes: int
+    leaked_bytes: int  # Still live at exit
+    size_classes: dict  # "<2^k" -> request count
+    top_sites: list  # List[AllocationSite]
+    hints: list  # Human-readable findings
+
+
+class IoProfile(TypedDict, total=False):
+    """Syscall I/O counters of one test run (/proc/<pid>/io at exit, Linux)"""
+
+    read_syscalls: int
+    write_syscalls: int
+    bytes_read: int
+    bytes_written: int
+    avg_read_bytes: float
+    avg_write_bytes: float
+    user_time: float
+    system_time: float  # Kernel time, mostly read()/write()
+    system_time_ratio: float
+    warnings: list  # Tiny chunks, high kernel time share
 
 
 class ValidatorTestDetail(BaseTestDetail, total=False):
@@ -42,6 +105,16 @@ class ValidatorTestDetail(BaseTestDetail, total=False):
     execution_time: float  # Alternative naming for total_time
 
 
+class OutputDifference(TypedDict, total=False):
+    """First differing line of a mismatched comparison"""
+
+    line: int  # 1-based
+    expected: Optional[str]  # None past the end of the expected output
+    actual: Optional[str]
+    expected_lines: int
+    actual_lines: int
+
+
 class ComparisonTestDetail(BaseTestDetail, total=False):
     """Comparison test details (formerly stress tests)
 
@@ -60,6 +133,30 @@ class ComparisonTestDetail(BaseTestDetail, total=False):
     expected_output: str  # Alternative naming for correct_output
     output: str  # Another alternative
     execution_time: float  # Alternative naming
+    test_output_full: str  # Mismatches only: output, or its head and tail when large
+    correct_output_full: str
+    test_output_size: int  # Characters of the complete outputs
+    correct_output_size: int
+    test_output_hash: str  # Digest of the output with surrounding whitespace stripped
+    correct_output_hash: str
+    diff: OutputDifference  # Mismatches of fully retained outputs only
+    sanitizer_replay: SanitizerReplay  # Only present in tiered mode
+    verdict: str  # OK/WA/RE/TLE/GEN/CRE, distributed runs only
+    agent: str  # Agent that ran the test, distributed runs only
+
+
+class TournamentEntry(TypedDict, total=False):
+    """Measurements of one solution on a tournament test"""
+
+    passed: bool
+    execution_time: float
+    cpu_time: float
+    wall_time: float  # Only in CPU/instruction timing modes
+    memory_used: float
+    instructions: Optional[int]
+    error_details: str
+    output_hash: str  # Digest of the output with surrounding whitespace stripped
+    position: int  # 0-based place in the test's shuffled run order
 
 
 class BenchmarkTestDetail(BaseTestDetail, total=False):
@@ -70,16 +167,30 @@ class BenchmarkTestDetail(BaseTestDetail, total=False):
     """
 
     test_name: str
-    execution_time: float
+    execution_time: float  # Seconds the test is judged by (see timing_source)
+    wall_time: float  # Measured wall time, only in CPU/instruction timing modes
+    timing_source: str  # 'instructions', 'task_clock', 'cpu_time' or 'wall'
+    instructions: Optional[int]  # Retired instructions (None without hardware counters)
+    task_clock: float  # CPU seconds from the perf task clock
+    counter_error: str  # Why instructions could not be counted
+    cpu_time: float  # User + system CPU seconds (sampled while running; not in a persistent JVM)
     memory_used: float
-    memory_passed: bool
+    stack_used: float  # Peak stack (VmStk) in MB, sampled while running
+    memory_passed: bool  # Always True when memory_measured is False
+    memory_measured: bool  # Only set (False) when the test ran in a persistent JVM
     time_passed: bool
     generator_time: float
     input: str
-    output: str
+    output: str  # Output, or its head and tail when large
+    output_size: int  # Characters printed before an output limit kill
     test_size: int
     error: str  # Error message if test failed
     actual_output: str  # Output from test execution
+    warm_timing: WarmTiming  # Only when the test ran in a persistent JVM
+    allocations: AllocationSummary  # Only with allocation profiling
+    io: IoProfile  # Only on Linux
+    output_hash: str  # Only in tournament mode
+    tournament: Dict[str, TournamentEntry]  # Solution key -> run, tournament mode only
 
 
 # Type aliases for convenience
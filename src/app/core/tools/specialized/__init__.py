@@ -1,8 +1,34 @@
 # Specialized Worker Classes
 # These inherit from BaseTestWorker and implement specific testing patterns
+# (imported lazily, so a runner only loads the workers it uses)
 
-from src.app.core.tools.specialized.benchmark_test_worker import BenchmarkTestWorker
-from src.app.core.tools.specialized.comparison_test_worker import ComparisonTestWorker
-from src.app.core.tools.specialized.validator_test_worker import ValidatorTestWorker
+from typing import TYPE_CHECKING
 
-__all__ = ["ValidatorTestWorker", "BenchmarkTestWorker", "ComparisonTestWorker"]
+if TYPE_CHECKING:
+    from src.app.core.tools.specialized.autotune_test_worker import AutotuneTestWorker
+    from src.app.core.tools.specialized.benchmark_test_worker import BenchmarkTestWorker
+    from src.app.core.tools.specialized.comparison_test_worker import ComparisonTestWorker
+    from src.app.core.tools.specialized.distributed_test_worker import DistributedTestWorker
+    from src.app.core.tools.specialized.tournament_test_worker import TournamentTestWorker
+    from src.app.core.tools.specialized.validator_test_worker import ValidatorTestWorker
+
+# Exported name -> module it lives in
+_EXPORTS = {
+    "ValidatorTestWorker": "src.app.core.tools.specialized.validator_test_worker",
+    "BenchmarkTestWorker": "src.app.core.tools.specialized.benchmark_test_worker",
+    "ComparisonTestWorker": "src.app.core.tools.specialized.comparison_test_worker",
+    "TournamentTestWorker": "src.app.core.tools.specialized.tournament_test_worker",
+    "AutotuneTestWorker": "src.app.core.tools.specialized.autotune_test_worker",
+    "DistributedTestWorker": "src.app.core.tools.specialized.distributed_test_worker",
+}
+
+__all__ = list(_EXPORTS)
+
+
+def __getattr__(name: str):
+    """Lazy import workers on first access."""
+    if name in _EXPORTS:
+        import importlib
+
+        return getattr(importlib.import_module(_EXPORTS[name]), name)
+    raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
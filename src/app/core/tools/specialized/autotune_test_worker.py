@@ -0,0 +1,74 @@
+"""
+AutotuneTestWorker - Successive halving over compiler flag candidates.
+
+Runs the tournament worker in rounds (see core.tools.base.autotune): each
+round measures the surviving candidate builds and the regular build on
+new inputs, then keeps the faster half. Test numbers continue across
+rounds, so every input is generated once and all measurements of a
+candidate are kept for its final statistics.
+"""
+
+from typing import Any, Dict, Iterable, List, Optional
+
+from src.app.core.tools.base.autotune import halving_schedule, select_survivors
+from src.app.core.tools.base.differential import BASELINE_KEY
+from src.app.core.tools.specialized.tournament_test_worker import TournamentTestWorker
+
+
+class AutotuneTestWorker(TournamentTestWorker):
+    """Tournament worker eliminating the slower half of the candidates per round."""
+
+    # Rounds depend on the results of the previous ones
+    supports_checkpoints = False
+
+    def __init__(self, *args, **kwargs):
+        """
+        Initialize the autotune worker.
+
+        Takes the arguments of TournamentTestWorker; solutions maps the
+        regular build ('test') and the candidate builds to their labels,
+        test_count is the number of inputs of the last round.
+        """
+        super().__init__(*args, **kwargs)
+        self.candidates = dict(self.solutions)
+
+        # Recorded per round: cumulative tests, candidates run, eliminated
+        self.autotune_rounds: List[Dict[str, Any]] = []
+
+    def _execute_tests(self, wrapped_test, test_numbers: Optional[Iterable[int]] = None) -> bool:
+        """Run the rounds of successive halving."""
+        survivors = [key for key in self.candidates if key != BASELINE_KEY]
+        schedule = halving_schedule(len(survivors), self.test_count)
+        self.autotune_rounds = []
+
+        all_passed = True
+        done = 0
+        try:
+            for index, tests in enumerate(schedule):
+                if not self.is_running or not survivors:
+                    break
+                self.solutions = {
+                    key: self.candidates[key] for key in [BASELINE_KEY] + survivors
+                }
+                all_passed = (
+                    super()._execute_tests(wrapped_test, range(done + 1, tests + 1))
+                    and all_passed
+                )
+                done = tests
+
+                with self._results_lock:
+                    results = list(self.test_results)
+                kept, eliminated = select_survivors(
+                    results, survivors, keep_all=index == len(schedule) - 1
+                )
+                self.autotune_rounds.append(
+                    {
+                        "tests": tests,
+                        "candidates": [self.candidates[key] for key in survivors],
+                        "eliminated": [self.candidates[key] for key in eliminated],
+                    }
+                )
+                survivors = kept
+        finally:
+            self.solutions = dict(self.candidates)
+        return all_passed
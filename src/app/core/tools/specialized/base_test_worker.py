@@ -10,15 +10,53 @@ Key features:
 - Template method pattern for _run_single_test()
 - Async output reading helpers to prevent pipe deadlocks
 - Consistent error handling and result management
+- Per-test seeds so every generated input can be reproduced
+- Optional warm interpreters for Python roles (fork per test instead of exec)
+  and persistent JVMs for Java roles
+- Optional per-role stack limits (RLIMIT_STACK) for native solutions
+- Bounded capture of solution output (output limit exceeded kills the process)
+- Adaptive number of tests in flight from pressure stall information and
+  per-test peak RSS (Linux, when the worker count is auto-calculated)
+- Optional placement of every test on its own physical core (Linux)
+- Optional checkpoint journal, so a long run can be resumed without
+  repeating completed tests (see base/checkpoint.py)
 """
 
+import logging
 import multiprocessing
+import os
+import subprocess
 import threading
 from abc import ABCMeta, abstractmethod
-from concurrent.futures import ThreadPoolExecutor, as_completed
-from typing import Any, Dict, List, Optional, Tuple
+from concurrent.futures import FIRST_COMPLETED, ThreadPoolExecutor, wait
+from typing import Any, Dict, Iterable, List, Optional, Tuple
 
-from PySide6.QtCore import QObject, Signal, Slot
+from src.app.core.tools.base.checkpoint import RunJournal
+from src.app.core.tools.base.concurrency import AdaptiveConcurrency, pressure_supported
+from src.app.core.tools.base.cpu_topology import CorePool, CoreSlot, placement_environment
+from src.app.core.tools.base.output_capture import (
+    DEFAULT_OUTPUT_LIMIT_MB,
+    OutputCapture,
+    output_limit_chars,
+)
+from src.app.core.tools.base.process_limits import (
+    ensure_launcher_built,
+    launcher_prefix,
+    stack_limit_kb,
+    stack_limit_prefix,
+    stack_limit_preexec,
+)
+from src.app.core.tools.base.qt_compat import QObject, Signal, Slot
+from src.app.core.tools.base.seeds import (
+    derive_test_seed,
+    generator_environment,
+    new_run_seed,
+)
+from src.app.core.tools.base.startup_probe import measure_startup
+from src.app.core.tools.base.warm_java_pool import WarmJavaProcess, WarmJvmPool
+from src.app.core.tools.base.warm_python_pool import WarmInterpreter
+
+logger = logging.getLogger(__name__)
 
 
 # Resolve metaclass conflict between QObject and ABC
@@ -41,23 +79,30 @@ class BaseTestWorker(QObject, metaclass=QObjectABCMeta):
         testStarted: Emitted when a test begins (completed_count, total_count)
         testCompleted: Emitted when a test finishes (implementation-specific params)
         allTestsCompleted: Emitted when all tests finish (all_passed: bool)
+        resultRecorded: Emitted with each test's full result dictionary
     """
     
     # Base signals - specialized workers add their own testCompleted signature
     testStarted = Signal(int, int)  # completed_count, total_count
     allTestsCompleted = Signal(bool)  # all_passed
+    resultRecorded = Signal(object)  # result dictionary (headless CLI output)
     
     # NEW: Real-time worker activity tracking
     workerBusy = Signal(int, int)  # worker_id (0-based), test_number - emitted when worker starts a test
     workerIdle = Signal(int)  # worker_id (0-based) - emitted when worker finishes
     
+    # Workers that run tests 1..test_count through _execute_tests() can be
+    # checkpointed and resumed
+    supports_checkpoints = True
+    
     def __init__(
         self,
         workspace_dir: str,
         executables: Dict[str, str],
         test_count: int = 1,
         max_workers: Optional[int] = None,
-        execution_commands: Optional[Dict[str, List[str]]] = None
+        execution_commands: Optional[Dict[str, List[str]]] = None,
+        run_seed: Optional[int] = None
     ):
         """
         Initialize base test worker.
@@ -68,6 +113,7 @@ class BaseTestWorker(QObject, metaclass=QObjectABCMeta):
             test_count: Number of tests to run
             max_workers: Maximum parallel workers (None = auto-calculate)
             execution_commands: Custom execution commands per language
+            run_seed: Seed of the whole run (None = fresh random seed)
         """
         super().__init__()
         
@@ -76,19 +122,51 @@ class BaseTestWorker(QObject, metaclass=QObjectABCMeta):
         self.executables = executables
         self.test_count = test_count
         
+        # Test N always gets the same generator seed for a given run seed
+        self.run_seed = run_seed if run_seed is not None else new_run_seed()
+        
         # Thread-safe state management (Issue #7)
         self._is_running = True
         self._state_lock = threading.Lock()
         
+        # Roles (e.g. 'test') served by a warm interpreter during run_tests(),
+        # mapped to their language key ('py' or 'java')
+        self._warm_roles: Dict[str, str] = {}
+        self._warm_interpreters: Dict[str, Any] = {}
+        self.stack_limits: Dict[str, int] = {}
+        self._stack_prefix: Dict[str, List[str]] = {}
+        self._stack_preexec: Dict[str, Any] = {}
+        self.output_limit_mb: float = DEFAULT_OUTPUT_LIMIT_MB
+        
+        # Roles whose process startup is timed after the run, and the probes
+        # (None where a binary did not exit on empty input)
+        self._startup_probe_commands: Dict[str, List[str]] = {}
+        self.startup_probes: Dict[str, Optional[Dict[str, Any]]] = {}
+        
+        # Core placement: the slot of the test running on each thread
+        self.core_pool: Optional[CorePool] = None
+        self._placement_launcher: Optional[str] = None
+        self._placement = threading.local()
+        
         # Thread-safe results storage
         self.test_results: List[Dict[str, Any]] = []
         self._results_lock = threading.Lock()
         
-        # Calculate optimal worker count (subclasses can override)
+        # Checkpoint journal of the run (None = not checkpointed)
+        self.journal: Optional[RunJournal] = None
+        
+        # Calculate optimal worker count (subclasses can override); an
+        # auto-calculated count is only the starting point where the
+        # machine's pressure can be observed
+        self.concurrency: Optional[AdaptiveConcurrency] = None
         if max_workers is not None:
             self.max_workers = max_workers
         else:
             self.max_workers = self._calculate_optimal_workers()
+            if pressure_supported():
+                self.concurrency = AdaptiveConcurrency(
+                    self.max_workers, self._calculate_worker_ceiling()
+                )
         
         # Multi-language support
         if execution_commands:
@@ -129,6 +207,20 @@ class BaseTestWorker(QObject, metaclass=QObjectABCMeta):
         """
         return min(8, max(1, multiprocessing.cpu_count() - 1))
     
+    def _calculate_worker_ceiling(self) -> int:
+        """
+        Calculate the most tests adaptive concurrency may run in parallel.
+        
+        Returns:
+            One test per CPU (at least the static worker count)
+        """
+        return max(self.max_workers, multiprocessing.cpu_count())
+    
+    @property
+    def worker_slots(self) -> int:
+        """Number of threads that may run tests (for per-worker status displays)."""
+        return self.concurrency.ceiling if self.concurrency else self.max_workers
+    
     def _tracked_test_wrapper(self, test_number: int, worker_id: int) -> Dict[str, Any]:
         """
         Wrapper around _run_single_test that emits worker tracking signals.
@@ -143,11 +235,20 @@ class BaseTestWorker(QObject, metaclass=QObjectABCMeta):
         # Emit that this worker is now busy with this test
         self.workerBusy.emit(worker_id, test_number)
         
+        slot = self.core_pool.acquire() if self.core_pool else None
+        self._placement.slot = slot
+        self._placement.applied = None
         try:
             # Run the actual test
             result = self._run_single_test(test_number)
+            if slot is not None and self._placement.applied and isinstance(result, dict):
+                result.setdefault("cpu_placement", slot.to_dict())
             return result
         finally:
+            self._placement.slot = None
+            self._placement.applied = None
+            if slot is not None:
+                self.core_pool.release(slot)
             # Emit that this worker is now idle
             self.workerIdle.emit(worker_id)
     
@@ -160,9 +261,6 @@ class BaseTestWorker(QObject, metaclass=QObjectABCMeta):
         Handles parallel execution, cancellation, result collection, and signal emissions.
         Now with real worker tracking!
         """
-        all_passed = True
-        completed_tests = 0
-        
         # Track which worker (thread) is running which test
         import threading
         worker_id_map = {}  # {thread_id: worker_id}
@@ -184,15 +282,56 @@ class BaseTestWorker(QObject, metaclass=QObjectABCMeta):
             worker_id = get_worker_id()
             return self._tracked_test_wrapper(test_num, worker_id)
         
-        with ThreadPoolExecutor(max_workers=self.max_workers) as executor:
-            # Submit all tests with worker tracking
-            future_to_test = {
-                executor.submit(wrapped_test, i): i
-                for i in range(1, self.test_count + 1)
-            }
+        self._start_warm_interpreters()
+        try:
+            all_passed = self._execute_tests(wrapped_test)
+        finally:
+            self._stop_warm_interpreters()
+            if self.journal is not None:
+                self.journal.checkpoint(force=True)
+        self._probe_startup()
+        
+        # Emit completion signal
+        self.allTestsCompleted.emit(all_passed)
+    
+    def _execute_tests(self, wrapped_test, test_numbers: Optional[Iterable[int]] = None) -> bool:
+        """
+        Execute all tests in the thread pool and collect their results.
+        
+        Tests are submitted as earlier ones finish, so at most max_workers
+        (or the adaptive concurrency limit) are in flight at a time.
+        
+        Args:
+            wrapped_test: Callable running one test number with worker tracking
+            test_numbers: Tests to run (default: 1..test_count)
+        
+        Returns:
+            True if every test passed
+        """
+        all_passed = True
+        completed_tests = 0
+        pending_tests = iter(test_numbers if test_numbers is not None else range(1, self.test_count + 1))
+        if self.journal is not None:
+            # Tests completed before the run was resumed
+            pending_tests = iter(self.journal.remaining(pending_tests))
+        concurrency = self.concurrency
+        
+        with ThreadPoolExecutor(max_workers=self.worker_slots) as executor:
+            future_to_test = {}
+            
+            def submit_tests() -> None:
+                """Keep as many tests in flight as the current limit allows"""
+                limit = concurrency.limit if concurrency else self.max_workers
+                while len(future_to_test) < limit and self.is_running:
+                    test_number = next(pending_tests, None)
+                    if test_number is None:
+                        return
+                    future_to_test[executor.submit(wrapped_test, test_number)] = test_number
             
-            # Process results as they complete
-            for future in as_completed(future_to_test):
+            submit_tests()
+            while future_to_test:
+                done, _ = wait(future_to_test, return_when=FIRST_COMPLETED)
+                
                 # Check if stop() was called
                 if not self.is_running:
                     # Cancel remaining tests
@@ -200,35 +339,49 @@ class BaseTestWorker(QObject, metaclass=QObjectABCMeta):
                         f.cancel()
                     break
                 
-                test_number = future_to_test[future]
-                
-                # Emit testStarted BEFORE getting result (so UI shows "running test #X")
-                self.testStarted.emit(test_number, self.test_count)
-                
-                completed_tests += 1
-                
-                try:
-                    test_result = future.result()
+                for future in done:
+                    test_number = future_to_test.pop(future)
                     
-                    if test_result:
-                        # Store result thread-safely
-                        with self._results_lock:
-                            self.test_results.append(test_result)
-                        
-                        # Subclasses emit their own testCompleted signal here
-                        self._emit_test_completed(test_result)
+                    # Emit testStarted BEFORE getting result (so UI shows "running test #X")
+                    self.testStarted.emit(test_number, self.test_count)
+                    
+                    completed_tests += 1
+                    test_result = None
+                    
+                    try:
+                        test_result = future.result()
                         
-                        # Track overall pass/fail
-                        if not test_result.get("passed", False):
-                            all_passed = False
+                        if test_result:
+                            test_result.setdefault("test_seed", self._test_seed(test_number))
+                            
+                            # Store result thread-safely
+                            with self._results_lock:
+                                self.test_results.append(test_result)
+                            if self.journal is not None:
+                                self.journal.record(test_result)
+                                self.journal.checkpoint()
+                            
+                            # Subclasses emit their own testCompleted signal here
+                            self._emit_test_completed(test_result)
+                            self.resultRecorded.emit(test_result)
+                            
+                            # Track overall pass/fail
+                            if not test_result.get("passed", False):
+                                all_passed = False
+                    
+                    except Exception as e:
+                        # Handle unexpected errors
+                        print(f"Error running test {test_number}: {e}")
+                        all_passed = False
+                    
+                    if concurrency:
+                        concurrency.record(test_result)
                 
-                except Exception as e:
-                    # Handle unexpected errors
-                    print(f"Error running test {test_number}: {e}")
-                    all_passed = False
+                if concurrency:
+                    concurrency.update(len(future_to_test))
+                submit_tests()
         
-        # Emit completion signal
-        self.allTestsCompleted.emit(all_passed)
+        return all_passed
     
     @abstractmethod
     def _run_single_test(self, test_number: int) -> Dict[str, Any]:
@@ -258,6 +411,316 @@ class BaseTestWorker(QObject, metaclass=QObjectABCMeta):
         """
         raise NotImplementedError("Subclasses must implement _emit_test_completed()")
     
+    def _test_seed(self, test_number: int) -> int:
+        """
+        Get the generator seed of a test.
+        
+        Args:
+            test_number: Test number (1-based)
+        
+        Returns:
+            64-bit seed derived from the run seed
+        """
+        return derive_test_seed(self.run_seed, test_number)
+    
+    def _generator_env(self, test_number: int) -> Dict[str, str]:
+        """
+        Get the environment for the generator process of a test.
+        
+        Args:
+            test_number: Test number (1-based)
+        
+        Returns:
+            Environment with the test seed exported as CTS_SEED
+        """
+        return generator_environment(self._test_seed(test_number))
+    
+    def enable_warm_interpreters(self, roles: Dict[str, str]) -> None:
+        """
+        Serve the given roles from warm interpreters.
+        
+        Python roles get a fork server, Java roles a pool of persistent JVMs
+        (one per worker thread). They are started when run_tests() begins and
+        shut down when it ends; roles whose interpreter fails to start fall
+        back to launching the command per test.
+        
+        Args:
+            roles: Keys of execution_commands mapped to their language ('py', 'java')
+        """
+        self._warm_roles = dict(roles)
+    
+    def enable_checkpoints(self, journal: RunJournal) -> None:
+        """
+        Checkpoint the run to a journal, continuing from its last checkpoint.
+        
+        Tests the journal records as completed are skipped: the run takes
+        the journal's run seed, its failures become results again and its
+        passing tests are counted (unrecorded_passes).
+        
+        Args:
+            journal: New journal of this run, or one loaded to resume it
+        """
+        self.journal = journal
+        self.run_seed = journal.run_seed
+        with self._results_lock:
+            self.test_results = list(journal.failures) + self.test_results
+        self.unrecorded_passes = journal.passed
+    
+    def set_startup_probes(self, commands: Dict[str, List[str]]) -> None:
+        """
+        Time the process startup of the given commands once the tests are done.
+        
+        Probing runs on the worker thread after the last test, so the runner
+        only reads startup_probes when the results are saved.
+        
+        Args:
+            commands: Role -> execution command of a binary reading stdin
+        """
+        self._startup_probe_commands = dict(commands)
+    
+    def _probe_startup(self) -> None:
+        """Run the startup probes unless the run was stopped."""
+        for role, command in self._startup_probe_commands.items():
+            if not self.is_running:
+                return
+            self.startup_probes[role] = measure_startup(command)
+    
+    def set_stack_limits(self, limits: Dict[str, int]) -> None:
+        """
+        Run the processes of the given roles with a stack limit.
+        
+        The limit is set by the exec trampoline of process_limits, which keeps
+        spawning cheap in a large parent; without it (no compiler) a
+        preexec_fn sets the limit instead.
+        
+        Args:
+            limits: Keys of execution_commands mapped to the limit in MB (0 = unlimited)
+        """
+        self.stack_limits = dict(limits)
+        self._stack_prefix = {}
+        self._stack_preexec = {}
+        launcher = ensure_launcher_built() if self.stack_limits else None
+        for role, limit_mb in self.stack_limits.items():
+            prefix = stack_limit_prefix(limit_mb, launcher) if launcher else None
+            if prefix is not None:
+                self._stack_prefix[role] = prefix
+                continue
+            preexec = stack_limit_preexec(limit_mb)
+            if preexec is not None:
+                self._stack_preexec[role] = preexec
+    
+    def set_cpu_placement(self, pool: CorePool) -> None:
+        """
+        Run every test on its own physical core.
+        
+        The processes of a test are pinned to the core of its slot (and
+        their memory bound to its node) through the launch trampoline, or
+        pinned right after they start without it. At most one test per
+        slot runs at a time. Tests in a persistent JVM are not placed (the
+        JVM is shared) and their results carry no 'cpu_placement'.
+        
+        Args:
+            pool: Slots of the physical cores tests may use
+        """
+        self.core_pool = pool
+        self._placement_launcher = ensure_launcher_built()
+        self.max_workers = min(self.max_workers, len(pool))
+        if self.concurrency:
+            self.concurrency = AdaptiveConcurrency(
+                self.max_workers, min(self.concurrency.ceiling, len(pool))
+            )
+    
+    def _current_slot(self) -> Optional[CoreSlot]:
+        """Get the core slot of the test running on this thread."""
+        return getattr(self._placement, "slot", None)
+    
+    def _note_placement(self, applied: bool) -> None:
+        """
+        Record whether a process of the current test was placed on its slot.
+        
+        The test counts as placed only if every process it launched was.
+        """
+        if self._current_slot() is None:
+            return
+        previous = getattr(self._placement, "applied", None)
+        self._placement.applied = applied if previous is None else previous and applied
+    
+    def _stack_limit_kb(self, role: str) -> Optional[int]:
+        """
+        Get the stack limit a role's processes actually run with.
+        
+        Returns:
+            Optional[int]: Limit in KB, None if the role has no finite limit
+        """
+        if role not in self._stack_prefix and role not in self._stack_preexec:
+            return None
+        return stack_limit_kb(self.stack_limits[role])
+    
+    def set_output_limit(self, limit_mb: float) -> None:
+        """
+        Kill solutions whose output grows past a limit.
+        
+        Args:
+            limit_mb: Output limit in MB (0 = unlimited)
+        """
+        self.output_limit_mb = limit_mb
+    
+    def _capture_output(
+        self, process, retain: Optional[int] = None, hash_output: bool = False
+    ) -> OutputCapture:
+        """
+        Start reading a solution's stdout with the output limit applied.
+        
+        The process is killed as soon as its output exceeds the limit; check
+        the capture's 'exceeded' flag before judging the exit code.
+        
+        Args:
+            process: Process with a stdout pipe
+            retain: Characters kept in full (None = all); head and tail beyond
+            hash_output: Compute the normalized digest for comparison
+        
+        Returns:
+            OutputCapture: Started capture
+        """
+        return OutputCapture(
+            process.stdout,
+            output_limit_chars(self.output_limit_mb),
+            on_limit=process.kill,
+            retain=retain,
+            hash_output=hash_output,
+        ).start()
+    
+    def _output_limit_message(self) -> str:
+        return f"Output Limit Exceeded (>{self.output_limit_mb:g}MB)"
+    
+    def _process_limits(self, role: str) -> Dict[str, Any]:
+        """
+        Get the Popen arguments applying the resource limits of a role.
+        
+        Use together with _limited_command().
+        
+        Args:
+            role: Role key ('generator', 'test', 'correct', 'validator')
+        
+        Returns:
+            Dict with preexec_fn when the role's stack limit needs the
+            fallback, else empty
+        """
+        preexec = self._stack_preexec.get(role)
+        return {"preexec_fn": preexec} if preexec is not None else {}
+    
+    def _limited_command(self, role: str, command: List[str]) -> List[str]:
+        """
+        Get the command of a role with its resource limits applied.
+        
+        Args:
+            role: Role key ('generator', 'test', 'correct', 'validator')
+            command: Execution command of the role
+        
+        Returns:
+            List[str]: The command behind the limit trampoline, or unchanged
+        """
+        prefix = self._stack_prefix.get(role)
+        if not prefix and self._placement_launcher and self._current_slot() is not None:
+            prefix = launcher_prefix(self._placement_launcher)
+        return prefix + list(command) if prefix else command
+    
+    def _start_warm_interpreters(self) -> None:
+        """Start one warm interpreter (or JVM pool) per enabled role."""
+        for role, language in self._warm_roles.items():
+            command = self.execution_commands.get(role)
+            if not command:
+                continue
+            if language == "java":
+                warm = WarmJvmPool(command, size=self.max_workers)
+            else:
+                warm = WarmInterpreter(command)
+            if warm.start():
+                self._warm_interpreters[role] = warm
+                if language == "java":
+                    self._cap_concurrency(warm.size)
+    
+    def _cap_concurrency(self, size: int) -> None:
+        """
+        Keep adaptive concurrency within a pool of persistent JVMs.
+        
+        JVMs are started up front, one per test in flight; tests beyond the
+        pool would wait for a JVM inside their measured time.
+        """
+        if self.concurrency and self.concurrency.ceiling > size:
+            self.concurrency = AdaptiveConcurrency(
+                min(self.concurrency.initial, size), size
+            )
+    
+    def _stop_warm_interpreters(self) -> None:
+        """Shut down all warm interpreters."""
+        for warm in self._warm_interpreters.values():
+            warm.close()
+        self._warm_interpreters.clear()
+    
+    def _launch_process(self, role: str, command: List[str], **popen_kwargs):
+        """
+        Launch the process of a role.
+        
+        Single entry point for starting generator/solution/validator processes,
+        so alternative launch strategies apply to all workers alike.
+        
+        Args:
+            role: Role key ('generator', 'test', 'correct', 'validator')
+            command: Execution command of the role
+            **popen_kwargs: Arguments for subprocess.Popen
+        
+        Returns:
+            subprocess.Popen (or a compatible handle)
+        """
+        slot = self._current_slot()
+        warm = self._warm_interpreters.get(role)
+        if warm is not None:
+            try:
+                process = warm.spawn(
+                    stdin=popen_kwargs.get("stdin"),
+                    env=popen_kwargs.get("env"),
+                    args=command[len(warm.command):],
+                )
+                # A persistent JVM is shared by many tests: its pid is the
+                # JVM, so pinning it would move the whole pool
+                if isinstance(process, WarmJavaProcess):
+                    self._note_placement(False)
+                else:
+                    self._note_placement(self._pin_process(process, slot))
+                return process
+            except OSError as e:
+                logger.warning(f"Warm interpreter for {role} failed, launching directly: {e}")
+        
+        if slot is not None and self._placement_launcher:
+            popen_kwargs["env"] = placement_environment(slot, popen_kwargs.get("env"))
+        process = subprocess.Popen(
+            self._limited_command(role, command), **self._process_limits(role), **popen_kwargs
+        )
+        if self._placement_launcher:
+            self._note_placement(True)
+        else:
+            self._note_placement(self._pin_process(process, slot))
+        return process
+    
+    @staticmethod
+    def _pin_process(process, slot: Optional[CoreSlot]) -> bool:
+        """
+        Pin a started process to a slot's CPUs (without memory binding).
+        
+        Returns:
+            bool: True if the process was pinned
+        """
+        pid = getattr(process, "pid", None)
+        if slot is None or not isinstance(pid, int) or not hasattr(os, "sched_setaffinity"):
+            return False
+        try:
+            os.sched_setaffinity(pid, slot.cpus)
+        except OSError as e:
+            logger.debug(f"Could not pin process {pid}: {e}")
+            return False
+        return True
+    
     def stop(self) -> None:
         """
         Stop the worker and cancel any running tests.
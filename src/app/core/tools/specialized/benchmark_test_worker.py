@@ -8,17 +8,54 @@ This worker implements the 2-stage benchmark testing process:
 Maintains exact signal signatures and behavior from the original inline implementation.
 """
 
+import logging
 import os
+import signal
 import subprocess
+import tempfile
 import time
-from typing import Any, Dict, Optional
+from typing import Any, Dict, Iterable, List, Optional, Tuple
 
 import psutil
-from PySide6.QtCore import Signal
+
+from src.app.core.tools.base.alloc_profiler import profiler_environment, read_report
+from src.app.core.tools.base.allocators import variant_environment
+from src.app.core.tools.base.calibration import class_factor, measure_machine_profile, speed_factors
+from src.app.core.tools.base.hdr_histogram import ResourceHistograms
+from src.app.core.tools.base.instruction_counter import (
+    DEFAULT_REFERENCE_IPS,
+    DEFAULT_TIMING_MODE,
+    counter_environment,
+    estimate_time,
+    read_counts,
+    watchdog_timeout,
+)
+from src.app.core.tools.base.io_profile import (
+    has_exited,
+    io_profiling_supported,
+    read_io_counters,
+    summarize_io,
+)
+from src.app.core.tools.base.output_capture import display_excerpt
+from src.app.core.tools.base.process_limits import (
+    STACK_OVERFLOW_RATIO,
+    inherited_stack_limit_kb,
+    read_stack_kb,
+)
+from src.app.core.tools.base.qt_compat import Signal
+from src.app.core.tools.base.sample_profiler import (
+    MIN_PROFILE_TIMEOUT,
+    PROFILE_TIME_LIMIT_FACTOR,
+    read_profile,
+    sampler_environment,
+)
+from src.app.core.tools.base.warm_java_pool import WarmJavaProcess
 
 # Import base worker with shared functionality
 from src.app.core.tools.specialized.base_test_worker import BaseTestWorker
 
+logger = logging.getLogger(__name__)
+
 
 class BenchmarkTestWorker(BaseTestWorker):
     """
@@ -44,6 +81,14 @@ class BenchmarkTestWorker(BaseTestWorker):
         test_count: int = 1,
         max_workers: Optional[int] = None,
         execution_commands: Optional[Dict[str, list]] = None,
+        alloc_profiler: Optional[str] = None,
+        profile_command: Optional[List[str]] = None,
+        sampler: Optional[str] = None,
+        profile_count: int = 0,
+        timing_mode: str = DEFAULT_TIMING_MODE,
+        counter: Optional[str] = None,
+        reference_ips: float = DEFAULT_REFERENCE_IPS,
+        role_environments: Optional[Dict[str, Dict[str, str]]] = None,
     ):
         """
         Initialize the TLE test worker.
@@ -57,6 +102,20 @@ class BenchmarkTestWorker(BaseTestWorker):
             max_workers: Maximum number of parallel workers (auto-detected if None)
             execution_commands: Dictionary with 'generator' and 'test' execution command lists
                               (e.g., ['python', 'gen.py'] or ['./test.exe']). If provided, overrides executables.
+            alloc_profiler: Path of the allocation interposer library; when set, the test
+                            solution runs with it preloaded and each result gets an
+                            'allocations' summary
+            profile_command: Execution command of the frame-pointer build of the test
+                             solution; with sampler and profile_count the slowest
+                             tests are re-run under the sampler after the run
+            sampler: Path of the sampling profiler library
+            profile_count: Number of slowest tests to profile (0 = off)
+            timing_mode: Time tests are judged by: 'wall', 'cpu' or 'instructions';
+                         in the latter two the measured wall time is kept as 'wall_time'
+            counter: Path of the instruction counter library (preloaded if set)
+            reference_ips: Instructions per second of the reference machine
+            role_environments: Keys of execution_commands mapped to environment
+                               overrides of their runs (allocator experiments)
         """
         # Call base class initialization - handles common setup
         super().__init__(
@@ -70,6 +129,65 @@ class BenchmarkTestWorker(BaseTestWorker):
         # Benchmark-specific attributes
         self.time_limit = time_limit / 1000.0  # Convert ms to seconds
         self.memory_limit = memory_limit  # MB
+
+        # Wall/CPU/RSS distributions, updated as each test completes
+        self.resource_histograms = ResourceHistograms()
+
+        # Allocation profiling
+        self.alloc_profiler = alloc_profiler
+
+        # Load-independent timing from CPU time or retired instructions
+        self.timing_mode = timing_mode
+        self.counter = counter
+        self.reference_ips = reference_ips
+
+        # Environment overrides per solution key (e.g. a preloaded allocator)
+        self.role_environments = dict(role_environments or {})
+
+        # Reports of preloaded libraries live in a temporary directory per run
+        self._report_dir: Optional[str] = None
+
+        # Post-pass: CPU profiles of the slowest tests
+        self.profile_command = profile_command
+        self.sampler = sampler
+        self.profile_count = profile_count
+
+        # Time-limit calibration: (reference profile, compiler, workload
+        # class) until the suite has run, then the speed factors
+        self._calibration_settings: Optional[Tuple[Dict[str, Any], str, str]] = None
+        self.calibration: Optional[Dict[str, float]] = None
+
+    def set_calibration(self, reference: Dict[str, Any], compiler: str, workload_class: str) -> None:
+        """
+        Scale the time limit to this machine before the tests run.
+
+        The kernel suite is built and timed at the start of run_tests(), on
+        the worker thread; the factors are kept as self.calibration.
+
+        Args:
+            reference: Kernel profile of the reference (judge) machine
+            compiler: C++ compiler for building the suite
+            workload_class: Workload class the limit is scaled for
+        """
+        self._calibration_settings = (reference, compiler, workload_class)
+
+    def _calibrate(self) -> None:
+        """Measure this machine against the reference profile and scale the time limit."""
+        if self._calibration_settings is None:
+            return
+        reference, compiler, workload_class = self._calibration_settings
+        self._calibration_settings = None
+
+        local = measure_machine_profile(compiler)
+        if local is None:
+            logger.warning("Calibration suite unavailable, using raw time limits")
+            return
+        factors = speed_factors(local, reference)
+        if factors is None:
+            logger.warning("Invalid reference profile, using raw time limits")
+            return
+        self.calibration = factors
+        self.time_limit *= class_factor(factors, workload_class)
     
     def _calculate_optimal_workers(self) -> int:
         """
@@ -84,6 +202,87 @@ class BenchmarkTestWorker(BaseTestWorker):
         import multiprocessing
         return min(4, max(1, multiprocessing.cpu_count() - 1))
     
+    def run_tests(self) -> None:
+        """Calibrate the time limit, then run all tests with allocation and counter reports in a temporary directory."""
+        self._calibrate()
+        if not self.alloc_profiler and not self.counter:
+            super().run_tests()
+            return
+
+        with tempfile.TemporaryDirectory(prefix="cts_reports_") as report_dir:
+            self._report_dir = report_dir
+            try:
+                super().run_tests()
+            finally:
+                self._report_dir = None
+
+    def _execute_tests(self, wrapped_test, test_numbers: Optional[Iterable[int]] = None) -> bool:
+        """Run all tests, then profile the slowest ones before completion is signalled."""
+        all_passed = super()._execute_tests(wrapped_test, test_numbers)
+        if self.profile_command and self.sampler and self.profile_count > 0:
+            self._profile_slowest_tests()
+        return all_passed
+
+    def _profile_slowest_tests(self) -> None:
+        """
+        Re-run the inputs of the slowest tests under the sampling profiler.
+
+        Runs one test at a time so the profiles are not skewed by the other
+        tests; each profile is attached to its result as 'profile'.
+        """
+        with self._results_lock:
+            candidates = [r for r in self.test_results if r.get("input")]
+        candidates.sort(
+            key=lambda r: max(r.get("cpu_time", 0), r.get("execution_time", 0)), reverse=True
+        )
+
+        with tempfile.TemporaryDirectory(prefix="cts_prof_") as report_dir:
+            for result in candidates[: self.profile_count]:
+                if not self.is_running:
+                    return
+                report = os.path.join(report_dir, f"test_{result['test_number']}.json")
+                result["profile"] = self._profile_test(result["input"], report)
+
+    def _profile_test(self, input_text: str, report_path: str) -> Dict[str, Any]:
+        """
+        Run one input under the sampler and read its profile.
+
+        Returns:
+            Dict[str, Any]: Profile from read_profile(), or {'error': ...}
+        """
+        timeout = max(MIN_PROFILE_TIMEOUT, self.time_limit * PROFILE_TIME_LIMIT_FACTOR)
+        timed_out = False
+        try:
+            process = self._launch_process(
+                "test",
+                self.profile_command,
+                stdin=subprocess.PIPE,
+                stdout=subprocess.DEVNULL,
+                stderr=subprocess.DEVNULL,
+                env=sampler_environment(self.sampler, report_path),
+                text=True,
+            )
+            try:
+                process.communicate(input_text, timeout=timeout)
+            except subprocess.TimeoutExpired:
+                # SIGTERM lets the sampler write what it has collected
+                timed_out = True
+                process.terminate()
+                try:
+                    process.communicate(timeout=5)
+                except subprocess.TimeoutExpired:
+                    process.kill()
+                    process.wait()
+        except OSError as e:
+            return {"error": f"Profiled run failed: {e}"}
+
+        profile = read_profile(report_path)
+        if profile is None:
+            return {"error": "Profiled run wrote no samples"}
+        if timed_out:
+            profile["stopped_after"] = timeout
+        return profile
+
     def _emit_test_completed(self, test_result: Dict[str, Any]) -> None:
         """
         Emit the testCompleted signal with benchmark-specific parameters.
@@ -93,6 +292,7 @@ class BenchmarkTestWorker(BaseTestWorker):
         Args:
             test_result: Dictionary containing test result data
         """
+        self.resource_histograms.record_result(test_result)
         self.testCompleted.emit(
             test_result["test_name"],
             test_result["test_number"],
@@ -123,202 +323,398 @@ class BenchmarkTestWorker(BaseTestWorker):
             return None
 
         try:
-            # Stage 1: Generate test input
-            generator_start = time.time()
-
-            # Use numeric constant for CREATE_NO_WINDOW (0x08000000) to avoid
-            # AttributeError on non-Windows platforms during testing
-            generator_result = subprocess.run(
-                self.execution_commands["generator"],
-                stdout=subprocess.PIPE,
-                stderr=subprocess.PIPE,
-                creationflags=0x08000000 if os.name == "nt" else 0,
-                timeout=10,
-                text=True,
-            )
+            input_text, generator_time, error_msg = self._generate_input(test_number)
+            if error_msg:
+                return self._create_error_result(test_number, error_msg)
 
-            generator_time = time.time() - generator_start
+            # Stage 2: Run test with performance monitoring
+            return self._measure_solution(test_number, input_text, generator_time)
 
-            if generator_result.returncode != 0:
-                error_msg = f"Generator failed: {generator_result.stderr}"
-                return self._create_error_result(test_number, error_msg)
+        except Exception as e:
+            error_msg = f"Unexpected error in test {test_number}: {str(e)}"
+            return self._create_error_result(test_number, error_msg)
 
-            # Get generated input
-            input_text = generator_result.stdout
+    def _generate_input(self, test_number: int) -> Tuple[str, float, Optional[str]]:
+        """
+        Run the generator for a test.
 
-            # Stage 2: Run test with performance monitoring
-            test_start = time.time()
+        Returns:
+            Tuple[str, float, Optional[str]]: Input text, generator time and an
+            error message (None on success)
+        """
+        generator_start = time.time()
+
+        # Use numeric constant for CREATE_NO_WINDOW (0x08000000) to avoid
+        # AttributeError on non-Windows platforms during testing
+        generator_result = subprocess.run(
+            self.execution_commands["generator"],
+            stdout=subprocess.PIPE,
+            stderr=subprocess.PIPE,
+            env=self._generator_env(test_number),
+            creationflags=0x08000000 if os.name == "nt" else 0,
+            timeout=10,
+            text=True,
+        )
 
-            # Start the test process
-            # Use numeric constant for CREATE_NO_WINDOW (0x08000000) to avoid
-            # AttributeError on non-Windows platforms during testing
-            process = subprocess.Popen(
-                self.execution_commands["test"],
-                stdin=subprocess.PIPE,
-                stdout=subprocess.PIPE,
-                stderr=subprocess.PIPE,
-                creationflags=0x08000000 if os.name == "nt" else 0,
-                text=True,
-            )
+        generator_time = time.time() - generator_start
 
-            # Monitor memory usage
-            max_memory_used = 0
-            memory_limit_exceeded = False
+        if generator_result.returncode != 0:
+            return "", generator_time, f"Generator failed: {generator_result.stderr}"
 
-            try:
-                # Get psutil process object for memory monitoring
-                ps_process = psutil.Process(process.pid)
-
-                # Write input to process (non-blocking)
-                if input_text:
-                    process.stdin.write(input_text)
-                    process.stdin.flush()
-                    process.stdin.close()  # Issue #7: Close stdin to signal EOF
-
-                # Issue #7: Read output in thread to prevent pipe deadlock
-                stdout_data = []
-                stderr_data = []
-                
-                def read_stdout():
-                    stdout_data.append(process.stdout.read())
-                
-                def read_stderr():
-                    stderr_data.append(process.stderr.read())
-                
-                import threading
-                stdout_thread = threading.Thread(target=read_stdout, daemon=True)
-                stderr_thread = threading.Thread(target=read_stderr, daemon=True)
-                stdout_thread.start()
-                stderr_thread.start()
-
-                # Monitor memory usage while process runs (output being read in background)
-                while process.poll() is None and self.is_running:  # Issue #7: Check is_running
-                    try:
+        return generator_result.stdout, generator_time, None
+
+    def _measure_solution(
+        self,
+        test_number: int,
+        input_text: str,
+        generator_time: float,
+        role: str = "test",
+        hash_output: bool = False,
+    ) -> Optional[Dict[str, Any]]:
+        """
+        Run one solution on a generated input while monitoring time and memory.
+
+        Args:
+            test_number: The test number
+            input_text: Generated input
+            generator_time: Time the generator took
+            role: Key of the solution in execution_commands
+            hash_output: Record the normalized digest of the output as 'output_hash'
+
+        Returns:
+            Dictionary with test result details, or None if cancelled
+        """
+        test_start = time.time()
+
+        # Preload the allocation interposer and instruction counter when enabled
+        alloc_report = None
+        count_report = None
+        test_env = None
+        if role in self.role_environments:
+            test_env = variant_environment(self.role_environments[role])
+        if self.alloc_profiler and self._report_dir:
+            alloc_report = os.path.join(self._report_dir, f"{role}_{test_number}.json")
+            test_env = profiler_environment(self.alloc_profiler, alloc_report, base_env=test_env)
+        if self.counter and self._report_dir:
+            count_report = os.path.join(self._report_dir, f"{role}_{test_number}.count.json")
+            test_env = counter_environment(self.counter, count_report, base_env=test_env)
+
+        # Start the test process
+        # Use numeric constant for CREATE_NO_WINDOW (0x08000000) to avoid
+        # AttributeError on non-Windows platforms during testing
+        process = self._launch_process(
+            role,
+            self.execution_commands[role],
+            stdin=subprocess.PIPE,
+            stdout=subprocess.PIPE,
+            stderr=subprocess.PIPE,
+            env=test_env,
+            creationflags=0x08000000 if os.name == "nt" else 0,
+            text=True,
+        )
+
+        # Monitor memory usage, stack size (VmStk) and CPU time
+        max_memory_used = 0
+        max_stack_kb = 0
+        cpu_time = 0.0
+        io_counters = None
+        memory_limit_exceeded = False
+
+        # Exited children are left unreaped until their /proc counters are read
+        io_probe = isinstance(process, subprocess.Popen) and io_profiling_supported()
+
+        # A persistent JVM runs many tests: its RSS, stack and CPU time are
+        # not this test's (it is judged by wall time)
+        own_process = not isinstance(process, WarmJavaProcess)
+
+        try:
+            # Get psutil process object for memory monitoring
+            ps_process = psutil.Process(process.pid)
+
+            # Write input to process (non-blocking)
+            if input_text:
+                process.stdin.write(input_text)
+                process.stdin.flush()
+                process.stdin.close()  # Issue #7: Close stdin to signal EOF
+
+            # Issue #7: Read output in thread to prevent pipe deadlock
+            # (stdout up to the output limit)
+            stderr_data = []
+            
+            def read_stderr():
+                stderr_data.append(process.stderr.read())
+            
+            import threading
+            stdout_capture = self._capture_output(process, hash_output=hash_output)
+            stderr_thread = threading.Thread(target=read_stderr, daemon=True)
+            stderr_thread.start()
+
+            # Monitor memory usage while process runs (output being read in background)
+            while self._process_running(process, io_probe) and self.is_running:  # Issue #7: Check is_running
+                try:
+                    if own_process:
                         memory_info = ps_process.memory_info()
                         memory_used_mb = memory_info.rss / (
                             1024 * 1024
                         )  # Convert to MB
                         max_memory_used = max(max_memory_used, memory_used_mb)
-                    except (psutil.NoSuchProcess, psutil.AccessDenied):
-                        # Process finished
-                        break
-
-                    # Small sleep to avoid busy-waiting (Issue #5: optimized from 0.001 to 0.01)
-                    time.sleep(0.01)
-
-                    # Check if time limit exceeded during monitoring
-                    if time.time() - test_start > self.time_limit:
-                        process.kill()
-                        process.wait()
-                        test_time = time.time() - test_start
-
-                        # Calculate test size
-                        test_size = (
-                            len(input_text.strip().split("\n"))
-                            if input_text.strip()
-                            else 0
-                        )
-
-                        return {
-                            "test_name": f"Test {test_number}",
-                            "test_number": test_number,
-                            "passed": False,
-                            "execution_time": test_time,
-                            "memory_used": max_memory_used,
-                            "memory_passed": max_memory_used <= self.memory_limit,
-                            "error_details": f"Time Limit Exceeded ({self.time_limit:.2f}s)",
-                            "generator_time": generator_time,
-                            "input": input_text,
-                            "output": "",
-                            "test_size": test_size,
-                        }
-
-                # Get final memory reading
-                try:
+                        cpu_time = self._read_cpu_time(ps_process, cpu_time)
+                        max_stack_kb = max(max_stack_kb, read_stack_kb(process.pid) or 0)
+                except (psutil.NoSuchProcess, psutil.AccessDenied):
+                    # Process finished
+                    break
+
+                # Small sleep to avoid busy-waiting (Issue #5: optimized from 0.001 to 0.01)
+                time.sleep(0.01)
+
+                # Check if time limit exceeded during monitoring (in CPU/instruction
+                # timing only hangs are killed; the limit is checked on exit)
+                if time.time() - test_start > watchdog_timeout(self.timing_mode, self.time_limit):
+                    process.kill()
+                    process.wait()
+                    test_time = time.time() - test_start
+
+                    # Calculate test size
+                    test_size = (
+                        len(input_text.strip().split("\n"))
+                        if input_text.strip()
+                        else 0
+                    )
+
+                    result = {
+                        "test_name": f"Test {test_number}",
+                        "test_number": test_number,
+                        "passed": False,
+                        "execution_time": test_time,
+                        "cpu_time": cpu_time,
+                        "memory_used": max_memory_used,
+                        "stack_used": max_stack_kb / 1024,
+                        "memory_passed": max_memory_used <= self.memory_limit,
+                        "error_details": f"Time Limit Exceeded ({self.time_limit:.2f}s)",
+                        "generator_time": generator_time,
+                        "input": input_text,
+                        "output": "",
+                        "test_size": test_size,
+                    }
+                    if not own_process:
+                        self._drop_shared_readings(result)
+                    return result
+
+            # Final syscall and CPU counters of the exited (unreaped) process
+            if io_probe and self.is_running:
+                io_counters = read_io_counters(process.pid)
+                if io_counters:
+                    cpu_time = io_counters["user_time"] + io_counters["system_time"]
+
+            # Get final memory reading
+            try:
+                if own_process:
                     memory_info = ps_process.memory_info()
                     memory_used_mb = memory_info.rss / (1024 * 1024)  # Convert to MB
                     max_memory_used = max(max_memory_used, memory_used_mb)
-                except (psutil.NoSuchProcess, psutil.AccessDenied):
-                    # Process finished, use last known memory usage
-                    pass
-
-                # Issue #7: If stopped, kill process and return None
-                if not self.is_running:
-                    try:
-                        process.kill()
-                        process.wait(timeout=1)
-                    except:
-                        pass
-                    return None
-
-                # Wait for output reading threads to complete
-                stdout_thread.join(timeout=5)
-                stderr_thread.join(timeout=1)
-                process.wait(timeout=1)
-                
-                stdout = stdout_data[0] if stdout_data else ""
-                stderr = stderr_data[0] if stderr_data else ""
-
-            except (psutil.NoSuchProcess, psutil.AccessDenied, Exception) as e:
-                # Handle any errors during memory monitoring
-                # Process may have terminated unexpectedly
-                # Output reading threads should still complete
+                    cpu_time = self._read_cpu_time(ps_process, cpu_time)
+                    max_stack_kb = max(max_stack_kb, read_stack_kb(process.pid) or 0)
+            except (psutil.NoSuchProcess, psutil.AccessDenied):
+                # Process finished, use last known memory usage
+                pass
+
+            # Issue #7: If stopped, kill process and return None
+            if not self.is_running:
                 try:
-                    stdout_thread.join(timeout=1)
-                    stderr_thread.join(timeout=0.5)
-                    process.wait(timeout=0.5)
-                except:
                     process.kill()
-                    process.wait()
-                
-                stdout = stdout_data[0] if stdout_data else ""
-                stderr = stderr_data[0] if stderr_data else ""
-
-            test_time = time.time() - test_start
-
-            # Check if memory limit was exceeded
-            memory_passed = max_memory_used <= self.memory_limit
-            if not memory_passed:
-                memory_limit_exceeded = True
-
-            # Check process result
-            if process.returncode != 0:
-                error_msg = f"Test solution failed with exit code {process.returncode}: {stderr}"
-                return self._create_error_result(
-                    test_number, error_msg, test_time, max_memory_used
-                )
-
-            # Check if both time and memory limits were respected
-            time_passed = test_time <= self.time_limit
-            overall_passed = time_passed and memory_passed and process.returncode == 0
-
-            # Issue #6: REMOVED synchronous disk I/O during test execution
-            # Data is already stored in memory dictionary and database
-            # self._save_test_io(test_number, input_text, stdout)
-
-            # Calculate test size (number of input lines)
-            test_size = len(input_text.strip().split("\n")) if input_text.strip() else 0
-
-            return {
-                "test_name": f"Test {test_number}",
-                "test_number": test_number,
-                "passed": overall_passed,
-                "execution_time": test_time,
-                "memory_used": max_memory_used,
-                "memory_passed": memory_passed,
-                "time_passed": time_passed,
-                "error_details": self._get_error_details(
-                    time_passed, memory_passed, process.returncode
-                ),
-                "generator_time": generator_time,
-                "input": input_text,  # Store full input
-                "output": stdout if stdout else "",  # Store full output
-                "test_size": test_size,
-            }
+                    process.wait(timeout=1)
+                except:
+                    pass
+                return None
+
+            # Wait for output reading threads to complete
+            stdout_capture.join(timeout=5)
+            stderr_thread.join(timeout=1)
+            process.wait(timeout=1)
+            
+            stdout = stdout_capture.text
+            stderr = stderr_data[0] if stderr_data else ""
+
+        except (psutil.NoSuchProcess, psutil.AccessDenied, Exception) as e:
+            # Handle any errors during memory monitoring
+            # Process may have terminated unexpectedly
+            # Output reading threads should still complete
+            try:
+                stdout_capture.join(timeout=1)
+                stderr_thread.join(timeout=0.5)
+                process.wait(timeout=0.5)
+            except:
+                process.kill()
+                process.wait()
+            
+            stdout = stdout_capture.text
+            stderr = stderr_data[0] if stderr_data else ""
+
+        wall_time = time.time() - test_start
+
+        # Judge the test by CPU time or instructions in load-independent modes
+        counts = read_counts(count_report) if count_report else None
+        test_time, timing_source = estimate_time(
+            self.timing_mode, wall_time, cpu_time, counts, self.reference_ips
+        )
 
-        except Exception as e:
-            error_msg = f"Unexpected error in test {test_number}: {str(e)}"
-            return self._create_error_result(test_number, error_msg)
+        # Check if memory limit was exceeded
+        memory_passed = max_memory_used <= self.memory_limit
+        if not memory_passed:
+            memory_limit_exceeded = True
+
+        # The capture killed the solution once its output passed the limit
+        if stdout_capture.exceeded:
+            result = self._create_error_result(
+                test_number, self._output_limit_message(), test_time, max_memory_used
+            )
+            result["output_limit_exceeded"] = True
+            result["output_size"] = stdout_capture.size
+            result["input"] = input_text
+            result["output"] = display_excerpt(stdout)
+            if not own_process:
+                self._drop_shared_readings(result)
+            return result
+
+        # Check process result
+        if process.returncode != 0:
+            error_msg = f"Test solution failed with exit code {process.returncode}: {stderr}"
+            overflow = (
+                self._describe_stack_overflow(max_stack_kb, role)
+                if process.returncode == -signal.SIGSEGV
+                else None
+            )
+            if overflow:
+                error_msg = f"{overflow}, {error_msg}"
+            result = self._create_error_result(
+                test_number, error_msg, test_time, max_memory_used
+            )
+            result["stack_used"] = max_stack_kb / 1024
+            if not own_process:
+                self._drop_shared_readings(result)
+            return result
+
+        # Check if both time and memory limits were respected
+        time_passed = test_time <= self.time_limit
+        overall_passed = time_passed and memory_passed and process.returncode == 0
+
+        # Issue #6: REMOVED synchronous disk I/O during test execution
+        # Data is already stored in memory dictionary and database
+        # self._save_test_io(test_number, input_text, stdout)
+
+        # Calculate test size (number of input lines)
+        test_size = len(input_text.strip().split("\n")) if input_text.strip() else 0
+
+        result = {
+            "test_name": f"Test {test_number}",
+            "test_number": test_number,
+            "passed": overall_passed,
+            "execution_time": test_time,
+            "cpu_time": cpu_time,
+            "memory_used": max_memory_used,
+            "stack_used": max_stack_kb / 1024,
+            "memory_passed": memory_passed,
+            "time_passed": time_passed,
+            "error_details": self._get_error_details(
+                time_passed, memory_passed, process.returncode
+            ),
+            "generator_time": generator_time,
+            "input": input_text,  # Store full input
+            "output": display_excerpt(stdout) if stdout else "",  # Head/tail of large outputs
+            "test_size": test_size,
+        }
+
+        # Persistent JVMs report main() time and whether the JVM was cold
+        warm_timing = getattr(process, "warm_timing", None)
+        if isinstance(warm_timing, dict):
+            result["warm_timing"] = warm_timing
+        if not own_process:
+            self._drop_shared_readings(result)
+
+        if self.timing_mode != DEFAULT_TIMING_MODE:
+            result["wall_time"] = wall_time
+            result["timing_source"] = timing_source
+        if counts:
+            result["instructions"] = counts["instructions"]
+            if counts["task_clock"] is not None:
+                result["task_clock"] = counts["task_clock"]
+            if counts.get("error"):
+                result["counter_error"] = counts["error"]
+
+        if io_counters:
+            result["io"] = summarize_io(io_counters)
+        if hash_output:
+            result["output_hash"] = stdout_capture.digest
+
+        # The interposer writes its report when the solution exits
+        if alloc_report:
+            allocations = read_report(alloc_report)
+            if allocations is not None:
+                result["allocations"] = allocations
+
+        return result
+
+    @staticmethod
+    def _process_running(process, io_probe: bool) -> bool:
+        """
+        Check whether the solution is still running.
+
+        With io_probe the exit is detected without reaping, so the final
+        /proc counters of the process can still be read.
+        """
+        if io_probe:
+            exited = has_exited(process.pid)
+            if exited is not None:
+                return not exited
+        return process.poll() is None
+
+    @staticmethod
+    def _drop_shared_readings(result: Dict[str, Any]) -> None:
+        """
+        Mark a result of a test run in a persistent JVM.
+
+        Memory was not sampled (memory_measured False, so no memory verdict)
+        and the JVM's CPU time covers every test it ran, so it is left out.
+        """
+        result["memory_measured"] = False
+        result.pop("cpu_time", None)
+
+    @staticmethod
+    def _read_cpu_time(ps_process, last_cpu_time: float) -> float:
+        """
+        Read user + system CPU seconds of a running process.
+
+        Sampled with the memory polling, so the last few milliseconds of a
+        run may be missed; returns the previous reading once the process is gone.
+        """
+        try:
+            times = ps_process.cpu_times()
+            cpu_time = times.user + times.system
+        except (psutil.NoSuchProcess, psutil.AccessDenied, AttributeError):
+            return last_cpu_time
+        return cpu_time if isinstance(cpu_time, float) else last_cpu_time
+
+    def _describe_stack_overflow(self, stack_kb: int, role: str = "test") -> Optional[str]:
+        """
+        Describe a segfault that likely exhausted the stack limit.
+
+        Args:
+            stack_kb: Largest VmStk sample of the crashed run
+            role: Role of the crashed solution
+
+        Returns:
+            Optional[str]: Message prefix, None if the stack was not close to a finite limit
+        """
+        if role in self.stack_limits:
+            limit_kb = self._stack_limit_kb(role)
+        else:
+            limit_kb = inherited_stack_limit_kb()
+        if limit_kb is None or stack_kb < limit_kb * STACK_OVERFLOW_RATIO:
+            return None
+        return (
+            f"Likely stack overflow ({stack_kb / 1024:.1f} MB of "
+            f"{limit_kb / 1024:.0f} MB stack used when last sampled)"
+        )
 
     def _get_error_details(
         self, time_passed: bool, memory_passed: bool, exit_code: int
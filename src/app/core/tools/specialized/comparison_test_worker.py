@@ -7,20 +7,48 @@ This worker implements the 3-stage comparison testing process:
 3. Correct solution → processes same input to produce expected output
 4. Compare outputs for correctness
 
+In tiered mode the optimized test binary does the bulk of the work, and a
+sanitizer build of the same source re-runs every failing input plus a
+seed-sampled fraction of the passing ones to catch undefined behavior.
+
 Maintains exact signal signatures and behavior from the original inline implementation.
 """
 
 import os
 import subprocess
 import time
-from typing import Any, Dict, Optional
+from typing import Any, Dict, List, Optional
 
 import psutil
-from PySide6.QtCore import Signal
+
+from src.app.core.tools.base.output_capture import (
+    COMPARISON_RETAIN_CHARS,
+    first_difference,
+    normalized_digest,
+)
+from src.app.core.tools.base.qt_compat import Signal
+from src.app.core.tools.base.seeds import is_sampled
 
 # Import base worker with shared functionality
 from src.app.core.tools.specialized.base_test_worker import BaseTestWorker
 
+# Sanitizer runtime options: leaks are not UB, and stack traces make reports useful
+SANITIZER_ENV = {
+    "ASAN_OPTIONS": "detect_leaks=0",
+    "UBSAN_OPTIONS": "print_stacktrace=1",
+}
+
+# Markers printed by ASan/UBSan when they find a problem
+SANITIZER_REPORT_MARKERS = (
+    "ERROR: AddressSanitizer",
+    "runtime error:",
+    "SUMMARY: UndefinedBehaviorSanitizer",
+)
+
+# Sanitized binaries are several times slower than the optimized build
+SANITIZER_TIMEOUT = 60.0
+SANITIZER_REPORT_LIMIT = 4000
+
 
 class ComparisonTestWorker(BaseTestWorker):
     """
@@ -44,6 +72,9 @@ class ComparisonTestWorker(BaseTestWorker):
         test_count: int,
         max_workers: Optional[int] = None,
         execution_commands: Optional[Dict[str, list]] = None,
+        run_seed: Optional[int] = None,
+        sanitizer_command: Optional[List[str]] = None,
+        sanitizer_sample_rate: float = 0.0,
     ):
         """
         Initialize the comparison test worker.
@@ -55,6 +86,11 @@ class ComparisonTestWorker(BaseTestWorker):
             max_workers: Maximum number of parallel workers (auto-detected if None)
             execution_commands: Dictionary with 'generator', 'test', 'correct' execution command lists
                               (e.g., ['python', 'gen.py'] or ['./test.exe']). If provided, overrides executables.
+            run_seed: Seed of the run; test N's generator seed is derived from it
+            sanitizer_command: Execution command of the sanitized test build.
+                               Enables tiered mode when provided.
+            sanitizer_sample_rate: Fraction of passing tests replayed through the
+                                   sanitized build (failures are always replayed)
         """
         # Call base class initialization - handles common setup
         super().__init__(
@@ -62,8 +98,11 @@ class ComparisonTestWorker(BaseTestWorker):
             executables=executables,
             test_count=test_count,
             max_workers=max_workers,
-            execution_commands=execution_commands
+            execution_commands=execution_commands,
+            run_seed=run_seed,
         )
+        self.sanitizer_command = sanitizer_command
+        self.sanitizer_sample_rate = sanitizer_sample_rate
     
     def _calculate_optimal_workers(self) -> int:
         """
@@ -98,6 +137,23 @@ class ComparisonTestWorker(BaseTestWorker):
         )
 
     def _run_single_test(self, test_number: int) -> Optional[Dict[str, Any]]:
+        """
+        Run a single comparison test, then the sanitizer tier if enabled.
+
+        Args:
+            test_number: The test number to run
+
+        Returns:
+            Dictionary with test result details, or None if cancelled
+        """
+        result = self._run_comparison(test_number)
+
+        if result is None or not self.sanitizer_command or not self.is_running:
+            return result
+
+        return self._apply_sanitizer_tier(test_number, result)
+
+    def _run_comparison(self, test_number: int) -> Optional[Dict[str, Any]]:
         """
         Run a single comparison test with output comparison and metrics tracking.
 
@@ -126,10 +182,12 @@ class ComparisonTestWorker(BaseTestWorker):
 
             # Use numeric constant for CREATE_NO_WINDOW (0x08000000) to avoid
             # AttributeError on non-Windows platforms during testing
-            generator_process = subprocess.Popen(
+            generator_process = self._launch_process(
+                "generator",
                 self.execution_commands["generator"],
                 stdout=subprocess.PIPE,
                 stderr=subprocess.PIPE,
+                env=self._generator_env(test_number),
                 creationflags=0x08000000 if os.name == "nt" else 0,
                 text=True,
             )
@@ -196,7 +254,8 @@ class ComparisonTestWorker(BaseTestWorker):
 
             # Use numeric constant for CREATE_NO_WINDOW (0x08000000) to avoid
             # AttributeError on non-Windows platforms during testing
-            test_process = subprocess.Popen(
+            test_process = self._launch_process(
+                "test",
                 self.execution_commands["test"],
                 stdin=subprocess.PIPE,
                 stdout=subprocess.PIPE,
@@ -212,18 +271,16 @@ class ComparisonTestWorker(BaseTestWorker):
             test_process.stdin.close()  # Issue #7: Close stdin to signal EOF
 
             # Issue #7: Read output in thread to prevent pipe deadlock
-            test_stdout_data = []
+            # (stdout up to the output limit)
             test_stderr_data = []
             
-            def read_test_stdout():
-                test_stdout_data.append(test_process.stdout.read())
-            
             def read_test_stderr():
                 test_stderr_data.append(test_process.stderr.read())
             
-            test_stdout_thread = threading.Thread(target=read_test_stdout, daemon=True)
+            test_stdout_capture = self._capture_output(
+                test_process, retain=COMPARISON_RETAIN_CHARS, hash_output=True
+            )
             test_stderr_thread = threading.Thread(target=read_test_stderr, daemon=True)
-            test_stdout_thread.start()
             test_stderr_thread.start()
 
             # Track test solution memory while output is being read in background
@@ -244,6 +301,7 @@ class ComparisonTestWorker(BaseTestWorker):
                             generator_time,
                             30.0,
                             peak_memory_mb=peak_memory_mb,
+                            input_text=input_text,
                         )
             except (psutil.NoSuchProcess, psutil.AccessDenied):
                 pass
@@ -258,14 +316,26 @@ class ComparisonTestWorker(BaseTestWorker):
                 return None
 
             # Wait for output reading threads to complete
-            test_stdout_thread.join(timeout=30)
+            test_stdout_capture.join(timeout=30)
             test_stderr_thread.join(timeout=1)
             test_process.wait(timeout=1)
             
-            test_stdout = test_stdout_data[0] if test_stdout_data else ""
+            test_stdout = test_stdout_capture.text
             test_stderr = test_stderr_data[0] if test_stderr_data else ""
             test_time = time.time() - test_start
 
+            if test_stdout_capture.exceeded:
+                result = self._create_error_result(
+                    test_number,
+                    self._output_limit_message(),
+                    generator_time,
+                    test_time,
+                    peak_memory_mb=peak_memory_mb,
+                    input_text=input_text,
+                )
+                result["output_limit_exceeded"] = True
+                return result
+
             if test_process.returncode != 0:
                 error_msg = f"Test solution failed: {test_stderr}"
                 return self._create_error_result(
@@ -274,6 +344,7 @@ class ComparisonTestWorker(BaseTestWorker):
                     generator_time,
                     test_time,
                     peak_memory_mb=peak_memory_mb,
+                    input_text=input_text,
                 )
 
             # Get test output
@@ -284,7 +355,8 @@ class ComparisonTestWorker(BaseTestWorker):
 
             # Use numeric constant for CREATE_NO_WINDOW (0x08000000) to avoid
             # AttributeError on non-Windows platforms during testing
-            correct_process = subprocess.Popen(
+            correct_process = self._launch_process(
+                "correct",
                 self.execution_commands["correct"],
                 stdin=subprocess.PIPE,
                 stdout=subprocess.PIPE,
@@ -300,18 +372,16 @@ class ComparisonTestWorker(BaseTestWorker):
             correct_process.stdin.close()  # Issue #7: Close stdin to signal EOF
 
             # Issue #7: Read output in thread to prevent pipe deadlock
-            correct_stdout_data = []
+            # (stdout up to the output limit)
             correct_stderr_data = []
             
-            def read_correct_stdout():
-                correct_stdout_data.append(correct_process.stdout.read())
-            
             def read_correct_stderr():
                 correct_stderr_data.append(correct_process.stderr.read())
             
-            correct_stdout_thread = threading.Thread(target=read_correct_stdout, daemon=True)
+            correct_stdout_capture = self._capture_output(
+                correct_process, retain=COMPARISON_RETAIN_CHARS, hash_output=True
+            )
             correct_stderr_thread = threading.Thread(target=read_correct_stderr, daemon=True)
-            correct_stdout_thread.start()
             correct_stderr_thread.start()
 
             # Track correct solution memory while output is being read in background
@@ -347,14 +417,25 @@ class ComparisonTestWorker(BaseTestWorker):
                 return None
 
             # Wait for output reading threads to complete
-            correct_stdout_thread.join(timeout=30)
+            correct_stdout_capture.join(timeout=30)
             correct_stderr_thread.join(timeout=1)
             correct_process.wait(timeout=1)
             
-            correct_stdout = correct_stdout_data[0] if correct_stdout_data else ""
+            correct_stdout = correct_stdout_capture.text
             correct_stderr = correct_stderr_data[0] if correct_stderr_data else ""
             correct_time = time.time() - correct_start
 
+            if correct_stdout_capture.exceeded:
+                return self._create_error_result(
+                    test_number,
+                    f"Correct solution {self._output_limit_message()}",
+                    generator_time,
+                    test_time,
+                    correct_time,
+                    peak_memory_mb,
+                    input_text=input_text,
+                )
+
             if correct_process.returncode != 0:
                 error_msg = f"Correct solution failed: {correct_stderr}"
                 return self._create_error_result(
@@ -369,15 +450,18 @@ class ComparisonTestWorker(BaseTestWorker):
             # Get correct output
             correct_output = correct_stdout
 
-            # Stage 4: Compare outputs
+            # Stage 4: Compare outputs by the digests hashed while reading them
+            # (whitespace stripped at both ends); only mismatches are diffed
             comparison_start = time.time()
 
-            # Normalize outputs for comparison (strip whitespace)
-            test_output_normalized = test_output.strip()
-            correct_output_normalized = correct_output.strip()
-
-            # Check if outputs match
-            outputs_match = test_output_normalized == correct_output_normalized
+            outputs_match = test_stdout_capture.digest == correct_stdout_capture.digest
+            difference = None
+            if (
+                not outputs_match
+                and test_stdout_capture.complete
+                and correct_stdout_capture.complete
+            ):
+                difference = first_difference(test_output, correct_output)
 
             comparison_time = time.time() - comparison_start
 
@@ -389,7 +473,7 @@ class ComparisonTestWorker(BaseTestWorker):
             total_time = generator_time + test_time + correct_time + comparison_time
 
             # Create result with metrics
-            return {
+            result = {
                 "test_number": test_number,
                 "passed": outputs_match,
                 "input": input_text.strip()[:300]
@@ -411,10 +495,18 @@ class ComparisonTestWorker(BaseTestWorker):
                 "total_time": total_time,
                 "memory": peak_memory_mb,  # Peak memory in MB
                 "error_details": "" if outputs_match else "Output mismatch",
-                "test_output_full": test_output,  # Full output for database
-                "correct_output_full": correct_output,  # Full output for database
+                # Outputs are stored for mismatches only (head and tail of large ones)
+                "test_output_full": "" if outputs_match else test_stdout_capture.excerpt(),
+                "correct_output_full": "" if outputs_match else correct_stdout_capture.excerpt(),
+                "test_output_size": test_stdout_capture.size,
+                "correct_output_size": correct_stdout_capture.size,
+                "test_output_hash": test_stdout_capture.digest,
+                "correct_output_hash": correct_stdout_capture.digest,
                 "input_full": input_text,  # Full input for database
             }
+            if difference:
+                result["diff"] = difference
+            return result
 
         except subprocess.TimeoutExpired as e:
             error_msg = (
@@ -429,6 +521,116 @@ class ComparisonTestWorker(BaseTestWorker):
                 test_number, error_msg, peak_memory_mb=peak_memory_mb
             )
 
+    def _apply_sanitizer_tier(
+        self, test_number: int, result: Dict[str, Any]
+    ) -> Dict[str, Any]:
+        """
+        Replay a test through the sanitized build when it is selected.
+
+        Failures of the test solution are always replayed; passing tests are
+        replayed when their seed falls into the sampled fraction. A sampled
+        pass that triggers a sanitizer report is turned into a failure.
+
+        Args:
+            test_number: The test number
+            result: Result of the optimized run
+
+        Returns:
+            The (possibly updated) result dictionary
+        """
+        error_details = result.get("error_details", "")
+        input_text = result.get("input_full", "")
+
+        if result.get("passed"):
+            if not is_sampled(self._test_seed(test_number), self.sanitizer_sample_rate):
+                return result
+            reason = "sample"
+        elif error_details == "Output mismatch" or error_details.startswith(
+            "Test solution failed"
+        ):
+            reason = "failure"
+        else:
+            return result  # Generator/correct failures and timeouts say nothing about UB
+
+        replay = self._run_sanitized(input_text)
+        replay["reason"] = reason
+
+        # Unknown when the replay did not finish or the correct solution never ran
+        output = replay.pop("output")
+        correct_hash = result.get("correct_output_hash")
+        if correct_hash is None and result.get("correct_output_full"):
+            correct_hash = normalized_digest(result["correct_output_full"])
+        replay["output_matches"] = (
+            normalized_digest(output) == correct_hash
+            if output is not None and correct_hash
+            else None
+        )
+
+        result["sanitizer_replay"] = replay
+
+        if replay["ub_detected"]:
+            if result.get("passed"):
+                result["passed"] = False
+                result["error_details"] = "Undefined behavior detected by sanitizer replay"
+            else:
+                result["error_details"] = (
+                    f"{error_details} (sanitizer replay detected undefined behavior)"
+                )
+
+        return result
+
+    def _run_sanitized(self, input_text: str) -> Dict[str, Any]:
+        """
+        Run the sanitized test build on an input.
+
+        Args:
+            input_text: Input of the test
+
+        Returns:
+            Dictionary with exit_code, report, ub_detected, time and output
+            (output is None if the run did not finish)
+        """
+        start = time.time()
+        try:
+            completed = subprocess.run(
+                self._limited_command("test", self.sanitizer_command),
+                input=input_text,
+                stdout=subprocess.PIPE,
+                stderr=subprocess.PIPE,
+                env={**os.environ, **SANITIZER_ENV},
+                creationflags=0x08000000 if os.name == "nt" else 0,
+                timeout=SANITIZER_TIMEOUT,
+                **self._process_limits("test"),
+                text=True,
+            )
+        except subprocess.TimeoutExpired:
+            return {
+                "exit_code": None,
+                "report": f"Sanitizer replay timeout (>{SANITIZER_TIMEOUT:.0f}s)",
+                "ub_detected": False,
+                "time": time.time() - start,
+                "output": None,
+            }
+        except Exception as e:
+            return {
+                "exit_code": None,
+                "report": f"Sanitizer replay failed to start: {e}",
+                "ub_detected": False,
+                "time": time.time() - start,
+                "output": None,
+            }
+
+        report = completed.stderr or ""
+        ub_detected = any(marker in report for marker in SANITIZER_REPORT_MARKERS)
+
+        return {
+            "exit_code": completed.returncode,
+            "report": report[:SANITIZER_REPORT_LIMIT] if ub_detected else "",
+            "ub_detected": ub_detected,
+            "time": time.time() - start,
+            "output": completed.stdout or "",
+        }
+
     def _create_error_result(
         self,
         test_number: int,
@@ -437,12 +639,14 @@ class ComparisonTestWorker(BaseTestWorker):
         test_time: float = 0.0,
         correct_time: float = 0.0,
         peak_memory_mb: float = 0.0,
+        input_text: str = "",
     ) -> Dict[str, Any]:
         """Create a standardized error result dictionary."""
         return {
             "test_number": test_number,
             "passed": False,
-            "input": "",
+            "input": input_text.strip()[:300]
+            + ("..." if len(input_text.strip()) > 300 else ""),
             "test_output": "",
             "correct_output": "",
             "generator_time": generator_time,
@@ -454,5 +658,5 @@ class ComparisonTestWorker(BaseTestWorker):
             "error_details": error_msg,
             "test_output_full": "",
             "correct_output_full": "",
-            "input_full": "",
+            "input_full": input_text,
         }
@@ -0,0 +1,207 @@
+"""
+DistributedTestWorker - Comparison testing sharded across worker agents.
+
+Instead of running tests in a local thread pool, this worker starts a
+broker (see base/distributed.py) and lets worker agents on other machines,
+or local agent processes, run the generator/test/correct pipeline. Test N
+gets the same generator seed as in a local run, so any failure can be
+replayed locally from its test number and the run seed.
+
+Runs of millions of tests do not fit in memory as result dictionaries:
+only failing tests are kept in full, passing tests are counted
+(unrecorded_passes) and their times summed.
+
+Emits the same signals as ComparisonTestWorker; memory is not measured
+remotely and is reported as 0.
+"""
+
+import logging
+import subprocess
+from typing import Any, Dict, List, Optional
+
+from src.app.core.tools.base.distributed import DEFAULT_ADDRESS, Broker, spawn_local_agents
+from src.app.core.tools.base.qt_compat import Signal
+from src.app.core.tools.specialized.base_test_worker import BaseTestWorker
+
+logger = logging.getLogger(__name__)
+
+# Seconds local agents get to exit after the run before they are killed
+AGENT_EXIT_TIMEOUT = 5.0
+
+
+class DistributedTestWorker(BaseTestWorker):
+    """Comparison tests executed by worker agents through a broker."""
+
+    testStarted = Signal(int, int)  # current test, total tests
+    testCompleted = Signal(
+        int, bool, str, str, str, float, float
+    )  # test number, passed, input, correct output, test output, time, memory
+    allTestsCompleted = Signal(bool)  # True if all passed
+
+    # The broker hands out and requeues the tests itself
+    supports_checkpoints = False
+
+    def __init__(
+        self,
+        workspace_dir: str,
+        executables: Dict[str, str],
+        test_count: int,
+        max_workers: Optional[int] = None,
+        execution_commands: Optional[Dict[str, list]] = None,
+        run_seed: Optional[int] = None,
+        address: str = DEFAULT_ADDRESS,
+        local_agents: int = 0,
+        agent_slots: Optional[int] = None,
+        chunk_tests: Optional[int] = None,
+        token: str = "",
+    ):
+        """
+        Initialize the distributed test worker.
+
+        Args:
+            workspace_dir: Directory containing test files and executables
+            executables: Dictionary with 'generator', 'test', 'correct' executable paths (legacy)
+            test_count: Number of tests to run
+            max_workers: Tests each local agent runs in parallel (None = agent_slots)
+            execution_commands: Dictionary with 'generator', 'test', 'correct' execution command lists
+            run_seed: Seed of the run; test N's generator seed is derived from it
+            address: Address the broker listens on ('HOST:PORT' or 'unix:PATH')
+            local_agents: Agents started on this machine (0 = remote agents only)
+            agent_slots: Tests each local agent runs in parallel (None = its CPU count)
+            chunk_tests: Tests per job handed to an agent (None = automatic)
+            token: Token agents must present
+        """
+        super().__init__(
+            workspace_dir=workspace_dir,
+            executables=executables,
+            test_count=test_count,
+            max_workers=max_workers if max_workers is not None else (agent_slots or 1),
+            execution_commands=execution_commands,
+            run_seed=run_seed,
+        )
+        self.address = address
+        self.local_agents = local_agents
+        self.agent_slots = agent_slots if agent_slots is not None else max_workers
+        self.chunk_tests = chunk_tests
+        self.token = token
+
+        self.broker: Optional[Broker] = None
+        self.broker_address: Optional[str] = None
+        self.unrecorded_passes = 0
+        self.time_totals = {"generator": 0.0, "test": 0.0, "correct": 0.0}
+        self.distribution: Dict[str, Any] = {}
+
+    def run_tests(self) -> None:
+        """Run all tests on the agents, emitting results as records arrive."""
+        all_passed = True
+        agents: List[subprocess.Popen] = []
+        try:
+            self.broker = Broker(
+                self.execution_commands,
+                self.run_seed,
+                self.test_count,
+                address=self.address,
+                chunk_tests=self.chunk_tests,
+                token=self.token,
+            )
+            self.broker_address = self.broker.start()
+            logger.info(f"Distributed run waiting for agents at {self.broker_address}")
+            if self.local_agents:
+                agents = spawn_local_agents(
+                    self.broker_address, self.local_agents, self.agent_slots, self.token
+                )
+
+            for agent_name, record in self.broker.records():
+                if not self.is_running:
+                    break
+                test_result = self._record_to_result(agent_name, record)
+                self.testStarted.emit(test_result["test_number"], self.test_count)
+                if test_result["passed"]:
+                    with self._results_lock:
+                        self.unrecorded_passes += 1
+                else:
+                    all_passed = False
+                    with self._results_lock:
+                        self.test_results.append(test_result)
+                self._emit_test_completed(test_result)
+                self.resultRecorded.emit(test_result)
+
+            if self.broker.completed_tests < self.test_count:
+                all_passed = False
+        except (OSError, ValueError) as e:
+            logger.error(f"Distributed run failed: {e}")
+            all_passed = False
+        finally:
+            if self.broker is not None:
+                self.broker.stop()
+                self.distribution = self.broker.summary()
+            self._wait_for_agents(agents)
+
+        self.allTestsCompleted.emit(all_passed)
+
+    def stop(self) -> None:
+        """Stop the worker; the broker tells the agents to stop."""
+        super().stop()
+        if self.broker is not None:
+            self.broker.stop()
+
+    def _record_to_result(self, agent_name: str, record: List[Any]) -> Dict[str, Any]:
+        """Turn an agent's verdict record into a comparison result dictionary."""
+        test_number, verdict, generator_ms, test_ms, correct_ms = record[:5]
+        details = record[5] if len(record) > 5 else {}
+        generator_time = generator_ms / 1000
+        test_time = test_ms / 1000
+        correct_time = correct_ms / 1000
+
+        with self._results_lock:
+            self.time_totals["generator"] += generator_time
+            self.time_totals["test"] += test_time
+            self.time_totals["correct"] += correct_time
+
+        passed = verdict == "OK"
+        return {
+            "test_number": test_number,
+            "passed": passed,
+            "verdict": verdict,
+            "input": details.get("input", ""),
+            "test_output": details.get("test_output", ""),
+            "correct_output": details.get("correct_output", ""),
+            "generator_time": generator_time,
+            "test_time": test_time,
+            "correct_time": correct_time,
+            "comparison_time": 0.0,
+            "total_time": generator_time + test_time + correct_time,
+            "memory": 0.0,
+            "error_details": "" if passed else details.get("error", verdict),
+            # Agents send excerpts only
+            "test_output_full": details.get("test_output", ""),
+            "correct_output_full": details.get("correct_output", ""),
+            "input_full": details.get("input", ""),
+            "test_seed": self._test_seed(test_number),
+            "agent": agent_name,
+        }
+
+    def _emit_test_completed(self, test_result: Dict[str, Any]) -> None:
+        """Emit testCompleted with the comparison signature."""
+        self.testCompleted.emit(
+            test_result["test_number"],
+            test_result["passed"],
+            test_result["input"],
+            test_result["correct_output"],
+            test_result["test_output"],
+            test_result["total_time"],
+            test_result["memory"],
+        )
+
+    def _run_single_test(self, test_number: int) -> Optional[Dict[str, Any]]:
+        """Tests run on the agents; see run_tests()."""
+        raise NotImplementedError("DistributedTestWorker runs tests on agents")
+
+    @staticmethod
+    def _wait_for_agents(agents: List[subprocess.Popen]) -> None:
+        for process in agents:
+            try:
+                process.wait(timeout=AGENT_EXIT_TIMEOUT)
+            except subprocess.TimeoutExpired:
+                process.kill()
+                process.wait()
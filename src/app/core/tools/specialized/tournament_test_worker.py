@@ -0,0 +1,94 @@
+"""
+TournamentTestWorker - Benchmarks several solutions on shared inputs.
+
+Each test generates its input once and runs every solution on it, one
+after another, in an order shuffled per test from the test seed. The
+result of the 'test' solution is reported as usual (signals, histograms,
+profiling); the measurements of all solutions are attached as
+'tournament' and ranked by core.tools.base.tournament.
+
+Solutions of one test never overlap, but tests still run in parallel;
+run with max_workers=1 for the least noisy comparison.
+"""
+
+import random
+from typing import Any, Dict, List, Optional
+
+from src.app.core.tools.specialized.benchmark_test_worker import BenchmarkTestWorker
+
+# Result fields kept per solution in the 'tournament' entry
+_ENTRY_FIELDS = (
+    "passed",
+    "execution_time",
+    "cpu_time",
+    "wall_time",
+    "memory_used",
+    "instructions",
+    "error_details",
+    "output_hash",
+)
+
+
+class TournamentTestWorker(BenchmarkTestWorker):
+    """Benchmark worker running all solutions of a tournament on every input."""
+
+    def __init__(self, *args, solutions: Optional[Dict[str, str]] = None, **kwargs):
+        """
+        Initialize the tournament worker.
+
+        Args:
+            *args: Positional arguments of BenchmarkTestWorker
+            solutions: Keys of execution_commands to run mapped to their labels;
+                       must contain 'test'
+            **kwargs: Keyword arguments of BenchmarkTestWorker
+        """
+        super().__init__(*args, **kwargs)
+        self.solutions = dict(solutions or {"test": "test"})
+        if "test" not in self.solutions:
+            raise ValueError("Tournament solutions must include 'test'")
+
+    def _run_order(self, test_number: int) -> List[str]:
+        """Shuffled run order of the solutions, reproducible from the test seed."""
+        order = list(self.solutions)
+        random.Random(self._test_seed(test_number)).shuffle(order)
+        return order
+
+    def _run_single_test(self, test_number: int) -> Optional[Dict[str, Any]]:
+        """
+        Generate one input and run every solution on it.
+
+        Returns:
+            Dictionary with the 'test' solution's result plus 'tournament'
+            (solution key -> measurements and run position), or None if cancelled
+        """
+        if not self.is_running:
+            return None
+
+        try:
+            input_text, generator_time, error_msg = self._generate_input(test_number)
+            if error_msg:
+                return self._create_error_result(test_number, error_msg)
+
+            order = self._run_order(test_number)
+            results = {}
+            for key in order:
+                result = self._measure_solution(
+                    test_number, input_text, generator_time, role=key, hash_output=True
+                )
+                if result is None:
+                    return None
+                results[key] = result
+
+            primary = results["test"]
+            primary["tournament"] = {
+                key: {
+                    **{field: results[key][field] for field in _ENTRY_FIELDS if field in results[key]},
+                    "position": order.index(key),
+                }
+                for key in self.solutions
+            }
+            return primary
+
+        except Exception as e:
+            error_msg = f"Unexpected error in test {test_number}: {str(e)}"
+            return self._create_error_result(test_number, error_msg)
@@ -16,7 +16,8 @@ import time
 from typing import Any, Dict, Optional
 
 import psutil
-from PySide6.QtCore import Signal
+
+from src.app.core.tools.base.qt_compat import Signal
 
 # Import base worker with shared functionality
 from src.app.core.tools.specialized.base_test_worker import BaseTestWorker
@@ -128,10 +129,12 @@ class ValidatorTestWorker(BaseTestWorker):
             try:
                 # Use numeric constant for CREATE_NO_WINDOW (0x08000000) to avoid
                 # AttributeError on non-Windows platforms during testing
-                generator_process = subprocess.Popen(
+                generator_process = self._launch_process(
+                    "generator",
                     self.execution_commands["generator"],
                     stdout=subprocess.PIPE,
                     stderr=subprocess.PIPE,
+                    env=self._generator_env(test_number),
                     creationflags=0x08000000 if os.name == "nt" else 0,
                     text=True,
                 )
@@ -213,7 +216,8 @@ class ValidatorTestWorker(BaseTestWorker):
 
             # Use numeric constant for CREATE_NO_WINDOW (0x08000000) to avoid
             # AttributeError on non-Windows platforms during testing
-            test_process = subprocess.Popen(
+            test_process = self._launch_process(
+                "test",
                 self.execution_commands["test"],
                 stdin=subprocess.PIPE,
                 stdout=subprocess.PIPE,
@@ -229,18 +233,14 @@ class ValidatorTestWorker(BaseTestWorker):
             test_process.stdin.close()  # Issue #7: Close stdin to signal EOF
 
             # Issue #7: Read output in thread to prevent pipe deadlock
-            test_stdout_data = []
+            # (stdout up to the output limit)
             test_stderr_data = []
             
-            def read_test_stdout():
-                test_stdout_data.append(test_process.stdout.read())
-            
             def read_test_stderr():
                 test_stderr_data.append(test_process.stderr.read())
             
-            test_stdout_thread = threading.Thread(target=read_test_stdout, daemon=True)
+            test_stdout_capture = self._capture_output(test_process)
             test_stderr_thread = threading.Thread(target=read_test_stderr, daemon=True)
-            test_stdout_thread.start()
             test_stderr_thread.start()
 
             # Track test solution memory while output is being read in background
@@ -278,14 +278,28 @@ class ValidatorTestWorker(BaseTestWorker):
                 return None
 
             # Wait for output reading threads to complete
-            test_stdout_thread.join(timeout=30)
+            test_stdout_capture.join(timeout=30)
             test_stderr_thread.join(timeout=1)
             test_process.wait(timeout=1)
             
-            test_stdout = test_stdout_data[0] if test_stdout_data else ""
+            test_stdout = test_stdout_capture.text
             test_stderr = test_stderr_data[0] if test_stderr_data else ""
             test_time = time.time() - test_start
 
+            if test_stdout_capture.exceeded:
+                result = self._create_error_result(
+                    test_number,
+                    self._output_limit_message(),
+                    "Output Limit Exceeded",
+                    -1,
+                    generator_time,
+                    test_time,
+                    0,
+                    peak_memory_mb,
+                )
+                result["output_limit_exceeded"] = True
+                return result
+
             if test_process.returncode != 0:
                 error_msg = f"Test solution failed: {test_stderr}"
                 return self._create_error_result(
@@ -331,7 +345,8 @@ class ValidatorTestWorker(BaseTestWorker):
 
                 # Use numeric constant for CREATE_NO_WINDOW (0x08000000) to avoid
                 # AttributeError on non-Windows platforms during testing
-                validator_process = subprocess.Popen(
+                validator_process = self._launch_process(
+                    "validator",
                     validator_command,
                     stdout=subprocess.PIPE,
                     stderr=subprocess.PIPE,
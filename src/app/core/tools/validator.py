@@ -10,9 +10,8 @@ import json
 import os
 from datetime import datetime
 
-from PySide6.QtCore import Signal
-
 from src.app.core.tools.base.base_runner import BaseRunner
+from src.app.core.tools.base.qt_compat import Signal
 from src.app.core.tools.specialized.validator_test_worker import ValidatorTestWorker
 from src.app.database import TestResult
 
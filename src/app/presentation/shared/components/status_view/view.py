@@ -385,7 +385,7 @@ class StatusView(QWidget):
                 worker = runner.get_current_worker()
                 if worker is not None:
                     try:
-                        return worker.max_workers
+                        return getattr(worker, "worker_slots", worker.max_workers)
                     except AttributeError:
                         pass  # Worker doesn't have max_workers
             except AttributeError:
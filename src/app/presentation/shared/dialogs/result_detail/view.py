@@ -11,8 +11,8 @@ import os
 import zipfile
 from typing import Dict
 
-from PySide6.QtCore import Qt, Signal
-from PySide6.QtGui import QFont
+from PySide6.QtCore import Qt, QUrl, Signal
+from PySide6.QtGui import QDesktopServices, QFont
 from PySide6.QtWidgets import (
     QDialog,
     QFileDialog,
@@ -101,6 +101,11 @@ class DetailedResultDialog(QDialog):
             ("❌ Failed Tests", 3),
         ]
 
+        # CPU profiles of the slowest tests (benchmark runs with profiling)
+        self.profiled_tests = self.viewmodel.get_profiled_tests()
+        if self.profiled_tests:
+            detail_sections.append(("🔥 CPU Profiles", 4))
+
         self.nav_buttons = []
         for text, idx in detail_sections:
             btn = self.sidebar.add_button(text, details_section)
@@ -159,11 +164,13 @@ class DetailedResultDialog(QDialog):
         self.content_stack.setCurrentIndex(page_index)
 
     def _create_content_pages(self):
-        """Create 4 content pages: summary, code files, passed tests, failed tests."""
+        """Create content pages: summary, code files, passed/failed tests and CPU profiles."""
         self.content_stack.addWidget(self._create_summary_page())
         self.content_stack.addWidget(self._create_code_files_page())
         self.content_stack.addWidget(self._create_passed_tests_page())
         self.content_stack.addWidget(self._create_failed_tests_page())
+        if self.profiled_tests:
+            self.content_stack.addWidget(self._create_profiles_page())
 
     # Page Creation Methods
 
@@ -371,6 +378,96 @@ class DetailedResultDialog(QDialog):
 
         return page
 
+    def _create_profiles_page(self):
+        """Create page with the CPU profiles of the slowest tests."""
+        page = QWidget()
+        layout = QVBoxLayout(page)
+        layout.setContentsMargins(24, 24, 24, 24)
+        layout.setSpacing(16)
+
+        title = QLabel("🔥 CPU Profiles")
+        set_emoji_font(title)
+        title.setStyleSheet(
+            f"""
+            {bold_label(24, MATERIAL_COLORS['on_surface'])}
+        """
+        )
+        layout.addWidget(title)
+
+        hint = QLabel(
+            "Slowest tests re-run under a sampling profiler (debug build with frame pointers)"
+        )
+        hint.setStyleSheet(RESULTS_LABEL_DETAILS_STYLE)
+        layout.addWidget(hint)
+
+        scroll = QScrollArea()
+        scroll.setWidgetResizable(True)
+        scroll.setStyleSheet(RESULTS_SCROLL_STYLE)
+
+        scroll_content = QWidget()
+        scroll_layout = QVBoxLayout(scroll_content)
+        scroll_layout.setSpacing(12)
+        for test in self.profiled_tests:
+            scroll_layout.addWidget(self._create_profile_widget(test))
+        scroll_layout.addStretch()
+        scroll.setWidget(scroll_content)
+        layout.addWidget(scroll)
+
+        return page
+
+    def _create_profile_widget(self, test: Dict):
+        """Create widget with the hottest functions of one profiled test."""
+        widget = QFrame()
+        widget.setStyleSheet(RESULTS_CARD_STYLE)
+        layout = QVBoxLayout(widget)
+        layout.setSpacing(8)
+
+        data = self.viewmodel.get_profile_display_data(test)
+        header = QLabel(
+            f"Test #{data['test_number']}: {data['execution_time']:.4f}s, "
+            f"{data['samples']} samples"
+        )
+        header.setStyleSheet(
+            f"""
+            {bold_label(16, MATERIAL_COLORS['on_surface'])}
+        """
+        )
+        layout.addWidget(header)
+
+        if data["stopped_after"]:
+            stopped = QLabel(f"Profiled run stopped after {data['stopped_after']:.0f}s")
+            stopped.setStyleSheet(RESULTS_LABEL_DETAILS_STYLE)
+            layout.addWidget(stopped)
+
+        if data["error"]:
+            error_label = QLabel(str(data["error"]))
+            error_label.setWordWrap(True)
+            error_label.setStyleSheet(f"color: {MATERIAL_COLORS['error']};")
+            layout.addWidget(error_label)
+            return widget
+
+        report = self._create_code_viewer(data["report"])
+        report.setLineWrapMode(QTextEdit.LineWrapMode.NoWrap)
+        report.setMinimumHeight(240)
+        layout.addWidget(report)
+
+        if data["has_stacks"]:
+            buttons = QHBoxLayout()
+            flamegraph_btn = QPushButton("Open Flamegraph")
+            flamegraph_btn.setStyleSheet(RESULTS_BUTTON_STYLE)
+            flamegraph_btn.clicked.connect(lambda _, t=test: self._open_flamegraph(t))
+            buttons.addWidget(flamegraph_btn)
+
+            stacks_btn = QPushButton("Save Collapsed Stacks")
+            stacks_btn.setStyleSheet(RESULTS_BUTTON_STYLE)
+            stacks_btn.setToolTip("Folded stacks for flamegraph.pl or speedscope")
+            stacks_btn.clicked.connect(lambda _, t=test: self._save_collapsed_stacks(t))
+            buttons.addWidget(stacks_btn)
+            buttons.addStretch()
+            layout.addLayout(buttons)
+
+        return widget
+
     # Widget Creation Helper Methods
 
     def _create_code_viewer(self, code: str):
@@ -558,6 +655,36 @@ class DetailedResultDialog(QDialog):
                 "Export Failed", f"Failed to export results: {str(e)}", self
             )
 
+    def _open_flamegraph(self, test: Dict):
+        """Render the flamegraph of a profiled test and open it in the browser."""
+        try:
+            path = self.viewmodel.write_flamegraph(test)
+        except OSError as e:
+            ErrorHandlerService.instance().show_error(
+                "Flamegraph Failed", f"Failed to write flamegraph: {str(e)}", self
+            )
+            return
+        QDesktopServices.openUrl(QUrl.fromLocalFile(path))
+
+    def _save_collapsed_stacks(self, test: Dict):
+        """Save the collapsed stacks of a profiled test."""
+        error_service = ErrorHandlerService.instance()
+        file_path, _ = QFileDialog.getSaveFileName(
+            self,
+            "Save Collapsed Stacks",
+            f"test_{test.get('test_number', 'profile')}.folded",
+            "Collapsed Stacks (*.folded *.txt)",
+        )
+        if not file_path:
+            return  # User cancelled
+        try:
+            with open(file_path, "w", encoding="utf-8") as f:
+                f.write(self.viewmodel.get_collapsed_stacks(test))
+        except OSError as e:
+            error_service.show_error(
+                "Save Failed", f"Failed to save collapsed stacks: {str(e)}", self
+            )
+
     def _load_to_test(self):
         """Load code files to workspace for testing."""
         error_service = ErrorHandlerService.instance()
@@ -6,9 +6,13 @@ Pure Python business logic for detailed result dialog, separated from Qt UI.
 """
 
 import json
+import os
+import tempfile
 from typing import Dict, List, Optional, Tuple
 from datetime import datetime
 
+from src.app.core.tools.base.flamegraph import render_flamegraph
+from src.app.core.tools.base.sample_profiler import collapsed_text
 from src.app.database import TestResult
 
 
@@ -124,6 +128,11 @@ class DetailedResultViewModel:
         all_tests = self.get_test_details()
         return [t for t in all_tests if not self._is_test_passed(t)]
 
+    def get_profiled_tests(self) -> List[Dict]:
+        """Return test cases with a CPU profile, slowest first."""
+        profiled = [t for t in self.get_test_details() if isinstance(t.get("profile"), dict)]
+        return sorted(profiled, key=lambda t: t.get("execution_time", 0), reverse=True)
+
     def _is_test_passed(self, test: Dict) -> bool:
         """Check if a test case passed."""
         return test.get("passed", test.get("status", "").lower() == "pass")
@@ -195,6 +204,68 @@ class DetailedResultViewModel:
             "mismatch_analysis": test.get("mismatch_analysis", {}),
         }
 
+    def get_profile_display_data(self, test: Dict) -> Dict:
+        """Extract and format the CPU profile of a test case for display.
+
+        Args:
+            test: Test case dict with a 'profile' entry
+
+        Returns:
+            Dict with header fields and a plain-text report of the hottest
+            functions (self and total samples) and source lines
+        """
+        profile = test.get("profile", {})
+        lines = []
+        for title, key, name in (
+            ("Self time (leaf functions)", "top_self", "function"),
+            ("Total time (including callees)", "top_total", "function"),
+            ("Hot source lines", "hot_lines", "location"),
+        ):
+            entries = profile.get(key, [])
+            if not entries:
+                continue
+            lines.append(f"{title}:")
+            lines.extend(
+                f"  {entry['percent']:5.1f}%  {entry['samples']:>6}  {entry[name]}"
+                for entry in entries
+            )
+            lines.append("")
+
+        return {
+            "test_number": test.get("test_number", "?"),
+            "execution_time": test.get("execution_time", 0),
+            "samples": profile.get("samples", 0),
+            "stopped_after": profile.get("stopped_after"),
+            "error": profile.get("error", ""),
+            "report": "\n".join(lines).rstrip(),
+            "has_stacks": bool(profile.get("collapsed")),
+        }
+
+    def get_collapsed_stacks(self, test: Dict) -> str:
+        """Collapsed stacks of a profiled test (flamegraph.pl/speedscope input)."""
+        return collapsed_text(test.get("profile", {}))
+
+    def write_flamegraph(self, test: Dict, directory: Optional[str] = None) -> str:
+        """Render the flamegraph of a profiled test to an SVG file.
+
+        Args:
+            test: Test case dict with a 'profile' entry
+            directory: Target directory (default: the system temp directory)
+
+        Returns:
+            str: Path of the written SVG file
+        """
+        test_number = test.get("test_number", "?")
+        title = f"{self.test_result.project_name} - Test #{test_number}"
+        svg = render_flamegraph(test.get("profile", {}).get("collapsed", []), title)
+        path = os.path.join(
+            directory or tempfile.gettempdir(),
+            f"flamegraph_{self.test_result.id or 'unsaved'}_test{test_number}.svg",
+        )
+        with open(path, "w", encoding="utf-8") as f:
+            f.write(svg)
+        return path
+
     def has_code_files(self) -> bool:
         """Check if test result has any code files."""
         files = self.get_files_snapshot()
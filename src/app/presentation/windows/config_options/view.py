@@ -347,6 +347,38 @@ class ConfigView(QDialog):
         self.cpp_flags_input.setToolTip("Additional compiler flags (comma-separated)")
         cpp_layout.addWidget(self.cpp_flags_input)
 
+        # C++ Stack limit
+        cpp_stack_row = QWidget()
+        cpp_stack_layout = QHBoxLayout(cpp_stack_row)
+        cpp_stack_layout.setContentsMargins(0, 4, 0, 0)
+        cpp_stack_layout.setSpacing(8)
+
+        cpp_stack_label = QLabel("Stack Limit:")
+        cpp_stack_label.setFixedWidth(100)
+        cpp_stack_layout.addWidget(cpp_stack_label)
+
+        self.cpp_stack_limit_spin = QSpinBox()
+        self.cpp_stack_limit_spin.setRange(0, 4096)
+        self.cpp_stack_limit_spin.setValue(256)
+        self.cpp_stack_limit_spin.setSuffix(" MB")
+        self.cpp_stack_limit_spin.setSpecialValueText("Unlimited")
+        self.cpp_stack_limit_spin.setFixedHeight(28)
+        self.cpp_stack_limit_spin.setToolTip(
+            "Stack size for solutions (deep recursion); judges usually allow 256 MB"
+        )
+        cpp_stack_layout.addWidget(self.cpp_stack_limit_spin)
+        cpp_stack_layout.addStretch(1)
+
+        cpp_layout.addWidget(cpp_stack_row)
+
+        # Stress build (static, startup-minimized)
+        self.cpp_stress_build_checkbox = QCheckBox("Static stress build")
+        self.cpp_stress_build_checkbox.setToolTip(
+            "Link solutions statically without PIE and resolve symbols at load\n"
+            "(less process startup per test; needs static libraries, not on macOS)"
+        )
+        cpp_layout.addWidget(self.cpp_stress_build_checkbox)
+
         layout.addWidget(cpp_widget)
 
         # Separator
@@ -403,6 +435,14 @@ class ConfigView(QDialog):
         self.py_flags_input.setToolTip("Python interpreter flags (comma-separated)")
         py_layout.addWidget(self.py_flags_input)
 
+        # Warm interpreter pool
+        self.py_warm_pool_checkbox = QCheckBox("Keep interpreter warm between tests")
+        self.py_warm_pool_checkbox.setToolTip(
+            "Start the interpreter once per solution and fork it for every test\n"
+            "(skips interpreter startup; Linux/macOS only)"
+        )
+        py_layout.addWidget(self.py_warm_pool_checkbox)
+
         layout.addWidget(py_widget)
 
         # Separator
@@ -475,6 +515,21 @@ class ConfigView(QDialog):
         self.java_flags_input.setToolTip("Java compiler flags (comma-separated)")
         java_layout.addWidget(self.java_flags_input)
 
+        # JVM startup
+        self.java_cds_checkbox = QCheckBox("Create class data sharing archive")
+        self.java_cds_checkbox.setToolTip(
+            "Dump an AppCDS archive after compiling and reuse it on every run\n"
+            "(shorter JVM startup; JDK 13+)"
+        )
+        java_layout.addWidget(self.java_cds_checkbox)
+
+        self.java_warm_jvm_checkbox = QCheckBox("Keep JVM warm between tests")
+        self.java_warm_jvm_checkbox.setToolTip(
+            "Run every test in a persistent JVM with a fresh class loader\n"
+            "(skips JVM startup; Linux/macOS only)"
+        )
+        java_layout.addWidget(self.java_warm_jvm_checkbox)
+
         layout.addWidget(java_widget)
 
         return frame
@@ -13,10 +13,29 @@ using namespace __gnu_pbds;
 template <class T>
 using ordered_set = tree<T, null_type, less<T>, rb_tree_tag, tree_order_statistics_node_update>;
 
+/**
+ * @brief Shared random engine used by every generator in this header.
+ *
+ * The engine is seeded from the CTS_SEED environment variable when the test
+ * harness provides one, so a test input can be regenerated exactly from its
+ * seed. Without CTS_SEED it falls back to a random_device seed.
+ *
+ * @return Reference to the process-wide Mersenne Twister engine.
+ */
+inline mt19937_64 &generator_engine()
+{
+  static mt19937_64 gen([]
+                        {
+    if (const char *seed = getenv("CTS_SEED"))
+      return static_cast<unsigned long long>(strtoull(seed, nullptr, 10));
+    return static_cast<unsigned long long>(random_device()()); }());
+  return gen;
+}
+
 /**
  * @brief Generate a random value of type T in the range [l, r].
  *
- * This function uses a static random device and Mersenne Twister engine
+ * This function uses the shared Mersenne Twister engine from generator_engine()
  * to generate random values. It supports integral types, floating-point types,
  * and characters.
  *
@@ -29,8 +48,7 @@ using ordered_set = tree<T, null_type, less<T>, rb_tree_tag, tree_order_statisti
 template <typename T>
 T random(T l, T r)
 {
-  static random_device rd;
-  static mt19937_64 gen(rd());
+  mt19937_64 &gen = generator_engine();
   if (l > r)
     swap(l, r);
   if constexpr (is_floating_point_v<T>)
@@ -149,7 +167,7 @@ public:
   {
     this->resize(n);
     iota(this->begin(), this->end(), start);
-    shuffle(this->begin(), this->end(), mt19937(random_device()()));
+    shuffle(this->begin(), this->end(), generator_engine());
   }
 
   /**
@@ -196,7 +214,7 @@ public:
     {
       vector<T> v(r - l + 1);
       iota(v.begin(), v.end(), l);
-      shuffle(v.begin(), v.end(), mt19937(random_device()()));
+      shuffle(v.begin(), v.end(), generator_engine());
       this->assign(v.begin(), v.begin() + n);
     }
     else
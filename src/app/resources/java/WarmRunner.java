@@ -0,0 +1,110 @@
+import java.io.*;
+import java.lang.reflect.*;
+import java.net.*;
+import java.nio.charset.StandardCharsets;
+import java.util.*;
+
+/**
+ * Persistent JVM runner for Java solutions.
+ *
+ * Keeps one JVM alive and invokes the solution's main() once per test in a
+ * fresh classloader (so static state starts clean), with System.in/out/err
+ * redirected to the named pipes given by the client.
+ *
+ * Usage: java WarmRunner <class_dir> <class_name>
+ *
+ * Control protocol on stdin/stdout (tab-separated lines):
+ *   runner -> client: READY
+ *   client -> runner: RUN  in_fifo  out_fifo  err_fifo  seed  [args...]
+ *   runner -> client: STARTED                         (pipes are open)
+ *   runner -> client: DONE  exit_code  main_nanos  invocation
+ *
+ * System.exit() in the solution ends the JVM with that exit code; the client
+ * treats control EOF as the end of the test and starts a new JVM.
+ */
+public class WarmRunner {
+    private static volatile PrintStream currentOut;
+
+    public static void main(String[] args) throws Exception {
+        URL[] urls = { new File(args[0]).toURI().toURL() };
+        String className = args[1];
+
+        BufferedReader control = new BufferedReader(
+                new InputStreamReader(new FileInputStream(FileDescriptor.in), StandardCharsets.UTF_8));
+        PrintStream reply = new PrintStream(new FileOutputStream(FileDescriptor.out), true, "UTF-8");
+
+        // Verify the class once up front (and warm the class data sharing path)
+        try (URLClassLoader loader = new URLClassLoader(urls, ClassLoader.getPlatformClassLoader())) {
+            Class.forName(className, false, loader).getMethod("main", String[].class);
+        }
+
+        // Output written before System.exit() must not be lost
+        Runtime.getRuntime().addShutdownHook(new Thread(() -> {
+            PrintStream out = currentOut;
+            if (out != null) {
+                out.flush();
+            }
+        }));
+
+        reply.println("READY");
+
+        InputStream originalIn = System.in;
+        PrintStream originalOut = System.out;
+        PrintStream originalErr = System.err;
+        int invocation = 0;
+        String line;
+
+        while ((line = control.readLine()) != null) {
+            String[] parts = line.split("\t", -1);
+            if (parts.length < 5 || !parts[0].equals("RUN")) {
+                continue;
+            }
+            invocation++;
+
+            InputStream in = new BufferedInputStream(new FileInputStream(parts[1]), 1 << 16);
+            PrintStream out = new PrintStream(new BufferedOutputStream(new FileOutputStream(parts[2]), 1 << 16), false);
+            PrintStream err = new PrintStream(new FileOutputStream(parts[3]), true);
+            String[] mainArgs = Arrays.copyOfRange(parts, 5, parts.length);
+
+            if (parts[4].isEmpty()) {
+                System.clearProperty("cts.seed");
+            } else {
+                System.setProperty("cts.seed", parts[4]);
+            }
+
+            System.setIn(in);
+            System.setOut(out);
+            System.setErr(err);
+            currentOut = out;
+            reply.println("STARTED");
+
+            int exitCode = 0;
+            long start = System.nanoTime();
+            try (URLClassLoader loader = new URLClassLoader(urls, ClassLoader.getPlatformClassLoader())) {
+                Method main = Class.forName(className, true, loader).getMethod("main", String[].class);
+                main.invoke(null, (Object) mainArgs);
+            } catch (InvocationTargetException e) {
+                e.getCause().printStackTrace(err);
+                exitCode = 1;
+            } catch (Throwable t) {
+                t.printStackTrace(err);
+                exitCode = 1;
+            }
+            long elapsed = System.nanoTime() - start;
+
+            out.flush();
+            if (out.checkError()) {
+                exitCode = exitCode == 0 ? 1 : exitCode;
+            }
+            currentOut = null;
+            System.setIn(originalIn);
+            System.setOut(originalOut);
+            System.setErr(originalErr);
+            in.close();
+            out.close();
+            err.close();
+
+            reply.println("DONE\t" + exitCode + "\t" + elapsed + "\t" + invocation);
+        }
+    }
+}
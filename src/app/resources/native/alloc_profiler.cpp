@@ -0,0 +1,446 @@
+// Allocation profiler for benchmarked solutions (Linux/glibc, LD_PRELOAD).
+//
+// Built as a shared library by core/tools/base/alloc_profiler.py and
+// preloaded into the test process:
+//
+//     LD_PRELOAD=libcts_alloc.so CTS_ALLOC_REPORT=/tmp/report.json ./test
+//
+// Interposes malloc/calloc/realloc/free, the aligned allocators and the
+// global operator new/delete. Per process it counts allocations, frees,
+// reallocations, requested bytes, live and peak live bytes, a log2 histogram
+// of request sizes and the call sites that allocate most. Call sites are
+// collected with a bounded frame-pointer walk (only frames inside the main
+// thread's stack are followed). In binaries built without frame pointers
+// the frames after the first may be garbage; they do not resolve to a
+// module and are dropped when the report is read. CTS_ALLOC_DEPTH (1-4)
+// limits the walk. The report is written as JSON on exit; killed processes
+// produce no report.
+//
+// Live bytes use malloc_usable_size(), i.e. include allocator rounding.
+
+#include <malloc.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dlfcn.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+extern "C"
+{
+  void *__libc_malloc(size_t);
+  void *__libc_calloc(size_t, size_t);
+  void *__libc_realloc(void *, size_t);
+  void *__libc_memalign(size_t, size_t);
+  void __libc_free(void *);
+  extern void *__libc_stack_end;
+}
+
+namespace
+{
+
+constexpr int kSizeClasses = 48;   // log2 buckets of the request size
+constexpr int kSiteFrames = 4;     // return addresses kept per call site
+constexpr int kSiteSlots = 4096;   // open-addressing table (power of two)
+constexpr int kTopSites = 64;      // call sites written to the report
+constexpr uintptr_t kMaxStackWalk = 8u << 20;
+
+enum Kind
+{
+  KIND_MALLOC,
+  KIND_NEW,
+  KIND_REALLOC,
+};
+
+struct Site
+{
+  std::atomic<uint64_t> hash{0};  // 0 = free slot
+  uintptr_t frames[kSiteFrames];
+  std::atomic<uint64_t> count{0};
+  std::atomic<uint64_t> bytes{0};
+  std::atomic<uint64_t> classes{0};  // bit i = a request of size class i
+};
+
+std::atomic<uint64_t> g_allocs{0};
+std::atomic<uint64_t> g_news{0};
+std::atomic<uint64_t> g_reallocs{0};
+std::atomic<uint64_t> g_frees{0};
+std::atomic<uint64_t> g_bytes{0};
+std::atomic<int64_t> g_live{0};
+std::atomic<int64_t> g_peak_live{0};
+std::atomic<uint64_t> g_size_classes[kSizeClasses];
+std::atomic<uint64_t> g_dropped_sites{0};
+Site g_sites[kSiteSlots];
+
+std::atomic<bool> g_active{false};
+int g_depth = kSiteFrames;
+__thread bool t_in_hook __attribute__((tls_model("initial-exec"))) = false;
+
+int size_class(size_t size)
+{
+  int cls = size ? 64 - __builtin_clzll(static_cast<unsigned long long>(size)) : 0;
+  return cls < kSizeClasses ? cls : kSizeClasses - 1;
+}
+
+// Walks saved frame pointers from the hook's own frame (the library is
+// built with frame pointers). The hook's return address is always taken;
+// callers are only followed while the chain stays inside the main thread's
+// stack and moves upwards.
+int capture(uintptr_t *frames, void *hook_frame)
+{
+  auto fp = static_cast<uintptr_t *>(hook_frame);
+  int depth = 0;
+  frames[depth++] = fp[1];
+
+  auto top = reinterpret_cast<uintptr_t>(__libc_stack_end);
+  auto addr = reinterpret_cast<uintptr_t>(fp);
+  if (addr >= top || top - addr > kMaxStackWalk)
+    return depth;  // not on the main stack
+
+  while (depth < g_depth)
+  {
+    uintptr_t next = fp[0];
+    if (next <= addr || next + 2 * sizeof(uintptr_t) > top || (next & 7))
+      break;
+    fp = reinterpret_cast<uintptr_t *>(next);
+    addr = next;
+    if (fp[1] < 4096)
+      break;
+    frames[depth++] = fp[1];
+  }
+  return depth;
+}
+
+void record_site(void *hook_frame, size_t size)
+{
+  uintptr_t frames[kSiteFrames] = {0};
+  capture(frames, hook_frame);
+
+  uint64_t hash = 1469598103934665603ULL;
+  for (uintptr_t frame : frames)
+    hash = (hash ^ frame) * 1099511628211ULL;
+  hash |= 1;
+
+  for (int probe = 0; probe < 64; ++probe)
+  {
+    Site &site = g_sites[(hash + probe) & (kSiteSlots - 1)];
+    uint64_t current = site.hash.load(std::memory_order_acquire);
+    if (current == 0)
+    {
+      uint64_t expected = 0;
+      if (site.hash.compare_exchange_strong(expected, hash))
+      {
+        memcpy(site.frames, frames, sizeof(frames));
+        current = hash;
+      }
+      else
+        current = expected;
+    }
+    if (current == hash)
+    {
+      site.count.fetch_add(1, std::memory_order_relaxed);
+      site.bytes.fetch_add(size, std::memory_order_relaxed);
+      site.classes.fetch_or(1ULL << size_class(size), std::memory_order_relaxed);
+      return;
+    }
+  }
+  g_dropped_sites.fetch_add(1, std::memory_order_relaxed);
+}
+
+void add_live(int64_t delta)
+{
+  int64_t live = g_live.fetch_add(delta, std::memory_order_relaxed) + delta;
+  int64_t peak = g_peak_live.load(std::memory_order_relaxed);
+  while (live > peak && !g_peak_live.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+  {
+  }
+}
+
+void on_alloc(void *ptr, size_t size, Kind kind, void *hook_frame)
+{
+  if (!ptr || !g_active.load(std::memory_order_relaxed) || t_in_hook)
+    return;
+  t_in_hook = true;
+  (kind == KIND_NEW ? g_news : kind == KIND_REALLOC ? g_reallocs : g_allocs)
+      .fetch_add(1, std::memory_order_relaxed);
+  g_bytes.fetch_add(size, std::memory_order_relaxed);
+  g_size_classes[size_class(size)].fetch_add(1, std::memory_order_relaxed);
+  add_live(static_cast<int64_t>(malloc_usable_size(ptr)));
+  record_site(hook_frame, size);
+  t_in_hook = false;
+}
+
+void on_free(void *ptr)
+{
+  if (!ptr || !g_active.load(std::memory_order_relaxed) || t_in_hook)
+    return;
+  g_frees.fetch_add(1, std::memory_order_relaxed);
+  add_live(-static_cast<int64_t>(malloc_usable_size(ptr)));
+}
+
+// Minimal buffered writer; the report must not allocate
+struct Writer
+{
+  int fd = -1;
+  char buf[4096];
+  size_t len = 0;
+
+  void flush()
+  {
+    size_t off = 0;
+    while (off < len)
+    {
+      ssize_t n = write(fd, buf + off, len - off);
+      if (n <= 0 && errno != EINTR)
+        break;
+      if (n > 0)
+        off += static_cast<size_t>(n);
+    }
+    len = 0;
+  }
+
+  void printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)))
+  {
+    char tmp[1024];
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(tmp, sizeof(tmp), fmt, args);
+    va_end(args);
+    if (n <= 0)
+      return;
+    size_t size = static_cast<size_t>(n) < sizeof(tmp) ? static_cast<size_t>(n) : sizeof(tmp) - 1;
+    if (len + size > sizeof(buf))
+      flush();
+    memcpy(buf + len, tmp, size);
+    len += size;
+  }
+
+  // JSON string without the characters that would need escaping
+  void string(const char *s)
+  {
+    char clean[512];
+    size_t i = 0;
+    for (; s && *s && i + 1 < sizeof(clean); ++s)
+      if (*s != '"' && *s != '\\' && static_cast<unsigned char>(*s) >= 0x20)
+        clean[i++] = *s;
+    clean[i] = '\0';
+    printf("\"%s\"", clean);
+  }
+};
+
+void write_frame(Writer &out, uintptr_t address)
+{
+  Dl_info info;
+  if (dladdr(reinterpret_cast<void *>(address), &info) && info.dli_fname)
+  {
+    // The main program is reported by the name it was started with
+    const char *module = info.dli_fname;
+    char exe[512];
+    if (module[0] != '/')
+    {
+      ssize_t n = readlink("/proc/self/exe", exe, sizeof(exe) - 1);
+      if (n > 0)
+      {
+        exe[n] = '\0';
+        module = exe;
+      }
+    }
+    // Return addresses point after the call; step back into it
+    uintptr_t offset = address - 1 - reinterpret_cast<uintptr_t>(info.dli_fbase);
+    out.printf("{\"module\": ");
+    out.string(module);
+    out.printf(", \"offset\": %lu, \"address\": %lu, \"symbol\": ", static_cast<unsigned long>(offset),
+               static_cast<unsigned long>(address - 1));
+    out.string(info.dli_sname ? info.dli_sname : "");
+    out.printf("}");
+  }
+  else
+    out.printf("{\"module\": \"\", \"offset\": %lu, \"address\": %lu, \"symbol\": \"\"}",
+               static_cast<unsigned long>(address - 1), static_cast<unsigned long>(address - 1));
+}
+
+void write_report()
+{
+  const char *path = getenv("CTS_ALLOC_REPORT");
+  if (!path || !*path)
+    return;
+  int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (fd < 0)
+    return;
+
+  Writer out;
+  out.fd = fd;
+  out.printf("{\"schema\": 1, \"allocations\": %lu, \"new_calls\": %lu, \"reallocations\": %lu, "
+             "\"frees\": %lu, \"bytes_requested\": %lu, \"live_bytes\": %ld, \"peak_live_bytes\": %ld, "
+             "\"dropped_sites\": %lu, \"size_classes\": [",
+             static_cast<unsigned long>(g_allocs.load()), static_cast<unsigned long>(g_news.load()),
+             static_cast<unsigned long>(g_reallocs.load()), static_cast<unsigned long>(g_frees.load()),
+             static_cast<unsigned long>(g_bytes.load()), static_cast<long>(g_live.load()),
+             static_cast<long>(g_peak_live.load()), static_cast<unsigned long>(g_dropped_sites.load()));
+  for (int cls = 0; cls < kSizeClasses; ++cls)
+    out.printf(cls ? ", %lu" : "%lu", static_cast<unsigned long>(g_size_classes[cls].load()));
+  out.printf("], \"sites\": [");
+
+  // Top sites by count, then by bytes (selection over the table, no
+  // allocation); the byte ranking catches buffers grown a few times
+  bool taken[kSiteSlots] = {};
+  for (int rank = 0; rank < kTopSites; ++rank)
+  {
+    bool by_count = rank < kTopSites * 3 / 4;
+    auto metric = [by_count](const Site &site)
+    { return by_count ? site.count.load() : site.bytes.load(); };
+    int best = -1;
+    for (int i = 0; i < kSiteSlots; ++i)
+      if (!taken[i] && g_sites[i].hash.load() && (best < 0 || metric(g_sites[i]) > metric(g_sites[best])))
+        best = i;
+    if (best < 0)
+      break;
+    taken[best] = true;
+    Site &site = g_sites[best];
+    out.printf("%s{\"count\": %lu, \"bytes\": %lu, \"size_classes\": %lu, \"frames\": [", rank ? ", " : "",
+               static_cast<unsigned long>(site.count.load()), static_cast<unsigned long>(site.bytes.load()),
+               static_cast<unsigned long>(site.classes.load()));
+    for (int f = 0; f < kSiteFrames && site.frames[f]; ++f)
+    {
+      if (f)
+        out.printf(", ");
+      write_frame(out, site.frames[f]);
+    }
+    out.printf("]}");
+  }
+  out.printf("]}\n");
+  out.flush();
+  close(fd);
+}
+
+__attribute__((constructor)) void profiler_start()
+{
+  if (const char *depth = getenv("CTS_ALLOC_DEPTH"))
+  {
+    int value = atoi(depth);
+    g_depth = value < 1 ? 1 : value > kSiteFrames ? kSiteFrames : value;
+  }
+  g_active.store(getenv("CTS_ALLOC_REPORT") != nullptr);
+}
+
+__attribute__((destructor)) void profiler_stop()
+{
+  if (!g_active.exchange(false))
+    return;
+  t_in_hook = true;
+  write_report();
+}
+
+void *checked_new(size_t size, void *hook_frame)
+{
+  void *ptr = __libc_malloc(size ? size : 1);
+  if (!ptr)
+    throw std::bad_alloc();
+  on_alloc(ptr, size, KIND_NEW, hook_frame);
+  return ptr;
+}
+
+} // namespace
+
+extern "C"
+{
+
+void *malloc(size_t size)
+{
+  void *ptr = __libc_malloc(size);
+  on_alloc(ptr, size, KIND_MALLOC, __builtin_frame_address(0));
+  return ptr;
+}
+
+void *calloc(size_t count, size_t size)
+{
+  void *ptr = __libc_calloc(count, size);
+  on_alloc(ptr, count * size, KIND_MALLOC, __builtin_frame_address(0));
+  return ptr;
+}
+
+void *realloc(void *old, size_t size)
+{
+  size_t old_usable = old ? malloc_usable_size(old) : 0;
+  void *ptr = __libc_realloc(old, size);
+  if (ptr && old && g_active.load(std::memory_order_relaxed) && !t_in_hook)
+  {
+    g_frees.fetch_add(1, std::memory_order_relaxed);
+    add_live(-static_cast<int64_t>(old_usable));
+  }
+  else if (!ptr && old && !size)
+    on_free(old);  // realloc(p, 0) frees p
+  on_alloc(ptr, size, old ? KIND_REALLOC : KIND_MALLOC, __builtin_frame_address(0));
+  return ptr;
+}
+
+void free(void *ptr)
+{
+  on_free(ptr);
+  __libc_free(ptr);
+}
+
+void *memalign(size_t alignment, size_t size)
+{
+  void *ptr = __libc_memalign(alignment, size);
+  on_alloc(ptr, size, KIND_MALLOC, __builtin_frame_address(0));
+  return ptr;
+}
+
+void *aligned_alloc(size_t alignment, size_t size)
+{
+  void *ptr = __libc_memalign(alignment, size);
+  on_alloc(ptr, size, KIND_MALLOC, __builtin_frame_address(0));
+  return ptr;
+}
+
+int posix_memalign(void **out, size_t alignment, size_t size)
+{
+  if (alignment < sizeof(void *) || (alignment & (alignment - 1)))
+    return EINVAL;
+  void *ptr = __libc_memalign(alignment, size);
+  if (!ptr)
+    return ENOMEM;
+  on_alloc(ptr, size, KIND_MALLOC, __builtin_frame_address(0));
+  *out = ptr;
+  return 0;
+}
+
+} // extern "C"
+
+void *operator new(size_t size)
+{
+  return checked_new(size, __builtin_frame_address(0));
+}
+
+void *operator new[](size_t size)
+{
+  return checked_new(size, __builtin_frame_address(0));
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+  void *ptr = __libc_malloc(size ? size : 1);
+  on_alloc(ptr, size, KIND_NEW, __builtin_frame_address(0));
+  return ptr;
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+  void *ptr = __libc_malloc(size ? size : 1);
+  on_alloc(ptr, size, KIND_NEW, __builtin_frame_address(0));
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept { free(ptr); }
+void operator delete[](void *ptr) noexcept { free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { free(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { free(ptr); }
+void operator delete(void *ptr, const std::nothrow_t &) noexcept { free(ptr); }
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept { free(ptr); }
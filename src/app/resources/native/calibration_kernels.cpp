@@ -0,0 +1,162 @@
+// Machine calibration micro-kernels for time-limit scaling.
+//
+// Built as an executable by core/tools/base/calibration.py and run on the
+// local machine (and once on a judge-like reference machine):
+//
+//     cts_calibrate [repetitions]
+//
+// Each kernel stands for a class of contest workloads and runs a fixed
+// amount of work; the best of the repetitions is printed as one JSON
+// object, kernel name -> seconds:
+//
+//   alu        dependent integer multiply/xor/shift chains (arithmetic loops)
+//   latency    pointer chase through a 32 MB random cycle (linked structures,
+//              random access into large arrays)
+//   bandwidth  streaming triad over 3 x 16 MB arrays (prefix sums, DP rows)
+//   branchy    data-dependent branches on random bytes (comparisons, search)
+//
+// The input data is generated from fixed seeds, so every machine runs the
+// same work; only the ratio of times between machines is meaningful.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+
+volatile uint64_t g_sink;
+
+uint64_t splitmix(uint64_t& state)
+{
+  uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+void kernel_alu()
+{
+  uint64_t a = 1, b = 2, c = 3;
+  for (uint32_t i = 0; i < 50000000u; ++i)
+  {
+    a = a * 6364136223846793005ULL + b;
+    b ^= a >> 17;
+    c += (a ^ b) << 3;
+  }
+  g_sink = a + b + c;
+}
+
+void kernel_latency()
+{
+  const size_t n = (32u << 20) / sizeof(uint32_t);
+  static std::vector<uint32_t> next;
+  if (next.empty())
+  {
+    // Sattolo's algorithm: a single cycle through all slots
+    next.resize(n);
+    for (size_t i = 0; i < n; ++i)
+      next[i] = static_cast<uint32_t>(i);
+    uint64_t state = 42;
+    for (size_t i = n - 1; i > 0; --i)
+    {
+      size_t j = splitmix(state) % i;
+      uint32_t t = next[i];
+      next[i] = next[j];
+      next[j] = t;
+    }
+  }
+  uint32_t p = 0;
+  for (uint32_t i = 0; i < 2000000u; ++i)
+    p = next[p];
+  g_sink = p;
+}
+
+void kernel_bandwidth()
+{
+  const size_t n = (16u << 20) / sizeof(double);
+  static std::vector<double> a, b, c;
+  if (a.empty())
+  {
+    a.assign(n, 0.0);
+    b.assign(n, 1.0);
+    c.assign(n, 2.0);
+  }
+  for (int round = 0; round < 20; ++round)
+  {
+    for (size_t i = 0; i < n; ++i)
+      a[i] = b[i] + 3.0 * c[i];
+    b.swap(a);
+  }
+  g_sink = static_cast<uint64_t>(b[n / 2]);
+}
+
+void kernel_branchy()
+{
+  const size_t n = 1u << 20;
+  static std::vector<uint8_t> data;
+  if (data.empty())
+  {
+    data.resize(n);
+    uint64_t state = 7;
+    for (size_t i = 0; i < n; ++i)
+      data[i] = static_cast<uint8_t>(splitmix(state));
+  }
+  uint64_t count = 0;
+  for (int round = 0; round < 20; ++round)
+  {
+    for (size_t i = 0; i < n; ++i)
+    {
+      // Kept as branches: the data decides, so prediction fails half the time
+      if (data[i] < 128)
+        count += data[i];
+      else if (data[i] & 1)
+        count ^= i;
+      else
+        count -= 3;
+    }
+  }
+  g_sink = count;
+}
+
+double best_seconds(void (*kernel)(), int repetitions)
+{
+  double best = 1e300;
+  for (int r = 0; r < repetitions; ++r)
+  {
+    auto start = std::chrono::steady_clock::now();
+    kernel();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (seconds < best)
+      best = seconds;
+  }
+  return best;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  int repetitions = argc > 1 ? atoi(argv[1]) : 3;
+  if (repetitions < 1)
+    repetitions = 1;
+
+  struct
+  {
+    const char* name;
+    void (*kernel)();
+  } kernels[] = {
+      {"alu", kernel_alu},
+      {"latency", kernel_latency},
+      {"bandwidth", kernel_bandwidth},
+      {"branchy", kernel_branchy},
+  };
+
+  printf("{");
+  for (size_t i = 0; i < sizeof(kernels) / sizeof(kernels[0]); ++i)
+    printf("%s\"%s\": %.6f", i ? ", " : "", kernels[i].name, best_seconds(kernels[i].kernel, repetitions));
+  printf("}\n");
+  return 0;
+}
@@ -0,0 +1,153 @@
+// Resource-limit exec trampoline for launched solutions (POSIX).
+//
+// Built as an executable by core/tools/base/process_limits.py and put in
+// front of the command of roles with a stack limit:
+//
+//     cts_rlimit_exec <stack soft> <stack hard> -- ./test arg...
+//
+// Sets RLIMIT_STACK (bytes, "inf", or "-" for both to keep the inherited
+// limit) and replaces itself with the command,
+// so the solution keeps the process ID and pipes the harness spawned. This
+// replaces a Python preexec_fn, which forces subprocess to fork() the whole
+// parent: with the GUI's large address space every spawn paid for copying
+// its page tables. Without preexec_fn, subprocess uses vfork(), whose cost
+// does not grow with the parent.
+//
+// With CTS_THP_DISABLE=1 in the environment (allocator experiments of
+// core/tools/base/allocators.py), transparent huge pages are disabled for
+// the command (PR_SET_THP_DISABLE, inherited across exec); the variable is
+// removed before exec.
+//
+// CTS_CPU_LIST (e.g. "3" or "3,35") pins the command to those CPUs and
+// CTS_MEMBIND_NODE binds its memory to one NUMA node (MPOL_BIND, no
+// libnuma needed); both are set by core/tools/base/cpu_topology.py for
+// benchmark runs, inherited across exec and removed before it.
+//
+// Exits with 127 if the command cannot be executed (like a shell) and 126
+// on bad arguments; setrlimit(), prctl(), sched_setaffinity() and
+// set_mempolicy() failures are reported but not fatal, the command then
+// runs with the inherited settings.
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <sched.h>
+#include <sys/prctl.h>
+#include <sys/syscall.h>
+#endif
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+
+bool parse_limit(const char* text, rlim_t* limit)
+{
+  if (strcmp(text, "inf") == 0)
+  {
+    *limit = RLIM_INFINITY;
+    return true;
+  }
+  char* end = nullptr;
+  errno = 0;
+  unsigned long long value = strtoull(text, &end, 10);
+  if (errno != 0 || end == text || *end != '\0')
+    return false;
+  *limit = static_cast<rlim_t>(value);
+  return true;
+}
+
+bool parse_cpu(const char* text, char** end, unsigned long* cpu)
+{
+  errno = 0;
+  *cpu = strtoul(text, end, 10);
+  return errno == 0 && *end != text;
+}
+
+#ifdef __linux__
+void apply_placement()
+{
+  const char* cpus = getenv("CTS_CPU_LIST");
+  if (cpus != nullptr)
+  {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    const char* p = cpus;
+    char* end = nullptr;
+    unsigned long cpu;
+    bool valid = true;
+    while (valid && *p != '\0')
+    {
+      valid = parse_cpu(p, &end, &cpu) && cpu < CPU_SETSIZE && (*end == ',' || *end == '\0');
+      if (valid)
+        CPU_SET(cpu, &set);
+      p = *end == ',' ? end + 1 : end;
+    }
+    if (!valid || CPU_COUNT(&set) == 0)
+      fprintf(stderr, "cts_rlimit_exec: bad CTS_CPU_LIST: %s\n", cpus);
+    else if (sched_setaffinity(0, sizeof(set), &set) != 0)
+      fprintf(stderr, "cts_rlimit_exec: sched_setaffinity: %s\n", strerror(errno));
+    unsetenv("CTS_CPU_LIST");
+  }
+
+  const char* node = getenv("CTS_MEMBIND_NODE");
+  if (node != nullptr)
+  {
+#ifdef SYS_set_mempolicy
+    const int mpol_bind = 2;
+    const unsigned long bits = 8 * sizeof(unsigned long);
+    unsigned long mask[16] = {};
+    char* end = nullptr;
+    unsigned long index;
+    if (!parse_cpu(node, &end, &index) || *end != '\0' || index >= 16 * bits)
+      fprintf(stderr, "cts_rlimit_exec: bad CTS_MEMBIND_NODE: %s\n", node);
+    else
+    {
+      mask[index / bits] |= 1UL << (index % bits);
+      if (syscall(SYS_set_mempolicy, mpol_bind, mask, 16 * bits + 1) != 0)
+        fprintf(stderr, "cts_rlimit_exec: set_mempolicy: %s\n", strerror(errno));
+    }
+#endif
+    unsetenv("CTS_MEMBIND_NODE");
+  }
+}
+#endif
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  rlimit stack;
+  bool keep_stack = argc >= 3 && strcmp(argv[1], "-") == 0 && strcmp(argv[2], "-") == 0;
+  if (argc < 5 || strcmp(argv[3], "--") != 0 ||
+      (!keep_stack && (!parse_limit(argv[1], &stack.rlim_cur) || !parse_limit(argv[2], &stack.rlim_max))))
+  {
+    fprintf(stderr, "usage: %s <stack soft|-> <stack hard|-> -- command [args...]\n", argv[0]);
+    return 126;
+  }
+
+  if (!keep_stack && setrlimit(RLIMIT_STACK, &stack) != 0)
+    fprintf(stderr, "cts_rlimit_exec: setrlimit(RLIMIT_STACK): %s\n", strerror(errno));
+
+#ifdef __linux__
+  apply_placement();
+#endif
+
+  const char* thp_disable = getenv("CTS_THP_DISABLE");
+  if (thp_disable != nullptr)
+  {
+#if defined(__linux__) && defined(PR_SET_THP_DISABLE)
+    if (strcmp(thp_disable, "1") == 0 && prctl(PR_SET_THP_DISABLE, 1, 0, 0, 0) != 0)
+      fprintf(stderr, "cts_rlimit_exec: prctl(PR_SET_THP_DISABLE): %s\n", strerror(errno));
+#endif
+    unsetenv("CTS_THP_DISABLE");
+  }
+
+  execvp(argv[4], argv + 4);
+  fprintf(stderr, "cts_rlimit_exec: %s: %s\n", argv[4], strerror(errno));
+  return 127;
+}
@@ -0,0 +1,425 @@
+// Sampling CPU profiler for benchmarked solutions (Linux, LD_PRELOAD).
+//
+// Built as a shared library by core/tools/base/sample_profiler.py and
+// preloaded into a frame-pointer build of the test solution:
+//
+//     LD_PRELOAD=libcts_prof.so CTS_PROF_REPORT=/tmp/profile.json ./test_profiled
+//
+// An ITIMER_PROF timer delivers SIGPROF every 1/CTS_PROF_HZ seconds of CPU
+// time (default 1000 Hz; the effective rate is bounded by the kernel tick).
+// The handler takes the interrupted PC and walks the saved frame pointers of
+// the main thread's stack, then counts the stack in a lock-free table. Other
+// threads only contribute their PC. GCC sets up no frame in leaf functions
+// that need no stack even with -fno-omit-frame-pointer, which would drop
+// the caller of every leaf; on x86-64 the word at the stack pointer is
+// therefore taken as the leaf's return address when it points right after
+// a call instruction in an executable segment. On exit (or SIGTERM, so runs that are
+// stopped for taking too long still report) the most frequent stacks are
+// written as JSON: a module table plus [module, offset, address, symbol]
+// frames, innermost first. Symbolization happens when the report is read.
+
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <link.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+extern "C"
+{
+  extern void *__libc_stack_end;
+}
+
+namespace
+{
+
+constexpr int kMaxFrames = 64;      // frames kept per sample
+constexpr int kStackSlots = 8192;   // open-addressing table (power of two)
+constexpr int kTopStacks = 1024;    // stacks written to the report
+constexpr int kMaxModules = 128;
+constexpr int kMaxCodeRanges = 64;
+constexpr uintptr_t kMaxStackWalk = 1ul << 30;
+
+struct Stack
+{
+  std::atomic<uint64_t> hash{0};  // 0 = free slot
+  std::atomic<uint64_t> count{0};
+  int depth = 0;
+  uintptr_t frames[kMaxFrames];
+};
+
+Stack g_stacks[kStackSlots];
+std::atomic<uint64_t> g_samples{0};
+std::atomic<uint64_t> g_dropped{0};
+std::atomic<bool> g_active{false};
+std::atomic<bool> g_reported{false};
+int g_hz = 1000;
+
+// Executable segments loaded at startup (for the leaf return address check)
+struct CodeRange
+{
+  uintptr_t start;
+  uintptr_t end;
+};
+CodeRange g_code[kMaxCodeRanges];
+int g_code_count = 0;
+
+int collect_code_range(dl_phdr_info *info, size_t, void *)
+{
+  for (int i = 0; i < info->dlpi_phnum && g_code_count < kMaxCodeRanges; ++i)
+  {
+    const auto &header = info->dlpi_phdr[i];
+    if (header.p_type == PT_LOAD && (header.p_flags & PF_X))
+    {
+      uintptr_t start = info->dlpi_addr + header.p_vaddr;
+      g_code[g_code_count++] = {start, start + header.p_memsz};
+    }
+  }
+  return 0;
+}
+
+bool in_code(uintptr_t address, uintptr_t before)
+{
+  for (int i = 0; i < g_code_count; ++i)
+    if (address >= g_code[i].start + before && address < g_code[i].end)
+      return true;
+  return false;
+}
+
+// Whether the address follows a call (rel32, or indirect through a register/memory)
+bool follows_call(uintptr_t address)
+{
+#if defined(__x86_64__)
+  if (!in_code(address, 7))
+    return false;
+  auto *code = reinterpret_cast<const unsigned char *>(address);
+  if (code[-5] == 0xE8)
+    return true;
+  static const int kIndirectLengths[] = {2, 3, 6, 7};
+  for (int length : kIndirectLengths)
+    if (code[-length] == 0xFF && ((code[-length + 1] >> 3) & 7) == 2)
+      return true;
+#else
+  (void)address;
+#endif
+  return false;
+}
+
+bool interrupted_registers(void *context, uintptr_t &pc, uintptr_t &fp, uintptr_t &sp)
+{
+  auto *uc = static_cast<ucontext_t *>(context);
+#if defined(__x86_64__)
+  pc = static_cast<uintptr_t>(uc->uc_mcontext.gregs[REG_RIP]);
+  fp = static_cast<uintptr_t>(uc->uc_mcontext.gregs[REG_RBP]);
+  sp = static_cast<uintptr_t>(uc->uc_mcontext.gregs[REG_RSP]);
+  return true;
+#elif defined(__aarch64__)
+  pc = uc->uc_mcontext.pc;
+  fp = uc->uc_mcontext.regs[29];
+  sp = uc->uc_mcontext.sp;
+  return true;
+#else
+  (void)uc;
+  return false;
+#endif
+}
+
+// Frame pointers are only followed while they stay on the main thread's
+// stack, above the interrupted stack pointer and strictly upwards
+int capture(uintptr_t *frames, void *context)
+{
+  uintptr_t pc, fp, sp;
+  if (!interrupted_registers(context, pc, fp, sp))
+    return 0;
+
+  int depth = 0;
+  frames[depth++] = pc;
+
+  auto top = reinterpret_cast<uintptr_t>(__libc_stack_end);
+  if (sp >= top || top - sp > kMaxStackWalk)
+    return depth;  // not the main thread
+
+  // Frameless leaf (or a function entry): the return address is on top of the stack
+  uintptr_t leaf_return = *reinterpret_cast<uintptr_t *>(sp);
+  bool frameless = follows_call(leaf_return);
+  if (frameless)
+    frames[depth++] = leaf_return;
+
+  while (depth < kMaxFrames)
+  {
+    if (fp < sp || fp + 2 * sizeof(uintptr_t) > top || (fp & 7))
+      break;
+    auto *frame = reinterpret_cast<uintptr_t *>(fp);
+    uintptr_t ret = frame[1];
+    if (ret < 4096)
+      break;
+    if (!(frameless && depth == 2 && ret == leaf_return))
+      frames[depth++] = ret;
+    if (frame[0] <= fp)
+      break;
+    fp = frame[0];
+  }
+  return depth;
+}
+
+void on_sample(int, siginfo_t *, void *context)
+{
+  if (!g_active.load(std::memory_order_relaxed))
+    return;
+  int saved_errno = errno;
+
+  uintptr_t frames[kMaxFrames];
+  int depth = capture(frames, context);
+  if (depth == 0)
+  {
+    errno = saved_errno;
+    return;
+  }
+  g_samples.fetch_add(1, std::memory_order_relaxed);
+
+  uint64_t hash = 1469598103934665603ULL;
+  for (int i = 0; i < depth; ++i)
+    hash = (hash ^ frames[i]) * 1099511628211ULL;
+  hash |= 1;
+
+  for (int probe = 0; probe < 64; ++probe)
+  {
+    Stack &stack = g_stacks[(hash + probe) & (kStackSlots - 1)];
+    uint64_t current = stack.hash.load(std::memory_order_acquire);
+    if (current == 0)
+    {
+      uint64_t expected = 0;
+      if (stack.hash.compare_exchange_strong(expected, hash))
+      {
+        memcpy(stack.frames, frames, depth * sizeof(uintptr_t));
+        stack.depth = depth;
+        current = hash;
+      }
+      else
+        current = expected;
+    }
+    if (current == hash)
+    {
+      stack.count.fetch_add(1, std::memory_order_relaxed);
+      errno = saved_errno;
+      return;
+    }
+  }
+  g_dropped.fetch_add(1, std::memory_order_relaxed);
+  errno = saved_errno;
+}
+
+// Minimal buffered writer; the report must not allocate
+struct Writer
+{
+  int fd = -1;
+  char buf[4096];
+  size_t len = 0;
+
+  void flush()
+  {
+    size_t off = 0;
+    while (off < len)
+    {
+      ssize_t n = write(fd, buf + off, len - off);
+      if (n <= 0 && errno != EINTR)
+        break;
+      if (n > 0)
+        off += static_cast<size_t>(n);
+    }
+    len = 0;
+  }
+
+  void printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)))
+  {
+    char tmp[1024];
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(tmp, sizeof(tmp), fmt, args);
+    va_end(args);
+    if (n <= 0)
+      return;
+    size_t size = static_cast<size_t>(n) < sizeof(tmp) ? static_cast<size_t>(n) : sizeof(tmp) - 1;
+    if (len + size > sizeof(buf))
+      flush();
+    memcpy(buf + len, tmp, size);
+    len += size;
+  }
+
+  // JSON string without the characters that would need escaping
+  void string(const char *s)
+  {
+    char clean[512];
+    size_t i = 0;
+    for (; s && *s && i + 1 < sizeof(clean); ++s)
+      if (*s != '"' && *s != '\\' && static_cast<unsigned char>(*s) >= 0x20)
+        clean[i++] = *s;
+    clean[i] = '\0';
+    printf("\"%s\"", clean);
+  }
+};
+
+struct Module
+{
+  uintptr_t base;
+  char name[512];
+};
+
+Module g_modules[kMaxModules];
+int g_module_count = 0;
+
+// Index of the module containing the address (-1 if none)
+int find_module(uintptr_t address, Dl_info &info)
+{
+  if (!dladdr(reinterpret_cast<void *>(address), &info) || !info.dli_fname)
+    return -1;
+  auto base = reinterpret_cast<uintptr_t>(info.dli_fbase);
+  for (int i = 0; i < g_module_count; ++i)
+    if (g_modules[i].base == base)
+      return i;
+  if (g_module_count == kMaxModules)
+    return -1;
+
+  // The main program is reported by the name it was started with
+  Module &module = g_modules[g_module_count];
+  module.base = base;
+  const char *name = info.dli_fname;
+  ssize_t n = 0;
+  if (name[0] != '/' && (n = readlink("/proc/self/exe", module.name, sizeof(module.name) - 1)) > 0)
+    module.name[n] = '\0';
+  else
+  {
+    strncpy(module.name, name, sizeof(module.name) - 1);
+    module.name[sizeof(module.name) - 1] = '\0';
+  }
+  return g_module_count++;
+}
+
+void write_frame(Writer &out, uintptr_t address, bool is_pc)
+{
+  // Return addresses point after the call; step back into it
+  if (!is_pc)
+    address -= 1;
+  Dl_info info;
+  int module = find_module(address, info);
+  uintptr_t offset = module < 0 ? address : address - g_modules[module].base;
+  out.printf("[%d, %lu, %lu, ", module, static_cast<unsigned long>(offset), static_cast<unsigned long>(address));
+  out.string(module >= 0 && info.dli_sname ? info.dli_sname : "");
+  out.printf("]");
+}
+
+void write_report()
+{
+  const char *path = getenv("CTS_PROF_REPORT");
+  if (!path || !*path || g_reported.exchange(true))
+    return;
+  int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (fd < 0)
+    return;
+
+  Writer out;
+  out.fd = fd;
+  out.printf("{\"schema\": 1, \"hz\": %d, \"samples\": %lu, \"dropped\": %lu, \"stacks\": [", g_hz,
+             static_cast<unsigned long>(g_samples.load()), static_cast<unsigned long>(g_dropped.load()));
+
+  // Most frequent stacks first (selection over the table, no allocation)
+  static bool taken[kStackSlots];
+  for (int rank = 0; rank < kTopStacks; ++rank)
+  {
+    int best = -1;
+    for (int i = 0; i < kStackSlots; ++i)
+      if (!taken[i] && g_stacks[i].hash.load() && g_stacks[i].depth &&
+          (best < 0 || g_stacks[i].count.load() > g_stacks[best].count.load()))
+        best = i;
+    if (best < 0)
+      break;
+    taken[best] = true;
+    Stack &stack = g_stacks[best];
+    out.printf("%s{\"count\": %lu, \"frames\": [", rank ? ", " : "", static_cast<unsigned long>(stack.count.load()));
+    for (int f = 0; f < stack.depth; ++f)
+    {
+      if (f)
+        out.printf(", ");
+      write_frame(out, stack.frames[f], f == 0);
+    }
+    out.printf("]}");
+  }
+
+  out.printf("], \"modules\": [");
+  for (int i = 0; i < g_module_count; ++i)
+  {
+    if (i)
+      out.printf(", ");
+    out.string(g_modules[i].name);
+  }
+  out.printf("]}\n");
+  out.flush();
+  close(fd);
+}
+
+void stop_sampling()
+{
+  itimerval off = {};
+  setitimer(ITIMER_PROF, &off, nullptr);
+  g_active.store(false);
+}
+
+// Runs stopped with SIGTERM (time budget exceeded) still get a report;
+// dladdr()/vsnprintf() are not async-signal-safe, but the process is
+// about to exit and only this path touches them
+void on_terminate(int sig)
+{
+  stop_sampling();
+  write_report();
+  _exit(128 + sig);
+}
+
+__attribute__((constructor)) void profiler_start()
+{
+  if (!getenv("CTS_PROF_REPORT"))
+    return;
+  if (const char *hz = getenv("CTS_PROF_HZ"))
+  {
+    int value = atoi(hz);
+    g_hz = value < 10 ? 10 : value > 10000 ? 10000 : value;
+  }
+
+  dl_iterate_phdr(collect_code_range, nullptr);
+
+  struct sigaction action = {};
+  action.sa_sigaction = on_sample;
+  action.sa_flags = SA_SIGINFO | SA_RESTART;
+  sigemptyset(&action.sa_mask);
+  if (sigaction(SIGPROF, &action, nullptr) != 0)
+    return;
+
+  struct sigaction terminate = {};
+  terminate.sa_handler = on_terminate;
+  sigemptyset(&terminate.sa_mask);
+  sigaction(SIGTERM, &terminate, nullptr);
+
+  g_active.store(true);
+  itimerval timer = {};
+  timer.it_interval.tv_usec = 1000000 / g_hz;
+  timer.it_value = timer.it_interval;
+  setitimer(ITIMER_PROF, &timer, nullptr);
+}
+
+__attribute__((destructor)) void profiler_stop()
+{
+  if (!g_active.load())
+    return;
+  stop_sampling();
+  write_report();
+}
+
+} // namespace
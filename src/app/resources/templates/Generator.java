@@ -2,7 +2,10 @@ import java.util.*;
 
 public class Generator {
     public static void main(String[] args) {
-        Random random = new Random();
+        // Seed random number generator (CTS_SEED makes the test reproducible;
+        // a persistent JVM passes it as the cts.seed property instead)
+        String seed = System.getProperty("cts.seed", System.getenv("CTS_SEED"));
+        Random random = seed != null ? new Random(Long.parseUnsignedLong(seed)) : new Random();
         
         // Generate random test case
         // Example: generate random array
@@ -4,6 +4,10 @@
 using namespace std;
 
 int main() {
+    // Fast I/O: untie cin from cout and stop syncing with C stdio
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+
     // Read input
     int n;
     cin >> n;
@@ -20,7 +24,7 @@ int main() {
         cout << arr[i];
         if (i < n - 1) cout << " ";
     }
-    cout << endl;
+    cout << '\n';  // endl would flush on every call
     
     return 0;
 }
\ No newline at end of file
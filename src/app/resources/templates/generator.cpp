@@ -1,22 +1,25 @@
 #include <iostream>
 #include <random>
 #include <chrono>
+#include <cstdlib>
 using namespace std;
 
 int main() {
-    // Seed random number generator
-    mt19937 rng(chrono::steady_clock::now().time_since_epoch().count());
+    // Seed random number generator (CTS_SEED makes the test reproducible)
+    const char* seed = getenv("CTS_SEED");
+    mt19937 rng(seed ? strtoull(seed, nullptr, 10)
+                     : chrono::steady_clock::now().time_since_epoch().count());
     
     // Generate random test case
     // Example: generate random array
     int n = uniform_int_distribution<int>(1, 10)(rng);
     
-    cout << n << endl;
+    cout << n << '\n';
     for (int i = 0; i < n; i++) {
         cout << uniform_int_distribution<int>(1, 100)(rng);
         if (i < n - 1) cout << " ";
     }
-    cout << endl;
+    cout << '\n';
     
     return 0;
 }
\ No newline at end of file
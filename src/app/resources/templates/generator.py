@@ -1,7 +1,11 @@
+import os
 import random
 
 
 def main():
+    # Seed random number generator (CTS_SEED makes the test reproducible)
+    random.seed(os.environ.get("CTS_SEED"))
+
     # Generate random test case
     # Example: generate random array
     n = random.randint(1, 10)
@@ -27,7 +27,6 @@ from .constants import (
     get_help_content_path,
     get_icon_path,
 )
-from .utils import FileOperations
 
 __all__ = [
     # Path constants
@@ -54,3 +53,12 @@ __all__ = [
     # Utils
     "FileOperations",
 ]
+
+
+def __getattr__(name: str):
+    """Lazy import of FileOperations, which loads Qt widgets."""
+    if name == "FileOperations":
+        from .utils import FileOperations
+
+        return FileOperations
+    raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
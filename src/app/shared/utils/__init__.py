@@ -5,6 +5,13 @@ This package contains utility functions and classes for file operations,
 logging configuration, and other common functionality.
 """
 
-from .file_operations import FileOperations
-
 __all__ = ["FileOperations"]
+
+
+def __getattr__(name: str):
+    """Lazy import of FileOperations, which loads Qt widgets."""
+    if name == "FileOperations":
+        from .file_operations import FileOperations
+
+        return FileOperations
+    raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
@@ -0,0 +1,173 @@
+"""
+Tests for the headless CLI (src/app/cli.py)
+
+Argument, config and source handling, and a comparator run in a
+subprocess, which must not import PySide6.
+"""
+
+import json
+import os
+import subprocess
+import sys
+from pathlib import Path
+
+import pytest
+
+from src.app import cli
+
+PROJECT_ROOT = Path(__file__).parent.parent.parent.parent
+
+GENERATOR = "import os\nprint(int(os.environ['CTS_SEED']) % 1000)\n"
+CORRECT = "print(int(input()) * 2)\n"
+# Wrong on multiples of 7
+TEST = "n = int(input())\nprint(n if n % 7 == 0 else n * 2)\n"
+
+
+@pytest.fixture
+def workspace(tmp_path):
+    """Workspace with Python comparator sources and an empty config."""
+    comparator_dir = tmp_path / "comparator"
+    comparator_dir.mkdir()
+    for role, source in (("generator", GENERATOR), ("correct", CORRECT), ("test", TEST)):
+        (comparator_dir / f"{role}.py").write_text(source)
+    (tmp_path / "config.json").write_text("{}")
+    return tmp_path
+
+
+class TestConfig:
+    """Test loading the config and --set overrides."""
+
+    def test_overrides_create_nested_keys_and_parse_json(self, tmp_path):
+        path = tmp_path / "config.json"
+        path.write_text(json.dumps({"comparator": {"tiered": False}}))
+
+        config = cli.load_config(str(path), ["comparator.tiered=true", "a.b.c=3", "name=plain text"])
+
+        assert config == {"comparator": {"tiered": True}, "a": {"b": {"c": 3}}, "name": "plain text"}
+
+    def test_override_without_value_is_rejected(self, tmp_path):
+        path = tmp_path / "config.json"
+        path.write_text("{}")
+
+        with pytest.raises(ValueError):
+            cli.load_config(str(path), ["comparator.tiered"])
+
+
+class TestSources:
+    """Test finding the source files of a tool."""
+
+    def test_sources_found_in_the_tool_directory(self, workspace):
+        files = cli.find_sources(str(workspace), "comparator", [])
+
+        assert files == {role: str(workspace / "comparator" / f"{role}.py") for role in cli.TOOLS["comparator"]}
+
+    def test_file_argument_overrides_a_role(self, workspace, tmp_path):
+        other = tmp_path / "other.py"
+        other.write_text(CORRECT)
+
+        files = cli.find_sources(str(workspace), "comparator", [f"test={other}"])
+
+        assert files["test"] == str(other)
+
+    def test_missing_role_is_reported(self, workspace):
+        with pytest.raises(ValueError, match="validator"):
+            cli.find_sources(str(workspace), "validator", [])
+
+    def test_unknown_role_is_rejected(self, workspace):
+        with pytest.raises(ValueError):
+            cli.find_sources(str(workspace), "benchmarker", ["correct=x.py"])
+
+
+class TestRecords:
+    """Test the per-test output records."""
+
+    def test_full_copies_left_out_by_default(self):
+        result = {"test_number": 1, "passed": True, "input": "1", "input_full": "1\n"}
+
+        assert cli.test_record(result, full=False) == {"type": "test", "test_number": 1, "passed": True, "input": "1"}
+        assert cli.test_record(result, full=True)["input_full"] == "1\n"
+
+
+class TestRun:
+    """Test complete runs in a subprocess."""
+
+    def run_cli(self, *args):
+        env = {key: value for key, value in os.environ.items() if key != "PYTHONPATH"}
+        return subprocess.run(
+            [sys.executable, "-m", "src.app.cli", *args],
+            cwd=PROJECT_ROOT,
+            env=env,
+            capture_output=True,
+            text=True,
+            timeout=120,
+        )
+
+    def test_comparator_run_writes_ndjson(self, workspace):
+        process = self.run_cli(
+            "comparator", "--workspace", str(workspace), "--config", str(workspace / "config.json"),
+            "--tests", "12", "--seed", "7",
+        )
+
+        records = [json.loads(line) for line in process.stdout.splitlines()]
+        tests = [record for record in records if record["type"] == "test"]
+        summary = records[-1]
+        assert summary["type"] == "summary"
+        assert sorted(record["test_number"] for record in tests) == list(range(1, 13))
+        assert summary["run_seed"] == 7
+        assert summary["passed_tests"] + summary["failed_tests"] == 12
+        assert process.returncode == (1 if summary["failed_tests"] else 0)
+
+    def test_missing_sources_exit_with_error(self, tmp_path):
+        process = self.run_cli("validator", "--workspace", str(tmp_path), "--config", os.devnull)
+
+        assert process.returncode == cli.EXIT_ERROR
+        assert process.stdout == ""
+
+    def test_headless_import_does_not_load_qt(self):
+        code = (
+            "import os, sys; os.environ['CTS_HEADLESS'] = '1'\n"
+            "from src.app.core.tools.benchmarker import Benchmarker\n"
+            "from src.app.core.tools.comparator import Comparator\n"
+            "from src.app.core.tools.validator import ValidatorRunner\n"
+            "sys.exit(any(name.startswith('PySide6') for name in sys.modules))\n"
+        )
+
+        process = subprocess.run([sys.executable, "-c", code], cwd=PROJECT_ROOT, capture_output=True, timeout=60)
+
+        assert process.returncode == 0, process.stderr
+
+    def test_resume_runs_only_the_tests_after_the_checkpoint(self, workspace):
+        config = str(workspace / "config.json")
+        self.run_cli(
+            "comparator", "--workspace", str(workspace), "--config", config,
+            "--tests", "10", "--seed", "3", "--checkpoint", "0",
+        )
+        journal = workspace / "comparator" / "checkpoints" / f"run-{3:016x}.jsonl"
+        # Keep the header and the first 4 checkpoints, as if the run died there
+        lines = journal.read_text().splitlines(keepends=True)
+        journal.write_text("".join(lines[:5]))
+
+        process = self.run_cli("resume", str(journal), "--config", config)
+
+        records = [json.loads(line) for line in process.stdout.splitlines()]
+        summary = records[-1]
+        assert len(records) - 1 == 6
+        assert summary["resumed_from"] == 4
+        assert summary["passed_tests"] + summary["failed_tests"] == 10
+        assert summary["analysis"]["checkpoint"]["complete"]
+        assert self.run_cli("resume", str(journal), "--config", config).returncode == cli.EXIT_ERROR
+
+    def test_resume_refuses_changed_binaries(self, workspace):
+        config = str(workspace / "config.json")
+        self.run_cli(
+            "comparator", "--workspace", str(workspace), "--config", config,
+            "--tests", "2", "--seed", "3", "--checkpoint", "0",
+        )
+        journal = workspace / "comparator" / "checkpoints" / f"run-{3:016x}.jsonl"
+        journal.write_text(journal.read_text().splitlines(keepends=True)[0])
+        (workspace / "comparator" / "test.py").write_text(CORRECT)
+
+        process = self.run_cli("resume", str(journal), "--config", config)
+
+        assert process.returncode == cli.EXIT_ERROR
+        assert "test changed" in process.stderr
@@ -768,3 +768,137 @@ class TestBaseCompilerLanguageConfigRetrieval:
         config = compiler._get_language_config(Language.CPP)
         assert "compiler" in config
         assert config["compiler"] == "clang++"
+
+
+class TestBaseCompilerBuildVariants:
+    """Test additional builds of the same source (e.g. sanitizer builds)."""
+
+    def _make_compiler(self, temp_workspace, filename="test.cpp"):
+        source = temp_workspace / "comparator" / filename
+        source.parent.mkdir(parents=True, exist_ok=True)
+        source.write_text("int main() { return 0; }")
+        return BaseCompiler(
+            str(temp_workspace), {"test": str(source)}, test_type="comparator"
+        )
+
+    def test_add_source_registers_extra_file(self, temp_workspace):
+        """Extra sources get their own language and executable."""
+        compiler = self._make_compiler(temp_workspace)
+        extra = temp_workspace / "comparator" / "fast.py"
+        extra.write_text("print(1)")
+
+        path = compiler.add_source("solution_1", "fast.py")
+
+        assert path == str(extra)
+        assert compiler.files["solution_1"] == str(extra)
+        assert compiler.file_languages["solution_1"] == Language.PYTHON
+        assert compiler.executables["solution_1"] == str(extra)
+
+    def test_add_build_variant_registers_separate_executable(self, temp_workspace):
+        """Variant should share the source but get its own executable."""
+        compiler = self._make_compiler(temp_workspace)
+
+        key = compiler.add_build_variant("test", "o0", {"optimization": "O0"})
+
+        assert key == "test:o0"
+        assert compiler.files[key] == compiler.files["test"]
+        assert compiler.file_languages[key] == Language.CPP
+        root, ext = os.path.splitext(compiler.executables["test"])
+        assert compiler.executables[key] == f"{root}_o0{ext}"
+
+    def test_add_build_variant_skips_interpreted_languages(self, temp_workspace):
+        """Python sources have no native build variants."""
+        compiler = self._make_compiler(temp_workspace, "test.py")
+
+        assert compiler.add_build_variant("test", "o0", {"optimization": "O0"}) is None
+        assert list(compiler.files) == ["test"]
+
+    def test_add_build_variant_unknown_key_raises(self, temp_workspace):
+        """Unknown file keys should be rejected."""
+        compiler = self._make_compiler(temp_workspace)
+
+        with pytest.raises(KeyError):
+            compiler.add_build_variant("missing", "o0", {})
+
+    def test_variant_config_overlays_language_config(self, temp_workspace):
+        """Variant overrides apply only to the variant's config."""
+        compiler = self._make_compiler(temp_workspace)
+        key = compiler.add_sanitizer_build("test")
+
+        variant_config = compiler._get_language_config(Language.CPP, key)
+        regular_config = compiler._get_language_config(Language.CPP)
+
+        assert variant_config["extra_flags"] == compiler.get_sanitizer_flags()
+        assert "extra_flags" not in regular_config
+
+    def test_stress_build_adds_link_flags(self, temp_workspace):
+        """Stress builds link statically, sanitizer builds stay dynamic."""
+        compiler = self._make_compiler(temp_workspace)
+        compiler.config = {"languages": {"cpp": {"stress_build": True}}}
+        key = compiler.add_sanitizer_build("test")
+
+        with patch("src.app.core.tools.base.base_compiler.sys.platform", "linux"):
+            regular_config = compiler._get_language_config(Language.CPP, "test")
+            sanitizer_config = compiler._get_language_config(Language.CPP, key)
+
+        assert regular_config["link_flags"] == compiler.get_stress_build_flags()
+        assert "-static" in regular_config["link_flags"]
+        assert "link_flags" not in sanitizer_config
+
+    def test_toggling_stress_build_triggers_rebuild(self, temp_workspace):
+        """An executable whose linkage does not match the setting is rebuilt."""
+        compiler = self._make_compiler(temp_workspace)
+        executable = compiler.executables["test"]
+        with open(executable, "w") as f:
+            f.write("")
+
+        with patch("src.app.core.tools.base.base_compiler.sys.platform", "linux"), patch(
+            "src.app.core.tools.base.base_compiler.is_dynamic_executable", return_value=True
+        ):
+            assert compiler._needs_recompilation("test") is False
+            compiler.config = {"languages": {"cpp": {"stress_build": True}}}
+            assert compiler._needs_recompilation("test") is True
+
+    def test_file_overrides_apply_below_variant_overrides(self, temp_workspace):
+        """Overrides saved for a source apply to all its builds."""
+        compiler = self._make_compiler(temp_workspace)
+        source = compiler.files["test"]
+        compiler.config = {
+            "languages": {"cpp": {"file_overrides": {source: {"optimization": "O3", "std_version": "c++20"}}}}
+        }
+        key = compiler.add_build_variant("test", "o0", {"optimization": "O0"})
+
+        assert compiler._get_language_config(Language.CPP, "test")["optimization"] == "O3"
+        variant_config = compiler._get_language_config(Language.CPP, key)
+        assert variant_config["optimization"] == "O0"
+        assert variant_config["std_version"] == "c++20"
+        assert "std_version" not in compiler._get_language_config(Language.CPP)
+
+    def test_sanitizer_flags_do_not_define_debug(self, temp_workspace):
+        """Sanitized binaries must print the same output as release builds."""
+        compiler = self._make_compiler(temp_workspace)
+
+        flags = compiler.get_sanitizer_flags()
+
+        assert "-fsanitize=address" in flags
+        assert "-fsanitize=undefined" in flags
+        assert "-DDEBUG" not in flags
+
+    def test_variant_compiled_with_own_compiler(self, temp_workspace):
+        """Variant compilation must not reuse the cached regular compiler."""
+        compiler = self._make_compiler(temp_workspace)
+        key = compiler.add_sanitizer_build("test")
+
+        with patch(
+            "src.app.core.tools.base.base_compiler.LanguageCompilerFactory.create_compiler"
+        ) as mock_create:
+            mock_create.return_value.compile.return_value = (True, "Compiled test.cpp")
+            success, message = compiler._compile_single_file(key)
+
+        assert success is True
+        assert message == "Compiled test.cpp (sanitized build)"
+        assert mock_create.call_args[0][1]["extra_flags"] == compiler.get_sanitizer_flags()
+        assert mock_create.return_value.compile.call_args[1]["output_file"] == (
+            compiler.executables[key]
+        )
+        assert Language.CPP not in compiler.language_compilers
@@ -14,6 +14,7 @@ import pytest
 from PySide6.QtCore import QThread, Signal
 
 from src.app.core.tools.base.base_runner import BaseRunner
+from src.app.core.tools.base.output_capture import DEFAULT_OUTPUT_LIMIT_MB
 from src.app.database.models import TestResult
 
 
@@ -411,3 +412,172 @@ class TestBaseRunnerErrorHandling:
         # Should handle exception during run_tests
         with pytest.raises(RuntimeError):
             runner.run_tests(test_count=5)
+
+
+class TestBaseRunnerWarmInterpreters:
+    """Test selection of Python and Java roles for warm interpreters."""
+
+    def _make_runner(self, temp_workspace, warm_pool, warm_jvm=False):
+        sources = {}
+        for key, name, content in (
+            ("test", "test.py", "print(1)\n"),
+            ("correct", "Correct.java", "public class Correct {}\n"),
+        ):
+            source = temp_workspace / "comparator" / name
+            source.parent.mkdir(parents=True, exist_ok=True)
+            source.write_text(content)
+            sources[key] = str(source)
+        runner = ConcreteRunner(str(temp_workspace), sources)
+        runner.config = {
+            "languages": {"py": {"warm_pool": warm_pool}, "java": {"warm_jvm": warm_jvm}}
+        }
+        return runner
+
+    def test_disabled_by_default(self, temp_workspace):
+        """No warm roles unless languages.py.warm_pool is set."""
+        runner = self._make_runner(temp_workspace, warm_pool=False)
+
+        assert runner._get_warm_interpreter_roles() == {}
+
+    def test_python_roles_when_enabled(self, temp_workspace):
+        """Python file keys should be served warm when enabled."""
+        runner = self._make_runner(temp_workspace, warm_pool=True)
+
+        with patch(
+            "src.app.core.tools.base.base_runner.warm_pool_supported", return_value=True
+        ):
+            assert runner._get_warm_interpreter_roles() == {"test": "py"}
+
+    def test_java_roles_when_enabled(self, temp_workspace):
+        """Java file keys should run in persistent JVMs when enabled."""
+        runner = self._make_runner(temp_workspace, warm_pool=False, warm_jvm=True)
+
+        with patch(
+            "src.app.core.tools.base.base_runner.warm_jvm_supported", return_value=True
+        ):
+            assert runner._get_warm_interpreter_roles() == {"correct": "java"}
+
+    def test_unsupported_platform(self, temp_workspace):
+        """No warm roles where fork() is unavailable."""
+        runner = self._make_runner(temp_workspace, warm_pool=True)
+
+        with patch(
+            "src.app.core.tools.base.base_runner.warm_pool_supported", return_value=False
+        ):
+            assert runner._get_warm_interpreter_roles() == {}
+
+
+class TestBaseRunnerStackLimits:
+    """Test stack limits of native roles."""
+
+    def _make_runner(self, temp_workspace, cpp_config=None):
+        sources = {}
+        for key, name, content in (
+            ("test", "test.cpp", "int main() {}\n"),
+            ("correct", "correct.py", "print(1)\n"),
+        ):
+            source = temp_workspace / "comparator" / name
+            source.parent.mkdir(parents=True, exist_ok=True)
+            source.write_text(content)
+            sources[key] = str(source)
+        runner = ConcreteRunner(str(temp_workspace), sources)
+        runner.config = {"languages": {"cpp": cpp_config or {}}}
+        return runner
+
+    def test_cpp_roles_get_default_limit(self, temp_workspace):
+        """C++ roles run with a judge-like stack limit by default."""
+        runner = self._make_runner(temp_workspace)
+
+        with patch(
+            "src.app.core.tools.base.base_runner.stack_limit_supported", return_value=True
+        ):
+            assert runner._get_stack_limits() == {"test": 256}
+
+    def test_configured_limit(self, temp_workspace):
+        """languages.cpp.stack_limit_mb overrides the default (0 = unlimited)."""
+        runner = self._make_runner(temp_workspace, {"stack_limit_mb": 0})
+
+        with patch(
+            "src.app.core.tools.base.base_runner.stack_limit_supported", return_value=True
+        ):
+            assert runner._get_stack_limits() == {"test": 0}
+
+    def test_unsupported_platform(self, temp_workspace):
+        """No limits where RLIMIT_STACK is unavailable."""
+        runner = self._make_runner(temp_workspace)
+
+        with patch(
+            "src.app.core.tools.base.base_runner.stack_limit_supported", return_value=False
+        ):
+            assert runner._get_stack_limits() == {}
+
+
+class TestBaseRunnerStartupOverhead:
+    """Test the startup overhead report of native binaries."""
+
+    def test_native_solutions_are_probed(self, temp_workspace):
+        """Only C++ solutions get a probe; a generator's empty-input run is a full generation."""
+        sources = {}
+        for key, name in (("generator", "generator.cpp"), ("test", "test.cpp"), ("correct", "correct.py")):
+            source = temp_workspace / "comparator" / name
+            source.parent.mkdir(parents=True, exist_ok=True)
+            source.write_text("int main() {}\n")
+            sources[key] = str(source)
+        runner = ConcreteRunner(str(temp_workspace), sources)
+
+        assert runner._get_startup_probe_commands() == {
+            "test": runner.compiler.get_execution_command("test")
+        }
+
+    def test_reports_the_worker_probes(self, temp_workspace):
+        """Probes of the worker are compared with the per-test time of their role."""
+        runner = TestBaseRunnerStackLimits()._make_runner(temp_workspace, {"stress_build": True})
+        runner.worker = Mock(
+            startup_probes={
+                "test": {"min_seconds": 0.001, "median_seconds": 0.002, "runs": 5, "exit_code": 0}
+            }
+        )
+
+        with patch(
+            "src.app.core.tools.base.base_runner.is_dynamic_executable", return_value=False
+        ):
+            overhead = runner._measure_startup_overhead({"test": 0.004, "correct": 0.03})
+
+        assert overhead == {
+            "test": {
+                "dynamic": False,
+                "stress_build": True,
+                "min_seconds": 0.001,
+                "median_seconds": 0.002,
+                "share_of_test_time": 0.25,
+            }
+        }
+
+    def test_binary_not_exiting_on_empty_input(self, temp_workspace):
+        runner = TestBaseRunnerStackLimits()._make_runner(temp_workspace)
+        runner.worker = Mock(startup_probes={"test": None})
+
+        overhead = runner._measure_startup_overhead({"test": 0.004})
+
+        assert overhead["test"]["timed_out"] is True
+        assert "min_seconds" not in overhead["test"]
+
+    def test_no_report_without_probes(self, temp_workspace):
+        """Workers that did not probe (e.g. distributed runs) give no report."""
+        runner = TestBaseRunnerStackLimits()._make_runner(temp_workspace)
+        runner.worker = Mock(startup_probes={})
+
+        assert runner._measure_startup_overhead({"test": 0.004}) == {}
+
+
+class TestBaseRunnerOutputLimit:
+    """Test the output limit handed to workers."""
+
+    def test_default_and_configured_limit(self, temp_workspace):
+        """output_limit_mb overrides the default (0 = unlimited)."""
+        runner = ConcreteRunner(str(temp_workspace), {})
+
+        runner.config = {}
+        assert runner._get_output_limit() == DEFAULT_OUTPUT_LIMIT_MB
+        runner.config = {"output_limit_mb": 0}
+        assert runner._get_output_limit() == 0
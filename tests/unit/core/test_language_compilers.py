@@ -670,6 +670,20 @@ class TestCppCompilerAdvanced:
     def compiler(self):
         return CppCompiler()
 
+    @patch("subprocess.run")
+    def test_link_flags_follow_source(self, mock_run, tmp_path):
+        """Linker flags (stress builds) should come after the source file."""
+        mock_run.return_value = CompletedProcess(
+            args=["g++"], returncode=0, stdout="", stderr=""
+        )
+        compiler = CppCompiler({"link_flags": ["-static", "-no-pie"]})
+        source_file = str(tmp_path / "test.cpp")
+
+        compiler.compile(source_file)
+
+        cmd = mock_run.call_args.args[0]
+        assert cmd[cmd.index(source_file) + 1:cmd.index(source_file) + 3] == ["-static", "-no-pie"]
+
     @patch("subprocess.run")
     def test_compile_with_spaces_in_path(self, mock_run, compiler, tmp_path):
         """Should handle spaces in file paths."""
@@ -1118,3 +1132,103 @@ class TestCompilerLogging:
         mock_logger.debug.assert_called()
         call_args = str(mock_logger.debug.call_args)
         assert "javac" in call_args
+
+
+class TestPythonCompilerPyPyBackend:
+    """Test PyPy backend selection and fallback."""
+
+    @pytest.mark.parametrize(
+        "interpreter,backend",
+        [("python", "cpython"), ("python3", "cpython"), ("pypy3", "pypy"), ("/opt/pypy/bin/pypy", "pypy")],
+    )
+    def test_get_backend(self, interpreter, backend):
+        """Should classify interpreters by backend."""
+        assert PythonCompiler({"interpreter": interpreter}).get_backend() == backend
+
+    def test_pypy_used_when_installed(self):
+        """Should run solutions with PyPy when it is on PATH."""
+        compiler = PythonCompiler({"interpreter": "pypy3"})
+
+        with patch("shutil.which", return_value="/usr/bin/pypy3"):
+            assert compiler.get_executable_command("sol.py") == ["pypy3", "-u", "sol.py"]
+
+    def test_missing_pypy_falls_back(self):
+        """Should fall back to CPython when PyPy is not installed."""
+        compiler = PythonCompiler({"interpreter": "pypy3", "fallback_interpreter": "python3"})
+
+        with patch("shutil.which", return_value=None):
+            assert compiler.get_compiler_executable() == "python3"
+
+
+class TestJavaCompilerClassDataSharing:
+    """Test AppCDS archive creation and use."""
+
+    @pytest.fixture(autouse=True)
+    def clear_version_cache(self):
+        JavaCompiler._runtime_versions.clear()
+        yield
+        JavaCompiler._runtime_versions.clear()
+
+    @pytest.mark.parametrize(
+        "banner,version",
+        [('openjdk version "17.0.2" 2022-01-18', 17), ('java version "1.8.0_292"', 8), ("garbage", None)],
+    )
+    @patch("subprocess.run")
+    def test_runtime_version(self, mock_run, banner, version):
+        """Should parse modern and legacy version banners."""
+        mock_run.return_value = CompletedProcess([], 0, stdout="", stderr=banner)
+
+        assert JavaCompiler({"runtime": "java"}).get_runtime_version() == version
+
+    @patch("subprocess.run")
+    def test_compile_dumps_archive(self, mock_run, tmp_path):
+        """Should run the class once with ArchiveClassesAtExit after compiling."""
+        class_file = tmp_path / "Test.class"
+        calls = []
+
+        def fake_run(cmd, **kwargs):
+            calls.append(cmd)
+            if cmd[1] == "-version":
+                return CompletedProcess(cmd, 0, stdout="", stderr='openjdk version "17.0.2"')
+            if any(arg.startswith("-XX:ArchiveClassesAtExit=") for arg in cmd):
+                (tmp_path / "Test.jsa").write_bytes(b"archive")
+            else:
+                class_file.write_bytes(b"class")
+            return CompletedProcess(cmd, 0, stdout="", stderr="")
+
+        mock_run.side_effect = fake_run
+        compiler = JavaCompiler({"cds": True})
+
+        success, _ = compiler.compile(str(tmp_path / "Test.java"), str(class_file))
+
+        assert success
+        assert f"-XX:ArchiveClassesAtExit={tmp_path / 'Test.jsa'}" in calls[-1]
+        command = compiler.get_executable_command(str(class_file))
+        assert command[1] == f"-XX:SharedArchiveFile={tmp_path / 'Test.jsa'}"
+        assert command[-3:] == ["-cp", str(tmp_path), "Test"]
+
+    @patch("subprocess.run")
+    def test_old_runtime_skips_archive(self, mock_run, tmp_path):
+        """Should not attempt a dump on runtimes before JDK 13."""
+        mock_run.return_value = CompletedProcess([], 0, stdout="", stderr='openjdk version "11.0.2"')
+        compiler = JavaCompiler({"cds": True})
+
+        compiler.compile(str(tmp_path / "Test.java"), str(tmp_path / "Test.class"))
+
+        assert not any(
+            arg.startswith("-XX:ArchiveClassesAtExit=")
+            for call in mock_run.call_args_list
+            for arg in call.args[0]
+        )
+
+    def test_stale_archive_ignored(self, tmp_path):
+        """Should not use an archive older than the class file."""
+        archive = tmp_path / "Test.jsa"
+        class_file = tmp_path / "Test.class"
+        archive.write_bytes(b"archive")
+        class_file.write_bytes(b"class")
+        os.utime(archive, (1, 1))
+
+        command = JavaCompiler({"cds": True}).get_executable_command(str(class_file))
+
+        assert command == ["java", "-cp", str(tmp_path), "Test"]
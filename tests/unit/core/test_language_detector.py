@@ -4,6 +4,7 @@ Test suite for LanguageDetector.
 Tests language detection from file extensions and content analysis.
 """
 
+import os
 from pathlib import Path
 
 import pytest
@@ -710,3 +711,49 @@ class TestContentDetectionScoring:
 
         # Should return something or UNKNOWN, shouldn't crash
         assert lang in [Language.CPP, Language.PYTHON, Language.JAVA, Language.UNKNOWN]
+
+
+class TestLanguageDetectorCache:
+    """Test caching of content detections."""
+
+    @pytest.fixture(autouse=True)
+    def clear_cache(self):
+        LanguageDetector.clear_cache()
+        yield
+        LanguageDetector.clear_cache()
+
+    def test_content_scanned_once(self, monkeypatch):
+        """Repeated detection of the same content should reuse the scores."""
+        calls = []
+        original = LanguageDetector._scan_content.__func__
+
+        def counting_scan(cls, content):
+            calls.append(content)
+            return original(cls, content)
+
+        monkeypatch.setattr(LanguageDetector, "_scan_content", classmethod(counting_scan))
+        detector = LanguageDetector()
+
+        for _ in range(3):
+            assert detector.detect_from_content("def f():\n    print(1)\n") == Language.PYTHON
+        assert LanguageDetector().detect_from_content("def f():\n    print(1)\n") == Language.PYTHON
+
+        assert len(calls) == 1
+
+    def test_scores_count_patterns_per_language(self):
+        """Should score every language in one call."""
+        scores = LanguageDetector._scan_content("import java.util.*;\npublic class A {}")
+
+        assert scores[Language.JAVA] == 2
+        assert scores[Language.PYTHON] == 1  # "import java" also looks like Python
+        assert scores[Language.CPP] == 1  # "class A {"
+
+    def test_cache_is_bounded(self, monkeypatch):
+        """Should evict the least recently used entries."""
+        monkeypatch.setattr(LanguageDetector, "CACHE_SIZE", 4)
+        detector = LanguageDetector()
+
+        for i in range(10):
+            detector.detect_from_content(f"print({i})")
+
+        assert len(LanguageDetector._score_cache) == 4
@@ -0,0 +1,197 @@
+"""
+Tests for core.tools.base.alloc_profiler module
+
+Report parsing, call-site merging and hints use synthetic reports; one test
+builds the interposer and profiles a real program when g++ is available.
+"""
+
+import json
+import shutil
+import subprocess
+import sys
+
+import pytest
+
+from src.app.core.tools.base import alloc_profiler
+from src.app.core.tools.base.alloc_profiler import (
+    ensure_profiler_built,
+    profiler_environment,
+    read_report,
+    summarize_allocations,
+)
+
+
+def frame(module="/work/test", offset=100, symbol=""):
+    return {"module": module, "offset": offset, "address": offset, "symbol": symbol}
+
+
+def write_report(tmp_path, **overrides):
+    report = {
+        "schema": 1,
+        "allocations": 10,
+        "new_calls": 5000,
+        "reallocations": 2,
+        "frees": 4990,
+        "bytes_requested": 200000,
+        "live_bytes": 1024,
+        "peak_live_bytes": 150000,
+        "size_classes": [0, 0, 0, 0, 0, 0, 5000, 12],
+        "sites": [],
+    }
+    report.update(overrides)
+    path = tmp_path / "report.json"
+    path.write_text(json.dumps(report))
+    return str(path)
+
+
+class TestProfilerEnvironment:
+    """Test the environment of profiled processes."""
+
+    def test_sets_preload_and_report_path(self):
+        """The library is preloaded and the report path exported."""
+        env = profiler_environment("/cache/libcts_alloc.so", "/tmp/r.json", base_env={"PATH": "/bin"})
+
+        assert env["LD_PRELOAD"] == "/cache/libcts_alloc.so"
+        assert env["CTS_ALLOC_REPORT"] == "/tmp/r.json"
+        assert env["PATH"] == "/bin"
+        assert "CTS_ALLOC_DEPTH" not in env
+
+    def test_keeps_existing_preloads(self):
+        """Existing LD_PRELOAD entries are kept after the interposer."""
+        env = profiler_environment("/lib.so", "/r.json", depth=1, base_env={"LD_PRELOAD": "/other.so"})
+
+        assert env["LD_PRELOAD"] == "/lib.so:/other.so"
+        assert env["CTS_ALLOC_DEPTH"] == "1"
+
+
+class TestReadReport:
+    """Test summarizing interposer reports."""
+
+    def test_missing_report_returns_none(self, tmp_path):
+        """Killed processes write no report."""
+        assert read_report(str(tmp_path / "missing.json")) is None
+
+    def test_totals(self, tmp_path):
+        """Counts are combined and size classes labelled."""
+        summary = read_report(write_report(tmp_path), symbolize=False)
+
+        assert summary["allocations"] == 5012
+        assert summary["peak_live_bytes"] == 150000
+        assert summary["leaked_bytes"] == 1024
+        assert summary["size_classes"] == {"<64": 5000, "<128": 12}
+
+    def test_unresolved_frames_are_dropped_and_sites_merged(self, tmp_path):
+        """Garbage frames from binaries without frame pointers do not split sites."""
+        sites = [
+            {"count": 300, "bytes": 3000, "frames": [frame(offset=1), {"module": "", "offset": 7, "address": 7}]},
+            {"count": 200, "bytes": 2000, "frames": [frame(offset=1), {"module": "", "offset": 9, "address": 9}]},
+            {"count": 5, "bytes": 50, "frames": [frame(offset=2)]},
+        ]
+        summary = read_report(write_report(tmp_path, sites=sites), symbolize=False)
+
+        top = summary["top_sites"]
+        assert [site["count"] for site in top] == [500, 5]
+        assert top[0]["frames"] == [{"module": "test", "function": "", "location": ""}]
+
+    def test_growing_buffer_hint(self, tmp_path):
+        """A site requesting many power-of-two sizes is reported as growing."""
+        sites = [
+            {"count": 21, "bytes": 8 << 20, "size_classes": (1 << 24) - (1 << 3),
+             "frames": [frame(symbol="vector_grow")]},
+        ]
+        summary = read_report(write_report(tmp_path, sites=sites), symbolize=False)
+
+        assert summary["top_sites"][0]["growth"] is True
+        assert any("reserve()" in hint and "vector_grow" in hint for hint in summary["hints"])
+
+    def test_container_node_hint(self, tmp_path):
+        """Allocations dominated by tree nodes are flagged."""
+        sites = [
+            {"count": 4900, "bytes": 196000, "size_classes": 1 << 6,
+             "frames": [frame(symbol="std::__new_allocator<std::_Rb_tree_node<int> >::allocate")]},
+        ]
+        summary = read_report(write_report(tmp_path, sites=sites), symbolize=False)
+
+        assert any("container nodes" in hint and "_Rb_tree_node" in hint for hint in summary["hints"])
+
+    def test_container_node_hint_without_symbols(self, tmp_path):
+        """Node churn is found from the size classes when the site resolves to main()."""
+        sites = [{"count": 5000, "bytes": 200000, "size_classes": 1 << 6, "frames": [frame(symbol="main")]}]
+        summary = read_report(write_report(tmp_path, sites=sites), symbolize=False)
+
+        assert summary["top_sites"][0]["size_class"] == 6
+        assert any("32-63 byte blocks" in hint and "at main" in hint for hint in summary["hints"])
+
+    def test_kept_small_blocks_are_not_churn(self, tmp_path):
+        """Small blocks that are never freed are not node churn."""
+        summary = read_report(write_report(tmp_path, frees=100), symbolize=False)
+
+        assert not any("container nodes" in hint for hint in summary["hints"])
+
+    def test_small_sites_give_no_hints(self, tmp_path):
+        """Ordinary allocation patterns produce no hints."""
+        sites = [{"count": 10, "bytes": 100, "size_classes": 1 << 4, "frames": [frame()]}]
+        report = write_report(
+            tmp_path, new_calls=60, frees=50, size_classes=[0, 0, 0, 0, 10, 20, 20, 12], sites=sites
+        )
+
+        assert read_report(report, symbolize=False)["hints"] == []
+
+
+class TestSummarizeAllocations:
+    """Test aggregation over a run."""
+
+    def test_no_profiled_tests(self):
+        assert summarize_allocations([{"passed": True}]) is None
+
+    def test_aggregates_maxima_and_hints(self):
+        results = [
+            {"allocations": {"allocations": 10, "peak_live_bytes": 100, "leaked_bytes": 0, "hints": ["a"]}},
+            {"allocations": {"allocations": 30, "peak_live_bytes": 50, "leaked_bytes": 8, "hints": ["a", "b"]}},
+            {"passed": False},
+        ]
+
+        summary = summarize_allocations(results)
+
+        assert summary["profiled_tests"] == 2
+        assert summary["total_allocations"] == 40
+        assert summary["max_peak_live_bytes"] == 100
+        assert summary["max_leaked_bytes"] == 8
+        assert summary["hints"] == {"a": 2, "b": 1}
+
+
+@pytest.mark.skipif(
+    not sys.platform.startswith("linux") or shutil.which("g++") is None,
+    reason="Needs Linux and g++",
+)
+class TestInterposer:
+    """Build the interposer and profile a real program."""
+
+    def test_profiles_map_insertions(self, tmp_path, monkeypatch):
+        monkeypatch.setattr(alloc_profiler, "PROFILER_CACHE_DIR", str(tmp_path / "cache"))
+        library = ensure_profiler_built("g++")
+        assert library is not None
+
+        source = tmp_path / "solution.cpp"
+        source.write_text(
+            "#include <map>\n#include <cstdio>\n"
+            "int main() { std::map<int, int> m; for (int i = 0; i < 5000; ++i) m[i] = i;"
+            " std::printf(\"%zu\\n\", m.size()); }\n"
+        )
+        executable = tmp_path / "solution"
+        subprocess.run(["g++", "-O2", "-o", str(executable), str(source)], check=True)
+
+        report_path = str(tmp_path / "report.json")
+        result = subprocess.run(
+            [str(executable)],
+            env=profiler_environment(library, report_path),
+            stdout=subprocess.PIPE,
+            text=True,
+        )
+
+        assert result.stdout.strip() == "5000"
+        summary = read_report(report_path)
+        assert summary["new_calls"] >= 5000
+        assert summary["peak_live_bytes"] >= 5000 * 40
+        assert summary["top_sites"][0]["count"] >= 5000
+        assert any("container nodes" in hint for hint in summary["hints"])
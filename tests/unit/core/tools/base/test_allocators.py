@@ -0,0 +1,135 @@
+"""
+Tests for core.tools.base.allocators module
+
+Allocator discovery, THP variants, environment merging and the spread report.
+"""
+
+from unittest.mock import patch
+
+import pytest
+
+from src.app.core.tools.base import allocators
+from src.app.core.tools.base.allocators import (
+    THP_DISABLE_ENV,
+    allocator_variants,
+    find_allocators,
+    summarize_allocators,
+    variant_environment,
+)
+
+linux_only = patch.object(allocators.sys, "platform", "linux")
+
+
+class TestFindAllocators:
+    """Test discovery of preloadable allocators."""
+
+    def test_configured_and_discovered(self, tmp_path):
+        jemalloc = tmp_path / "libjemalloc.so.2"
+        jemalloc.write_text("")
+        custom = tmp_path / "custom_mimalloc.so"
+        custom.write_text("")
+
+        with linux_only, patch.object(allocators, "LIBRARY_DIRS", [str(tmp_path)]), patch.object(
+            allocators, "_ldconfig_libraries", return_value={}
+        ):
+            found = find_allocators({"mimalloc": str(custom), "tcmalloc": str(tmp_path / "missing.so")})
+
+        assert found == {"mimalloc": str(custom), "jemalloc": str(jemalloc)}
+
+    def test_linker_cache(self, tmp_path):
+        library = tmp_path / "libtcmalloc_minimal.so.4"
+        library.write_text("")
+
+        with linux_only, patch.object(allocators, "LIBRARY_DIRS", []), patch.object(
+            allocators, "_ldconfig_libraries", return_value={"libtcmalloc_minimal.so.4": str(library)}
+        ):
+            assert find_allocators() == {"tcmalloc": str(library)}
+
+    def test_unsupported_platform(self):
+        with patch.object(allocators.sys, "platform", "darwin"):
+            assert find_allocators({"jemalloc": __file__}) == {}
+
+
+class TestAllocatorVariants:
+    """Test which THP variants are offered."""
+
+    @pytest.mark.parametrize(
+        "mode, thp_disable, expected",
+        [
+            ("madvise", True, {"thp"}),
+            ("always", True, {"thp", "no-thp"}),
+            ("always", False, {"thp"}),
+            ("never", True, set()),
+            (None, True, set()),
+        ],
+    )
+    def test_thp_variants(self, mode, thp_disable, expected):
+        with linux_only, patch.object(allocators, "find_allocators", return_value={}), patch.object(
+            allocators, "thp_mode", return_value=mode
+        ), patch.object(allocators, "glibc_hugetlb_supported", return_value=True):
+            variants = allocator_variants(thp_disable=thp_disable)
+
+        assert set(variants) == expected
+        if "no-thp" in variants:
+            assert variants["no-thp"] == {THP_DISABLE_ENV: "1"}
+
+    def test_allocators_are_preloaded(self):
+        with linux_only, patch.object(
+            allocators, "find_allocators", return_value={"jemalloc": "/lib/libjemalloc.so.2"}
+        ), patch.object(allocators, "thp_mode", return_value="never"):
+            assert allocator_variants() == {"jemalloc": {"LD_PRELOAD": "/lib/libjemalloc.so.2"}}
+
+
+def test_variant_environment_extends_preload_and_tunables():
+    env = variant_environment(
+        {"LD_PRELOAD": "/lib/jemalloc.so", "GLIBC_TUNABLES": "glibc.malloc.hugetlb=1", "X": "1"},
+        base_env={"LD_PRELOAD": "/lib/counter.so", "GLIBC_TUNABLES": "glibc.malloc.arena_max=1"},
+    )
+
+    assert env["LD_PRELOAD"] == "/lib/jemalloc.so:/lib/counter.so"
+    assert env["GLIBC_TUNABLES"] == "glibc.malloc.arena_max=1:glibc.malloc.hugetlb=1"
+    assert env["X"] == "1"
+
+
+def _run(time, output_hash="h"):
+    return {"execution_time": time, "passed": True, "error_details": "Accepted", "output_hash": output_hash}
+
+
+class TestSummarizeAllocators:
+    """Test the spread report."""
+
+    def test_allocator_bound_solution(self):
+        results = [
+            {"test_number": n, "tournament": {
+                "test": _run(0.10 * n), "test@jemalloc": _run(0.06 * n), "test@thp": _run(0.099 * n)}}
+            for n in range(1, 9)
+        ]
+
+        summary = summarize_allocators(results, {"test@jemalloc": "jemalloc", "test@thp": "thp"})
+
+        jemalloc = summary["variants"]["jemalloc"]
+        assert jemalloc["median_ratio"] == pytest.approx(0.6)
+        assert jemalloc["significant"] is True
+        assert summary["spread"] == pytest.approx(0.45 / 0.27)
+        assert summary["allocator_bound"] is True
+
+    def test_insensitive_solution(self):
+        results = [
+            {"test_number": n, "tournament": {
+                "test": _run(0.1), "test@jemalloc": _run(0.1 + (0.001 if n % 2 else -0.001))}}
+            for n in range(1, 9)
+        ]
+
+        summary = summarize_allocators(results, {"test@jemalloc": "jemalloc"})
+
+        assert summary["allocator_bound"] is False
+
+    def test_output_change_is_reported(self):
+        results = [{"test_number": 1, "tournament": {"test": _run(0.1), "test@mimalloc": _run(0.1, "other")}}]
+
+        summary = summarize_allocators(results, {"test@mimalloc": "mimalloc"})
+
+        assert summary["variants"]["mimalloc"]["output_mismatches"] == 1
+
+    def test_without_variant_results(self):
+        assert summarize_allocators([{"test_number": 1}], {"test@thp": "thp"}) is None
@@ -0,0 +1,128 @@
+"""
+Tests for core.tools.base.autotune module
+
+Schedules, eliminations and the report use synthetic tournament results.
+"""
+
+import pytest
+
+from src.app.core.tools.base.autotune import (
+    MIN_ROUND_TESTS,
+    bootstrap_median_ci,
+    candidate_stats,
+    halving_schedule,
+    select_survivors,
+    summarize_autotune,
+)
+
+
+class TestHalvingSchedule:
+    """Test the inputs measured per round."""
+
+    def test_doubles_inputs_per_round(self):
+        assert halving_schedule(8, 32) == [4, 8, 16, 32]
+
+    def test_first_round_has_minimum_inputs(self):
+        schedule = halving_schedule(7, 8)
+
+        assert schedule[0] == MIN_ROUND_TESTS
+        assert schedule[-1] == 8
+        assert schedule == sorted(set(schedule))
+
+    def test_single_candidate_runs_once(self):
+        assert halving_schedule(1, 10) == [10]
+
+
+def test_bootstrap_interval_contains_median():
+    values = [0.8, 0.85, 0.9, 0.9, 0.95, 1.0, 0.7, 0.88]
+
+    low, high = bootstrap_median_ci(values)
+
+    assert low <= 0.89 <= high
+    assert bootstrap_median_ci(values) == (low, high)
+    assert bootstrap_median_ci([0.5]) == (0.5, 0.5)
+
+
+def _run(time, output_hash="h", passed=True, error="Accepted"):
+    return {"execution_time": time, "passed": passed, "error_details": error, "output_hash": output_hash}
+
+
+def _results(times, count=6):
+    """times: candidate key -> time relative to the regular build's 1.0"""
+    return [
+        {
+            "test_number": n,
+            "tournament": {"test": _run(1.0 * n), **{key: _run(t * n) for key, t in times.items()}},
+        }
+        for n in range(1, count + 1)
+    ]
+
+
+class TestSelection:
+    """Test the elimination of slow and misbehaving candidates."""
+
+    def test_ratio_to_regular_build(self):
+        stats = candidate_stats(_results({"a": 0.5}), "a")
+
+        assert stats["tests"] == 6
+        assert stats["median_ratio"] == pytest.approx(0.5)
+
+    def test_keeps_faster_half(self):
+        results = _results({"a": 0.5, "b": 0.9, "c": 1.2, "d": 0.7})
+
+        survivors, eliminated = select_survivors(results, ["a", "b", "c", "d"])
+
+        assert survivors == ["a", "d"]
+        assert eliminated == ["b", "c"]
+
+    def test_changed_output_disqualifies(self):
+        results = _results({"a": 0.5, "b": 0.9})
+        results[2]["tournament"]["a"]["output_hash"] = "other"
+
+        survivors, eliminated = select_survivors(results, ["a", "b"], keep_all=True)
+
+        assert survivors == ["b"]
+        assert eliminated == ["a"]
+
+
+class TestSummarizeAutotune:
+    """Test the autotuning report."""
+
+    LABELS = {"a": "O3", "b": "unroll"}
+    OVERRIDES = {"a": {"optimization": "O3"}, "b": {"extra_flags": ["-funroll-loops"]}}
+
+    def test_without_results(self):
+        assert summarize_autotune([{"test_number": 1}], self.LABELS, self.OVERRIDES) is None
+
+    def test_recommends_reliably_faster_flags(self):
+        results = _results({"a": 0.6, "b": 0.9}, count=10)
+
+        summary = summarize_autotune(results, self.LABELS, self.OVERRIDES, rounds=[{"tests": 10}])
+
+        best = summary["best"]
+        assert best["label"] == "O3"
+        assert best["speedup"] == pytest.approx(1 / 0.6)
+        assert best["ratio_ci"][1] < 1.0
+        assert best["significant"] is True
+        assert summary["recommended_overrides"] == {"optimization": "O3"}
+        assert summary["rounds"] == [{"tests": 10}]
+
+    def test_no_recommendation_without_gain(self):
+        results = _results({"a": 1.0, "b": 1.1})
+        for n, result in enumerate(results):
+            result["tournament"]["a"]["execution_time"] *= 0.8 if n % 2 else 1.25
+
+        summary = summarize_autotune(results, self.LABELS, self.OVERRIDES)
+
+        assert summary["best"]["significant"] is False
+        assert summary["recommended_overrides"] == {}
+
+    def test_disqualified_candidates_are_marked(self):
+        results = _results({"a": 0.5, "b": 0.9})
+        results[0]["tournament"]["a"] = _run(0.0, passed=False, error="Test solution failed with exit code -11: ")
+
+        summary = summarize_autotune(results, self.LABELS, self.OVERRIDES)
+
+        disqualified = next(c for c in summary["candidates"] if c["label"] == "O3")
+        assert disqualified["disqualified"]["crashes"] == [1]
+        assert summary["best"]["label"] == "unroll"
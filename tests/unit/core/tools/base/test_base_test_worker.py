@@ -589,3 +589,399 @@ class TestSignalEmission:
 
         assert len(result_holder) == 1
         assert result_holder[0] is False
+
+
+class SeededTestWorker(BaseTestWorker):
+    """Minimal worker returning one passing result per test."""
+
+    def _run_single_test(self, test_number: int):
+        return {"test_number": test_number, "passed": True}
+
+    def _emit_test_completed(self, test_result):
+        pass
+
+
+class TestBaseTestWorkerSeeds:
+    """Test per-test generator seeds."""
+
+    def test_run_seed_is_used_when_given(self):
+        """Should keep an explicit run seed."""
+        worker = SeededTestWorker("/workspace", {}, 1, run_seed=42)
+
+        assert worker.run_seed == 42
+
+    def test_random_run_seed_by_default(self):
+        """Should pick a 64-bit run seed when none is given."""
+        worker = SeededTestWorker("/workspace", {}, 1)
+
+        assert 0 <= worker.run_seed < 2**64
+
+    def test_test_seed_is_reproducible(self):
+        """Same run seed should reproduce the same per-test seeds."""
+        first = SeededTestWorker("/workspace", {}, 1, run_seed=7)
+        second = SeededTestWorker("/workspace", {}, 1, run_seed=7)
+
+        assert first._test_seed(3) == second._test_seed(3)
+        assert first._test_seed(3) != first._test_seed(4)
+
+    def test_generator_env_exports_seed(self):
+        """Generator environment should carry the test seed."""
+        worker = SeededTestWorker("/workspace", {}, 1, run_seed=7)
+
+        env = worker._generator_env(2)
+
+        assert env["CTS_SEED"] == str(worker._test_seed(2))
+
+    def test_results_record_test_seed(self):
+        """Every stored result should record its generator seed."""
+        worker = SeededTestWorker("/workspace", {}, 3, run_seed=11)
+
+        worker.run_tests()
+
+        for result in worker.get_test_results():
+            assert result["test_seed"] == worker._test_seed(result["test_number"])
+
+
+class TestAdaptiveConcurrency:
+    """Test the number of tests in flight."""
+
+    def test_explicit_worker_count_is_static(self):
+        """A requested worker count is kept for the whole run."""
+        worker = SeededTestWorker("/workspace", {}, 10, max_workers=2)
+
+        assert worker.concurrency is None
+        assert worker.worker_slots == 2
+
+    @patch("src.app.core.tools.specialized.base_test_worker.pressure_supported", return_value=True)
+    @patch("multiprocessing.cpu_count", return_value=16)
+    def test_auto_worker_count_adapts_up_to_cpu_count(self, mock_cpu_count, mock_supported):
+        """The auto-calculated count is the start, one test per CPU the ceiling."""
+        worker = SeededTestWorker("/workspace", {}, 10)
+
+        assert worker.max_workers == 8
+        assert worker.concurrency.limit == 8
+        assert worker.worker_slots == 16
+
+    def test_in_flight_tests_follow_the_limit(self):
+        """No more tests run at once than the controller allows."""
+        import threading
+
+        running = []
+        peak = []
+        lock = threading.Lock()
+
+        class CountingWorker(SeededTestWorker):
+            def _run_single_test(self, test_number):
+                with lock:
+                    running.append(test_number)
+                    peak.append(len(running))
+                time.sleep(0.01)
+                with lock:
+                    running.remove(test_number)
+                return {"test_number": test_number, "passed": True, "memory_used": 5.0}
+
+        worker = CountingWorker("/workspace", {}, 12, max_workers=4)
+        worker.concurrency = MagicMock(limit=2, ceiling=4)
+
+        worker.run_tests()
+
+        assert len(worker.get_test_results()) == 12
+        assert max(peak) <= 2
+        assert worker.concurrency.record.call_count == 12
+        assert worker.concurrency.update.called
+
+
+class TestBaseTestWorkerProcessLaunch:
+    """Test the process launch indirection."""
+
+    def test_launch_process_uses_popen_by_default(self):
+        """Roles without a warm interpreter should use subprocess.Popen."""
+        worker = SeededTestWorker("/workspace", {}, 1)
+
+        with patch("subprocess.Popen") as mock_popen:
+            worker._launch_process("test", ["./test"], stdin=-1)
+
+        mock_popen.assert_called_once_with(["./test"], stdin=-1)
+
+    def test_launch_process_uses_warm_interpreter(self):
+        """Warm roles should fork from the warm interpreter."""
+        worker = SeededTestWorker("/workspace", {}, 1)
+        warm = MagicMock()
+        warm.command = ["python", "-u", "validator.py"]
+        worker._warm_interpreters["validator"] = warm
+
+        with patch("subprocess.Popen") as mock_popen:
+            worker._launch_process(
+                "validator", ["python", "-u", "validator.py", "in.txt"], env={"A": "1"}
+            )
+
+        mock_popen.assert_not_called()
+        warm.spawn.assert_called_once_with(stdin=None, env={"A": "1"}, args=["in.txt"])
+
+    def test_warm_interpreters_stopped_after_run(self):
+        """run_tests() should shut the warm interpreters down."""
+        worker = SeededTestWorker(
+            "/workspace", {}, 1, execution_commands={"test": ["python", "t.py"]}
+        )
+        worker.enable_warm_interpreters({"test": "py"})
+
+        with patch(
+            "src.app.core.tools.specialized.base_test_worker.WarmInterpreter"
+        ) as mock_warm:
+            mock_warm.return_value.start.return_value = True
+            worker.run_tests()
+
+        mock_warm.assert_called_once_with(["python", "t.py"])
+        mock_warm.return_value.close.assert_called_once()
+        assert worker._warm_interpreters == {}
+
+    def test_java_roles_use_jvm_pool(self):
+        """Java roles should get a JVM pool sized to the worker threads."""
+        worker = SeededTestWorker(
+            "/workspace", {}, 1, max_workers=3,
+            execution_commands={"test": ["java", "-cp", "/ws", "Test"]},
+        )
+        worker.enable_warm_interpreters({"test": "java"})
+
+        with patch(
+            "src.app.core.tools.specialized.base_test_worker.WarmJvmPool"
+        ) as mock_pool:
+            mock_pool.return_value.start.return_value = True
+            worker.run_tests()
+
+        mock_pool.assert_called_once_with(["java", "-cp", "/ws", "Test"], size=3)
+        mock_pool.return_value.close.assert_called_once()
+
+    def test_jvm_pool_caps_adaptive_concurrency(self):
+        """Tests in flight should never outnumber the persistent JVMs."""
+        from src.app.core.tools.base.concurrency import AdaptiveConcurrency
+
+        worker = SeededTestWorker(
+            "/workspace", {}, 1, execution_commands={"test": ["java", "-cp", "/ws", "Test"]}
+        )
+        worker.max_workers = 2
+        worker.concurrency = AdaptiveConcurrency(2, 16)
+        worker.enable_warm_interpreters({"test": "java"})
+
+        with patch(
+            "src.app.core.tools.specialized.base_test_worker.WarmJvmPool"
+        ) as mock_pool:
+            mock_pool.return_value.start.return_value = True
+            mock_pool.return_value.size = 2
+            worker._start_warm_interpreters()
+
+        assert worker.concurrency.ceiling == 2
+        assert worker.worker_slots == 2
+
+
+class TestBaseTestWorkerStartupProbes:
+    """Test startup probing on the worker thread."""
+
+    def test_probes_after_the_run(self):
+        """Configured commands are probed once, after the tests."""
+        worker = SeededTestWorker("/workspace", {}, 2)
+        worker.set_startup_probes({"test": ["./test"]})
+        probe = {"min_seconds": 0.001, "median_seconds": 0.001, "runs": 5, "exit_code": 0}
+
+        with patch(
+            "src.app.core.tools.specialized.base_test_worker.measure_startup", return_value=probe
+        ) as mock_probe:
+            worker.run_tests()
+
+        mock_probe.assert_called_once_with(["./test"])
+        assert worker.startup_probes == {"test": probe}
+
+    def test_stopped_run_is_not_probed(self):
+        """A stopped worker ends without probing."""
+        worker = SeededTestWorker("/workspace", {}, 1)
+        worker.set_startup_probes({"test": ["./test"]})
+        worker.stop()
+
+        with patch("src.app.core.tools.specialized.base_test_worker.measure_startup") as mock_probe:
+            worker._probe_startup()
+
+        mock_probe.assert_not_called()
+        assert worker.startup_probes == {}
+
+
+class TestBaseTestWorkerStackLimits:
+    """Test per-role stack limits of launched processes."""
+
+    def test_no_limits_by_default(self):
+        """Processes are launched without preexec_fn unless a limit is set."""
+        worker = SeededTestWorker("/workspace", {}, 1)
+
+        with patch("src.app.core.tools.specialized.base_test_worker.subprocess.Popen") as mock_popen:
+            worker._launch_process("test", ["./test"], stdin=-1)
+
+        assert "preexec_fn" not in mock_popen.call_args.kwargs
+
+    def test_limited_role_runs_through_launcher(self):
+        """Limited roles get the trampoline prefix and keep the vfork path."""
+        worker = SeededTestWorker("/workspace", {}, 1)
+
+        with patch(
+            "src.app.core.tools.specialized.base_test_worker.ensure_launcher_built",
+            return_value="/cache/cts_rlimit_exec",
+        ), patch(
+            "src.app.core.tools.specialized.base_test_worker.stack_limit_prefix",
+            return_value=["/cache/cts_rlimit_exec", "268435456", "inf", "--"],
+        ) as mock_prefix:
+            worker.set_stack_limits({"test": 256})
+
+        mock_prefix.assert_called_once_with(256, "/cache/cts_rlimit_exec")
+        with patch("src.app.core.tools.specialized.base_test_worker.subprocess.Popen") as mock_popen:
+            worker._launch_process("test", ["./test"], stdin=-1)
+            worker._launch_process("generator", ["./gen"], stdin=-1)
+
+        test_call, generator_call = mock_popen.call_args_list
+        assert test_call.args[0] == ["/cache/cts_rlimit_exec", "268435456", "inf", "--", "./test"]
+        assert "preexec_fn" not in test_call.kwargs
+        assert generator_call.args[0] == ["./gen"]
+        assert worker._stack_limit_kb("test") is not None
+
+    def test_placed_test_runs_on_its_core(self):
+        """Processes of a placed test get the trampoline and the slot's environment."""
+        from src.app.core.tools.base.cpu_topology import CorePool, CpuTopology, PhysicalCore
+
+        worker = SeededTestWorker("/workspace", {}, 3, max_workers=4)
+        pool = CorePool(CpuTopology([PhysicalCore(0, 0, 0, (2, 6)), PhysicalCore(1, 0, 1, (3, 7))]))
+        with patch(
+            "src.app.core.tools.specialized.base_test_worker.ensure_launcher_built",
+            return_value="/cache/cts_rlimit_exec",
+        ):
+            worker.set_cpu_placement(pool)
+
+        assert worker.max_workers == 2
+        worker._placement.slot = pool.slots[1]
+        with patch("src.app.core.tools.specialized.base_test_worker.subprocess.Popen") as mock_popen:
+            worker._launch_process("test", ["./test"], stdin=-1, env={"PATH": "/bin"})
+
+        call = mock_popen.call_args
+        assert call.args[0] == ["/cache/cts_rlimit_exec", "-", "-", "--", "./test"]
+        assert call.kwargs["env"] == {"PATH": "/bin", "CTS_CPU_LIST": "3", "CTS_MEMBIND_NODE": "1"}
+
+        worker._placement.slot = None
+        worker._run_single_test = lambda number: (
+            worker._launch_process("test", ["./test"], stdin=-1),
+            {"test_number": number, "passed": True},
+        )[1]
+        with patch("src.app.core.tools.specialized.base_test_worker.subprocess.Popen"):
+            worker.run_tests()
+        assert {tuple(r["cpu_placement"]["cpus"]) for r in worker.get_test_results()} <= {(2,), (3,)}
+        assert all("cpu_placement" in r for r in worker.get_test_results())
+
+    def test_persistent_jvm_tests_are_not_placed(self):
+        """A test in a shared JVM is neither pinned nor recorded as placed."""
+        from src.app.core.tools.base.cpu_topology import CorePool, CpuTopology, PhysicalCore
+        from src.app.core.tools.base.warm_java_pool import WarmJavaProcess
+
+        worker = SeededTestWorker("/workspace", {}, 2, max_workers=2)
+        pool = CorePool(CpuTopology([PhysicalCore(0, 0, 0, (2, 6)), PhysicalCore(1, 0, 1, (3, 7))]))
+        with patch(
+            "src.app.core.tools.specialized.base_test_worker.ensure_launcher_built",
+            return_value=None,
+        ):
+            worker.set_cpu_placement(pool)
+        warm = Mock(command=["java", "Main"])
+        warm.spawn.return_value = Mock(spec=WarmJavaProcess, pid=4242)
+        worker._warm_interpreters["test"] = warm
+        worker._run_single_test = lambda number: (
+            worker._launch_process("test", ["java", "Main"], stdin=-1),
+            {"test_number": number, "passed": True},
+        )[1]
+        worker._start_warm_interpreters = Mock()
+        worker._stop_warm_interpreters = Mock()
+
+        with patch("src.app.core.tools.specialized.base_test_worker.os.sched_setaffinity") as pin:
+            worker.run_tests()
+
+        pin.assert_not_called()
+        assert worker.get_test_results()
+        assert not any("cpu_placement" in r for r in worker.get_test_results())
+
+    def test_limited_role_gets_preexec_without_launcher(self):
+        """Without the trampoline, limited roles fall back to preexec_fn."""
+        worker = SeededTestWorker("/workspace", {}, 1)
+        setter = Mock()
+
+        with patch(
+            "src.app.core.tools.specialized.base_test_worker.ensure_launcher_built",
+            return_value=None,
+        ), patch(
+            "src.app.core.tools.specialized.base_test_worker.stack_limit_preexec",
+            return_value=setter,
+        ) as mock_preexec:
+            worker.set_stack_limits({"test": 256})
+
+        mock_preexec.assert_called_once_with(256)
+        with patch("src.app.core.tools.specialized.base_test_worker.subprocess.Popen") as mock_popen:
+            worker._launch_process("test", ["./test"], stdin=-1)
+            worker._launch_process("generator", ["./gen"], stdin=-1)
+
+        assert mock_popen.call_args_list[0].kwargs["preexec_fn"] is setter
+        assert "preexec_fn" not in mock_popen.call_args_list[1].kwargs
+
+    def test_unsupported_platform_has_no_preexec(self):
+        """Where limits cannot be set, the role launches normally."""
+        worker = SeededTestWorker("/workspace", {}, 1)
+
+        with patch(
+            "src.app.core.tools.specialized.base_test_worker.ensure_launcher_built",
+            return_value=None,
+        ), patch(
+            "src.app.core.tools.specialized.base_test_worker.stack_limit_preexec",
+            return_value=None,
+        ):
+            worker.set_stack_limits({"test": 256})
+
+        assert worker._process_limits("test") == {}
+        assert worker._stack_limit_kb("test") is None
+
+
+class TestBaseTestWorkerOutputLimit:
+    """Test the output limit of captured solution output."""
+
+    def test_capture_kills_process_over_limit(self):
+        """A solution printing past the limit is killed."""
+        import subprocess
+        import sys
+
+        worker = SeededTestWorker("/workspace", {}, 1)
+        worker.set_output_limit(1)
+        process = subprocess.Popen(
+            [sys.executable, "-c", "while True: print('x' * 4096)"],
+            stdout=subprocess.PIPE,
+            text=True,
+        )
+
+        capture = worker._capture_output(process)
+        capture.join(timeout=30)
+        process.wait(timeout=10)
+
+        assert capture.exceeded
+        assert process.returncode != 0
+        assert worker._output_limit_message() == "Output Limit Exceeded (>1MB)"
+
+
+class TestBaseTestWorkerCheckpoints:
+    """Test running a worker from a checkpoint journal."""
+
+    def test_resumed_run_skips_completed_tests(self, tmp_path):
+        """Tests completed before the checkpoint are not run again."""
+        from src.app.core.tools.base.checkpoint import RunJournal
+
+        journal = RunJournal.create(str(tmp_path / "run.jsonl"), "comparison", 9, 6, {}, interval=0.0)
+        for number in (1, 2, 4):
+            journal.record({"test_number": number, "passed": number != 2})
+        journal.checkpoint()
+
+        worker = SeededTestWorker("/workspace", {}, 6, max_workers=2)
+        worker.enable_checkpoints(RunJournal.load(journal.path))
+        worker.run_tests()
+
+        run = sorted(r["test_number"] for r in worker.get_test_results())
+        assert run == [2, 3, 5, 6]  # the failure from the journal, and the new tests
+        assert worker.run_seed == 9
+        assert worker.unrecorded_passes == 2
+        assert RunJournal.load(journal.path).complete
@@ -0,0 +1,107 @@
+"""
+Tests for core.tools.base.calibration module
+
+Profile parsing, speed factors per workload class and the session cache.
+"""
+
+import subprocess
+from unittest.mock import MagicMock, patch
+
+import pytest
+
+from src.app.core.tools.base import calibration
+from src.app.core.tools.base.calibration import (
+    class_factor,
+    measure_machine_profile,
+    parse_profile,
+    run_calibration,
+    speed_factors,
+    summarize_calibration,
+)
+
+REFERENCE = {"alu": 0.2, "latency": 0.4, "bandwidth": 0.1, "branchy": 0.3}
+
+
+class TestParseProfile:
+    """Test parsing of the suite's output."""
+
+    def test_complete_profile(self):
+        text = '{"alu": 0.2, "latency": 0.4, "bandwidth": 0.1, "branchy": 0.3}\n'
+
+        assert parse_profile(text) == REFERENCE
+
+    @pytest.mark.parametrize(
+        "text",
+        [
+            "",
+            "[1, 2]",
+            '{"alu": 0.2, "latency": 0.4, "bandwidth": 0.1}',
+            '{"alu": 0.2, "latency": 0.4, "bandwidth": 0.1, "branchy": 0}',
+            '{"alu": "fast", "latency": 0.4, "bandwidth": 0.1, "branchy": 0.3}',
+        ],
+    )
+    def test_rejects_incomplete_profiles(self, text):
+        assert parse_profile(text) is None
+
+
+class TestRunCalibration:
+    """Test running the kernel suite."""
+
+    def test_passes_repetitions_and_parses_output(self):
+        completed = MagicMock(returncode=0, stdout='{"alu": 1, "latency": 2, "bandwidth": 3, "branchy": 4}')
+
+        with patch.object(calibration.subprocess, "run", return_value=completed) as run:
+            profile = run_calibration("/cache/cts_calibrate", repetitions=2)
+
+        assert run.call_args.args[0] == ["/cache/cts_calibrate", "2"]
+        assert profile == {"alu": 1.0, "latency": 2.0, "bandwidth": 3.0, "branchy": 4.0}
+
+    def test_timeout(self):
+        with patch.object(
+            calibration.subprocess, "run", side_effect=subprocess.TimeoutExpired("cts_calibrate", 60)
+        ):
+            assert run_calibration("/cache/cts_calibrate") is None
+
+    def test_session_cache(self):
+        with patch.object(calibration, "_local_profile", None), patch.object(
+            calibration, "ensure_kernels_built", return_value="/cache/cts_calibrate"
+        ), patch.object(calibration, "run_calibration", return_value=dict(REFERENCE)) as run:
+            first = measure_machine_profile()
+            second = measure_machine_profile()
+            measure_machine_profile(refresh=True)
+
+        assert first == second == REFERENCE
+        assert run.call_count == 2
+
+
+class TestSpeedFactors:
+    """Test comparison with the reference profile."""
+
+    def test_local_over_reference(self):
+        local = {"alu": 0.3, "latency": 0.4, "bandwidth": 0.2, "branchy": 0.15}
+
+        factors = speed_factors(local, REFERENCE)
+
+        assert factors == pytest.approx({"alu": 1.5, "latency": 1.0, "bandwidth": 2.0, "branchy": 0.5})
+
+    def test_invalid_reference(self):
+        assert speed_factors(REFERENCE, {"alu": 0.2}) is None
+        assert speed_factors(REFERENCE, "fast") is None
+
+    def test_class_factor(self):
+        factors = {"alu": 1.5, "latency": 1.0, "bandwidth": 2.0, "branchy": 0.5}
+
+        assert class_factor(factors, "bandwidth") == 2.0
+        # Geometric mean: (1.5 * 1.0 * 2.0 * 0.5) ** 0.25
+        assert class_factor(factors, "mixed") == pytest.approx(1.5 ** 0.25)
+        with pytest.raises(ValueError):
+            class_factor(factors, "io")
+
+    def test_summary_predicts_judge_time(self):
+        factors = {"alu": 2.0, "latency": 1.0, "bandwidth": 1.0, "branchy": 1.0}
+
+        summary = summarize_calibration(factors, "alu", 1000, max_execution_time=1.6)
+
+        assert summary["local_time_limit_ms"] == 2000
+        assert summary["predicted_max_time"] == pytest.approx(0.8)
+        assert summary["predicted_within_limit"] is True
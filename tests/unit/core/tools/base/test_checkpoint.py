@@ -0,0 +1,145 @@
+"""
+Tests for core.tools.base.checkpoint module
+
+The seed cursor, checkpoints written and loaded back, a line cut short by
+a crash, and the binaries of a run.
+"""
+
+import json
+import sys
+
+import pytest
+
+from src.app.core.tools.base.checkpoint import RunJournal, binary_hashes, journal_path
+
+
+def new_journal(tmp_path, test_count=10, interval=0.0, binaries=None):
+    return RunJournal.create(
+        journal_path(str(tmp_path / "checkpoints"), 42),
+        "comparison",
+        42,
+        test_count,
+        binaries if binaries is not None else {"test": "abc"},
+        workspace_dir=str(tmp_path),
+        files={"test": str(tmp_path / "test.cpp")},
+        options={"max_workers": 2},
+        interval=interval,
+    )
+
+
+def result(test_number, passed=True, **values):
+    return {"test_number": test_number, "passed": passed, **values}
+
+
+class TestSeedCursor:
+    """Test which tests count as completed."""
+
+    def test_cursor_follows_the_completed_prefix(self, tmp_path):
+        journal = new_journal(tmp_path)
+
+        for number in (1, 2, 4, 5):
+            journal.record(result(number))
+
+        assert journal.cursor == 2
+        assert [n for n in range(1, 8) if journal.is_done(n)] == [1, 2, 4, 5]
+        journal.record(result(3))
+        assert journal.cursor == 5
+
+    def test_repeated_results_count_once(self, tmp_path):
+        journal = new_journal(tmp_path)
+
+        journal.record(result(1, passed=False))
+        journal.record(result(1, passed=False))
+
+        assert (journal.passed, journal.failed, len(journal.failures)) == (0, 1, 1)
+
+    def test_remaining_skips_completed_tests(self, tmp_path):
+        journal = new_journal(tmp_path)
+        journal.record(result(1))
+        journal.record(result(3))
+
+        assert list(journal.remaining(range(1, 6))) == [2, 4, 5]
+
+
+class TestCheckpoints:
+    """Test writing and loading checkpoints."""
+
+    def test_checkpoint_waits_for_the_interval(self, tmp_path):
+        journal = new_journal(tmp_path, interval=3600)
+        journal.record(result(1))
+
+        assert not journal.checkpoint()
+        assert journal.checkpoint(force=True)
+
+    def test_load_continues_from_the_last_checkpoint(self, tmp_path):
+        journal = new_journal(tmp_path)
+        journal.record(result(1, test_time=0.5))
+        journal.record(result(2, passed=False, test_time=0.25))
+        journal.checkpoint()
+        journal.record(result(4, test_time=1.0))
+        journal.checkpoint()
+        # Not checkpointed before the "crash"
+        journal.record(result(3, passed=False))
+
+        loaded = RunJournal.load(journal.path)
+
+        assert loaded.run_seed == 42
+        assert loaded.header["options"] == {"max_workers": 2}
+        assert (loaded.cursor, loaded.passed, loaded.failed) == (2, 2, 1)
+        assert loaded.is_done(4) and not loaded.is_done(3)
+        assert [r["test_number"] for r in loaded.failures] == [2]
+        assert loaded.totals == {"test_time": 1.75}
+        assert loaded.sessions == 2
+        assert loaded.interval == 0.0
+
+    def test_last_checkpoint_of_a_complete_run_is_the_end(self, tmp_path):
+        journal = new_journal(tmp_path, test_count=2)
+        journal.record(result(1))
+        journal.record(result(2))
+        journal.checkpoint()
+
+        assert journal.complete
+        assert RunJournal.load(journal.path).complete
+
+    def test_incomplete_last_line_is_removed(self, tmp_path):
+        journal = new_journal(tmp_path)
+        journal.record(result(1))
+        journal.checkpoint()
+        with open(journal.path, "a") as f:
+            f.write('{"type": "checkpoint", "cur')
+
+        loaded = RunJournal.load(journal.path)
+        loaded.record(result(2))
+        loaded.checkpoint()
+
+        with open(journal.path) as f:
+            entries = [json.loads(line) for line in f]
+        assert [entry["type"] for entry in entries] == ["run", "checkpoint", "checkpoint"]
+        assert entries[-1]["cursor"] == 2
+
+    def test_other_files_are_rejected(self, tmp_path):
+        path = tmp_path / "other.jsonl"
+        path.write_text('{"type": "test"}\n')
+
+        with pytest.raises(ValueError):
+            RunJournal.load(str(path))
+
+
+class TestBinaries:
+    """Test the binary hashes of a run."""
+
+    def test_hashes_the_files_of_each_command(self, tmp_path):
+        script = tmp_path / "test.py"
+        script.write_text("print(1)\n")
+
+        hashes = binary_hashes({"test": [sys.executable, str(script)], "java": ["java", "-cp", "x", "Main"]})
+
+        assert hashes["java"] is None
+        script.write_text("print(2)\n")
+        assert binary_hashes({"test": [sys.executable, str(script)]})["test"] != hashes["test"]
+
+    def test_changed_binaries(self, tmp_path):
+        journal = new_journal(tmp_path, binaries={"test": "abc", "generator": "def"})
+
+        assert journal.changed_binaries({"test": "abc", "generator": "def"}) == []
+        assert journal.changed_binaries({"test": "xyz", "generator": "def"}) == ["test"]
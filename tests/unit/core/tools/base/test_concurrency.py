@@ -0,0 +1,148 @@
+"""
+Tests for core.tools.base.concurrency module
+
+PSI parsing and the decisions of the adaptive concurrency controller.
+"""
+
+from unittest.mock import mock_open, patch
+
+from src.app.core.tools.base import concurrency
+from src.app.core.tools.base.concurrency import (
+    HOLD_WINDOWS,
+    AdaptiveConcurrency,
+    read_available_mb,
+    read_pressure_totals,
+)
+
+PSI_FILE = (
+    "some avg10=1.00 avg60=0.50 avg300=0.10 total={total}\n"
+    "full avg10=0.00 avg60=0.00 avg300=0.00 total=0\n"
+)
+
+
+class FakeMachine:
+    """Clock, stall counters and available memory driven by the test."""
+
+    def __init__(self):
+        self.now = 0.0
+        self.totals = {"cpu": 0, "memory": 0, "io": 0}
+        self.available = 16000.0
+
+    def advance(self, seconds, **stalled_shares):
+        self.now += seconds
+        for resource, share in stalled_shares.items():
+            self.totals[resource] += int(share * seconds * 1e6)
+
+    def controller(self, initial=2, ceiling=8):
+        return AdaptiveConcurrency(
+            initial,
+            ceiling,
+            clock=lambda: self.now,
+            read_pressure=lambda: dict(self.totals),
+            read_available=lambda: self.available,
+        )
+
+
+def complete(controller, count, rss=10.0):
+    for _ in range(count):
+        controller.record({"passed": True, "memory_used": rss})
+
+
+class TestReadPressure:
+    """Test reading /proc/pressure and /proc/meminfo."""
+
+    def test_some_totals(self):
+        with patch("builtins.open", mock_open(read_data=PSI_FILE.format(total=1234))):
+            assert read_pressure_totals() == {"cpu": 1234, "memory": 1234, "io": 1234}
+
+    def test_unavailable(self):
+        with patch("builtins.open", side_effect=FileNotFoundError):
+            assert read_pressure_totals() is None
+            assert read_available_mb() is None
+
+    def test_available_memory(self):
+        meminfo = "MemTotal:       32000000 kB\nMemAvailable:    2048000 kB\n"
+        with patch("builtins.open", mock_open(read_data=meminfo)):
+            assert read_available_mb() == 2000
+
+
+class TestAdaptiveConcurrency:
+    """Test how the limit follows pressure, memory and throughput."""
+
+    def test_grows_while_slots_are_full_and_pressure_is_low(self):
+        machine = FakeMachine()
+        controller = machine.controller(initial=2, ceiling=4)
+
+        for _ in range(5):
+            complete(controller, 8)
+            machine.advance(1.0, cpu=0.01)
+            controller.update(in_flight=controller.limit - 1)
+
+        assert controller.limit == 4
+        assert controller.decisions["probe"] == 2
+
+    def test_does_not_grow_with_idle_slots_or_cpu_pressure(self):
+        machine = FakeMachine()
+        controller = machine.controller(initial=2)
+
+        complete(controller, 8)
+        machine.advance(1.0)
+        controller.update(in_flight=0)
+        complete(controller, 8)
+        machine.advance(1.0, cpu=0.9)
+        controller.update(in_flight=1)
+
+        assert controller.limit == 2
+
+    def test_memory_pressure_halves_the_limit(self):
+        machine = FakeMachine()
+        controller = machine.controller(initial=8)
+
+        machine.advance(1.0, memory=0.2)
+        controller.update(in_flight=7)
+
+        assert controller.limit == 4
+        assert controller.decisions == {"memory_pressure": 1}
+
+    def test_peak_rss_caps_the_limit(self):
+        machine = FakeMachine()
+        machine.available = 1000.0
+        controller = machine.controller(initial=8)
+        complete(controller, 1, rss=400.0)
+
+        machine.advance(1.0)
+        controller.update(in_flight=1)
+
+        # One running, two more fit into 80% of 1000 MB at 400 MB each
+        assert controller.limit == 3
+        assert controller.peak_rss_mb == 400.0
+
+    def test_takes_back_a_step_that_lowered_throughput(self):
+        machine = FakeMachine()
+        controller = machine.controller(initial=2)
+
+        complete(controller, 10)
+        machine.advance(1.0)
+        controller.update(in_flight=1)  # 10 tests/s -> 3
+        complete(controller, 6)
+        machine.advance(1.0)
+        controller.update(in_flight=2)  # 6 tests/s -> back to 2
+
+        assert controller.limit == 2
+        assert controller.decisions == {"probe": 1, "throughput_drop": 1}
+
+        for _ in range(HOLD_WINDOWS):
+            complete(controller, 6)
+            machine.advance(1.0)
+            controller.update(in_flight=1)
+        assert controller.limit == 2
+
+    def test_waits_for_the_control_interval(self):
+        machine = FakeMachine()
+        controller = machine.controller(initial=2)
+
+        complete(controller, 8)
+        machine.advance(concurrency.CONTROL_INTERVAL / 2)
+
+        assert controller.update(in_flight=1) == 2
+        assert controller.decisions == {}
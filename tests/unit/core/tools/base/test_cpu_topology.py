@@ -0,0 +1,139 @@
+"""
+Tests for core.tools.base.cpu_topology module
+
+Topology discovery from a fake sysfs tree, slot order and the core pool.
+"""
+
+import threading
+
+from src.app.core.tools.base.cpu_topology import (
+    CPU_LIST_ENV,
+    MEMBIND_NODE_ENV,
+    CorePool,
+    CoreSlot,
+    CpuTopology,
+    PhysicalCore,
+    parse_cpu_list,
+    placement_environment,
+    placement_slots,
+    read_topology,
+)
+
+
+def make_sysfs(root, nodes):
+    """
+    Build a sysfs tree.
+
+    Args:
+        nodes: Node -> list of (package, core, [cpus]) entries
+    """
+    for node, cores in nodes.items():
+        node_dir = root / "node" / f"node{node}"
+        node_dir.mkdir(parents=True)
+        cpus = [cpu for _, _, core_cpus in cores for cpu in core_cpus]
+        node_dir.joinpath("cpulist").write_text(",".join(map(str, sorted(cpus))) + "\n")
+        for package, core, core_cpus in cores:
+            for cpu in core_cpus:
+                topology = root / "cpu" / f"cpu{cpu}" / "topology"
+                topology.mkdir(parents=True)
+                topology.joinpath("physical_package_id").write_text(f"{package}\n")
+                topology.joinpath("core_id").write_text(f"{core}\n")
+
+
+# Two sockets, one node each, two cores with two hardware threads per socket
+DUAL_SOCKET = {
+    0: [(0, 0, [0, 4]), (0, 1, [1, 5])],
+    1: [(1, 0, [2, 6]), (1, 1, [3, 7])],
+}
+
+
+class TestReadTopology:
+    """Test discovery of physical cores."""
+
+    def test_cpu_list(self):
+        assert parse_cpu_list("0-3,8,10-11\n") == {0, 1, 2, 3, 8, 10, 11}
+
+    def test_dual_socket_with_smt(self, tmp_path):
+        make_sysfs(tmp_path, DUAL_SOCKET)
+
+        topology = read_topology(str(tmp_path), allowed=set(range(8)))
+
+        assert topology.to_dict() == {
+            "packages": 2,
+            "nodes": 2,
+            "physical_cores": 4,
+            "logical_cpus": 8,
+            "smt": True,
+        }
+        assert topology.cores[2] == PhysicalCore(package=1, core=0, node=1, cpus=(2, 6))
+
+    def test_respects_affinity_mask(self, tmp_path):
+        make_sysfs(tmp_path, DUAL_SOCKET)
+
+        topology = read_topology(str(tmp_path), allowed={1, 5, 3})
+
+        assert [core.cpus for core in topology.cores] == [(1, 5), (3,)]
+
+    def test_missing_topology(self, tmp_path):
+        assert read_topology(str(tmp_path), allowed={0}) is None
+
+
+class TestPlacementSlots:
+    """Test the slot order of a topology."""
+
+    def test_one_thread_per_core_interleaved_across_nodes(self, tmp_path):
+        make_sysfs(tmp_path, DUAL_SOCKET)
+        topology = read_topology(str(tmp_path), allowed=set(range(8)))
+
+        slots = placement_slots(topology)
+
+        # The core of CPU 0 is left to the harness
+        assert slots == [CoreSlot((1,), 0), CoreSlot((2,), 1), CoreSlot((3,), 1)]
+
+    def test_single_node_does_not_bind_memory(self):
+        topology = CpuTopology([PhysicalCore(0, 0, 0, (0, 2)), PhysicalCore(0, 1, 0, (1, 3))])
+
+        assert placement_slots(topology) == [CoreSlot((0,), None), CoreSlot((1,), None)]
+
+    def test_environment(self):
+        env = placement_environment(CoreSlot((3,), 1), base_env={"PATH": "/bin"})
+
+        assert env == {"PATH": "/bin", CPU_LIST_ENV: "3", MEMBIND_NODE_ENV: "1"}
+
+
+class TestCorePool:
+    """Test handing out slots to running tests."""
+
+    def test_prefers_slots_in_order(self):
+        topology = CpuTopology([PhysicalCore(0, core, 0, (core,)) for core in range(2)])
+        pool = CorePool(topology)
+
+        first = pool.acquire()
+        second = pool.acquire()
+        pool.release(first)
+
+        assert pool.acquire() == first
+        assert second != first
+
+    def test_waits_for_a_free_slot(self):
+        pool = CorePool(CpuTopology([PhysicalCore(0, 0, 0, (0,))]))
+        slot = pool.acquire()
+        acquired = []
+
+        waiter = threading.Thread(target=lambda: acquired.append(pool.acquire()))
+        waiter.start()
+        waiter.join(0.05)
+        assert acquired == []
+
+        pool.release(slot)
+        waiter.join(1)
+        assert acquired == [slot]
+
+    def test_summary(self):
+        pool = CorePool(CpuTopology([PhysicalCore(0, 0, 0, (0, 1))]))
+
+        summary = pool.to_dict()
+
+        assert summary["slots"] == [{"cpus": [0], "node": None}]
+        assert summary["memory_binding"] is False
+        assert summary["smt"] is True
@@ -0,0 +1,88 @@
+"""
+Tests for core.tools.base.differential module
+
+Profile registration names and the comparison with the regular build use
+synthetic results.
+"""
+
+from unittest.mock import patch
+
+import pytest
+
+from src.app.core.tools.base.differential import (
+    available_profiles,
+    profile_variant,
+    summarize_differential,
+)
+
+
+def test_variant_name_tracks_overrides():
+    first = profile_variant("O0", {"optimization": "O0"})
+
+    assert first.startswith("diff_O0_")
+    assert profile_variant("O0", {"optimization": "O0"}) == first
+    assert profile_variant("O0", {"optimization": "O1"}) != first
+    assert profile_variant("no march/x", {}).startswith("diff_no_march_x_")
+
+
+def test_profiles_with_missing_compiler_are_skipped():
+    profiles = {"O3": {"optimization": "O3"}, "clang": {"compiler": "clang++"}}
+
+    with patch("src.app.core.tools.base.differential.shutil.which", return_value=None):
+        assert list(available_profiles(profiles)) == ["O3"]
+
+
+def _entry(time, output_hash="h", passed=True, error="Accepted"):
+    return {"execution_time": time, "passed": passed, "error_details": error, "output_hash": output_hash}
+
+
+class TestSummarizeDifferential:
+    """Test the comparison of profile builds with the regular build."""
+
+    PROFILES = {"test:diff_O0_1": "O0"}
+
+    def _results(self, profile_entries):
+        return [
+            {"test_number": n, "tournament": {"test": _entry(0.1 * n), "test:diff_O0_1": entry}}
+            for n, entry in enumerate(profile_entries, start=1)
+        ]
+
+    def test_without_differential_results(self):
+        assert summarize_differential([{"test_number": 1}], self.PROFILES) is None
+
+    def test_slower_profile_without_mismatches(self):
+        summary = summarize_differential(
+            self._results([_entry(0.3 * n) for n in range(1, 7)]), self.PROFILES
+        )
+
+        profile = summary["profiles"]["O0"]
+        assert profile["median_time_ratio"] == pytest.approx(3.0)
+        assert profile["time_significant"] is True
+        assert profile["output_mismatches"] == []
+        assert summary["suspected_undefined_behavior"] is False
+
+    def test_mismatch_and_crash_suggest_undefined_behavior(self):
+        results = self._results([
+            _entry(0.1, output_hash="other"),
+            _entry(0.0, passed=False, error="Test solution failed with exit code -11: "),
+            _entry(0.3),
+        ])
+
+        summary = summarize_differential(results, self.PROFILES)
+
+        profile = summary["profiles"]["O0"]
+        assert profile["output_mismatches"] == [1]
+        assert profile["crashes"] == [2]
+        assert profile["compared_tests"] == 2
+        assert summary["suspected_undefined_behavior"] is True
+
+    def test_reports_verdict_changes(self):
+        results = self._results([_entry(0.1)])
+        results[0]["tournament"]["test"] = _entry(5.0, passed=False, error="Time Limit Exceeded (1.00s)")
+
+        profile = summarize_differential(results, self.PROFILES)["profiles"]["O0"]
+
+        assert profile["verdict_changes"] == [
+            {"test_number": 1, "regular": "Time Limit Exceeded (1.00s)", "profile": "Accepted"}
+        ]
+        assert profile["crashes"] == []
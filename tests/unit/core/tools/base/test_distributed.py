@@ -0,0 +1,173 @@
+"""
+Tests for core.tools.base.distributed module and the worker agent
+
+Deterministic sharding, the frame protocol, running a test on an agent, and
+a broker run with local agents over a Unix socket.
+"""
+
+import socket
+import sys
+
+import pytest
+
+from src.app.core.tools.base import distributed_agent
+from src.app.core.tools.base.distributed import (
+    Broker,
+    missing_ranges,
+    shard_ranges,
+    shipped_command,
+    spawn_local_agents,
+)
+from src.app.core.tools.base.distributed_agent import (
+    PROTOCOL_VERSION,
+    recv_frame,
+    run_test,
+    send_frame,
+)
+from src.app.core.tools.base.seeds import derive_test_seed
+
+GENERATOR = "import os\nprint(int(os.environ['CTS_SEED']) % 1000)\n"
+CORRECT = "print(int(input()) * 2)\n"
+# Wrong on multiples of 7
+TEST = "n = int(input())\nprint(n if n % 7 == 0 else n * 2)\n"
+
+
+@pytest.fixture
+def commands(tmp_path):
+    """Python generator, test and correct solution in tmp_path."""
+    result = {}
+    for role, source in (("generator", GENERATOR), ("test", TEST), ("correct", CORRECT)):
+        path = tmp_path / f"{role}.py"
+        path.write_text(source)
+        result[role] = [sys.executable, str(path)]
+    return result
+
+
+def expected_failures(run_seed, test_count):
+    return [n for n in range(1, test_count + 1) if derive_test_seed(run_seed, n) % 1000 % 7 == 0]
+
+
+class TestSharding:
+    """Test the partitioning of a run into jobs."""
+
+    def test_chunks_cover_every_test_once(self):
+        assert shard_ranges(10, 4) == [(1, 4), (5, 8), (9, 10)]
+
+    def test_default_chunk_size(self):
+        assert len(shard_ranges(6400)) == 64
+        assert shard_ranges(10**7)[0] == (1, 1000)
+
+    def test_missing_ranges(self):
+        assert missing_ranges(1, 8, {1, 2, 5}) == [(3, 4), (6, 8)]
+        assert missing_ranges(1, 3, {1, 2, 3}) == []
+
+    def test_agent_seeds_match_local_runs(self):
+        for n in (1, 2, 12345, 10**7):
+            assert distributed_agent.derive_test_seed(987654321, n) == derive_test_seed(987654321, n)
+
+
+class TestProtocol:
+    """Test frames and shipped commands."""
+
+    def test_frame_roundtrip(self):
+        left, right = socket.socketpair()
+        with left, right:
+            send_frame(left, {"type": "file", "sha256": "x"}, b"\x00binary")
+            send_frame(left, {"type": "stop"})
+
+            assert recv_frame(right) == ({"type": "file", "sha256": "x", "size": 7}, b"\x00binary")
+            assert recv_frame(right) == ({"type": "stop"}, b"")
+
+    def test_shipped_command_replaces_the_script(self, commands):
+        command, digest, path = shipped_command(commands["test"])
+
+        assert command == [sys.executable, f"{{file:{digest}}}"]
+        assert path == commands["test"][1]
+
+    def test_command_without_file_is_rejected(self):
+        with pytest.raises(ValueError):
+            shipped_command(["java", "-cp", "/nonexistent", "Main"])
+
+
+class TestRunTest:
+    """Test the verdict records of the agent."""
+
+    def test_passing_test(self, commands):
+        run_seed = next(s for s in range(100) if derive_test_seed(s, 1) % 1000 % 7)
+
+        record = run_test(commands, run_seed, 1)
+
+        assert record[:2] == [1, "OK"]
+        assert len(record) == 5
+
+    def test_wrong_answer_carries_excerpts(self, commands):
+        run_seed = next(s for s in range(1000) if derive_test_seed(s, 1) % 1000 % 7 == 0)
+        value = derive_test_seed(run_seed, 1) % 1000
+
+        record = run_test(commands, run_seed, 1)
+
+        assert record[1] == "WA"
+        assert record[5] == {
+            "error": "Output mismatch",
+            "input": str(value),
+            "test_output": str(value),
+            "correct_output": str(value * 2),
+        }
+
+    def test_runtime_error(self, commands, tmp_path):
+        crash = tmp_path / "crash.py"
+        crash.write_text("import sys\nsys.exit('boom')\n")
+
+        record = run_test({**commands, "test": [sys.executable, str(crash)]}, 1, 1)
+
+        assert record[1] == "RE"
+        assert record[5]["error"].startswith("Test solution failed: boom")
+
+
+class TestBroker:
+    """Test runs of the broker with agents."""
+
+    def test_local_agents_run_every_test(self, commands, tmp_path):
+        broker = Broker(commands, 42, 30, address=f"unix:{tmp_path}/broker.sock", chunk_tests=4)
+        agents = spawn_local_agents(broker.start(), 2, slots=2)
+
+        records = [record for _, record in broker.records()]
+
+        assert sorted(record[0] for record in records) == list(range(1, 31))
+        assert sorted(r[0] for r in records if r[1] != "OK") == expected_failures(42, 30)
+        summary = broker.summary()
+        assert summary["completed_tests"] == 30
+        assert sum(agent["tests"] for agent in summary["agents"].values()) == 30
+        for agent in agents:
+            assert agent.wait(10) == 0
+
+    def test_tests_of_a_lost_agent_are_handed_out_again(self, commands, tmp_path):
+        broker = Broker(commands, 7, 6, address=f"unix:{tmp_path}/broker.sock", chunk_tests=6)
+        address = broker.start()
+
+        # An agent that reports one test of its job and disconnects
+        lost = distributed_agent.connect(address)
+        send_frame(lost, {"type": "hello", "protocol": PROTOCOL_VERSION, "name": "lost", "slots": 1})
+        header, _ = recv_frame(lost)
+        while header["type"] != "job":
+            header, _ = recv_frame(lost)
+        send_frame(lost, {"type": "records", "job": header["job"], "records": [[1, "OK", 0, 0, 0]]})
+        lost.close()
+
+        agents = spawn_local_agents(address, 1, slots=2)
+        records = [record for _, record in broker.records()]
+
+        assert sorted(record[0] for record in records) == list(range(1, 7))
+        assert broker.summary()["requeued_tests"] == 5
+        assert agents[0].wait(10) == 0
+
+    def test_rejects_agents_without_the_token(self, commands, tmp_path):
+        broker = Broker(commands, 1, 1, address=f"unix:{tmp_path}/broker.sock", token="secret")
+        intruder = distributed_agent.connect(broker.start())
+        send_frame(intruder, {"type": "hello", "protocol": PROTOCOL_VERSION, "name": "x", "token": "guess"})
+
+        with pytest.raises(ConnectionError):
+            recv_frame(intruder)
+        intruder.close()
+        broker.stop()
+        assert broker.agents == {}
@@ -0,0 +1,47 @@
+"""
+Tests for core.tools.base.flamegraph module
+
+Layout of collapsed stacks into SVG frames.
+"""
+
+import re
+import xml.dom.minidom
+
+from src.app.core.tools.base.flamegraph import render_flamegraph
+
+
+def frame_widths(svg):
+    """Map frame name -> drawn width, read from the tooltips and rects."""
+    widths = {}
+    for title, width in re.findall(r"<title>(.*?) \(\d+ samples.*?</title><rect [^>]*width=\"([\d.]+)\"", svg):
+        widths[title] = float(width)
+    return widths
+
+
+class TestRenderFlamegraph:
+    """Test SVG rendering."""
+
+    def test_valid_svg(self):
+        svg = render_flamegraph([["main;solve", 3], ["main;read", 1]], "Test #1")
+
+        document = xml.dom.minidom.parseString(svg)
+        assert document.documentElement.tagName == "svg"
+        assert "Test #1" in svg
+
+    def test_widths_follow_sample_counts(self):
+        svg = render_flamegraph([["main;solve", 3], ["main;read", 1]])
+
+        widths = frame_widths(svg)
+        assert widths["all"] == widths["main"]
+        assert widths["solve"] == 3 * widths["read"]
+
+    def test_names_are_escaped(self):
+        svg = render_flamegraph([["main;std::map<int, int>::operator[]", 1]])
+
+        xml.dom.minidom.parseString(svg)
+        assert "std::map&lt;int, int&gt;" in svg
+
+    def test_empty_profile(self):
+        svg = render_flamegraph([])
+
+        xml.dom.minidom.parseString(svg)
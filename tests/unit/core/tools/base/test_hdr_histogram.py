@@ -0,0 +1,157 @@
+"""
+Tests for core.tools.base.hdr_histogram module
+
+HDR histogram precision, percentiles, merging and serialization, plus the
+per-run resource histograms used by the benchmarker.
+"""
+
+import json
+import math
+import random
+
+import pytest
+
+from src.app.core.tools.base.hdr_histogram import HdrHistogram, ResourceHistograms
+
+
+def exact_percentile(values, percentile):
+    ordered = sorted(values)
+    return ordered[max(0, math.ceil(percentile / 100 * len(ordered)) - 1)]
+
+
+class TestHdrHistogram:
+    """Test recording and percentile queries."""
+
+    def test_empty_histogram(self):
+        """An empty histogram has no percentiles."""
+        histogram = HdrHistogram()
+
+        assert histogram.total_count == 0
+        assert histogram.value_at_percentile(50) is None
+        assert histogram.mean is None
+
+    def test_small_values_are_exact(self):
+        """Values below the sub-bucket count are stored exactly."""
+        histogram = HdrHistogram(significant_figures=3)
+        for value in range(1, 101):
+            histogram.record(value)
+
+        assert histogram.value_at_percentile(50) == 50
+        assert histogram.value_at_percentile(99) == 99
+        assert histogram.value_at_percentile(100) == 100
+
+    @pytest.mark.parametrize("significant_figures", [2, 3])
+    def test_percentiles_keep_precision(self, significant_figures):
+        """Percentiles should stay within the configured relative precision."""
+        rng = random.Random(7)
+        values = [int(rng.lognormvariate(8, 2)) for _ in range(5000)]
+        histogram = HdrHistogram(significant_figures=significant_figures)
+        for value in values:
+            histogram.record(value)
+
+        for percentile in (50, 90, 99, 99.9):
+            exact = exact_percentile(values, percentile)
+            assert histogram.value_at_percentile(percentile) == pytest.approx(
+                exact, rel=2 * 10**-significant_figures, abs=1
+            )
+
+    def test_tail_is_visible(self):
+        """A slow tail should show up in p99 even when the mean hides it."""
+        histogram = HdrHistogram()
+        for _ in range(980):
+            histogram.record(1000)
+        for _ in range(20):
+            histogram.record(10000)
+
+        assert histogram.value_at_percentile(50) == 1000
+        assert histogram.value_at_percentile(99) == pytest.approx(10000, rel=1e-3)
+
+    def test_buckets_cover_all_counts(self):
+        """Log2 buckets should add up to the total count."""
+        histogram = HdrHistogram()
+        for value in (0, 5, 3000, 70000, 70001):
+            histogram.record(value)
+
+        buckets = histogram.buckets()
+        assert sum(bucket["count"] for bucket in buckets) == 5
+        assert all(bucket["from"] <= bucket["to"] for bucket in buckets)
+
+    def test_rejects_negative_values(self):
+        """Negative values cannot be recorded."""
+        with pytest.raises(ValueError):
+            HdrHistogram().record(-1)
+
+
+class TestHdrHistogramMerging:
+    """Test merging and serialization across runs."""
+
+    def test_merge_equals_combined_recording(self):
+        """Merging two histograms matches recording everything in one."""
+        first, second, combined = HdrHistogram(), HdrHistogram(), HdrHistogram()
+        for value in range(1, 1000):
+            (first if value % 2 else second).record(value * 37)
+            combined.record(value * 37)
+
+        first.merge(second)
+
+        assert first.total_count == combined.total_count
+        assert first.min_value == combined.min_value
+        assert first.max_value == combined.max_value
+        assert first.percentiles() == combined.percentiles()
+
+    def test_merge_rejects_different_precision(self):
+        """Histograms with different settings cannot be merged."""
+        with pytest.raises(ValueError):
+            HdrHistogram(significant_figures=2).merge(HdrHistogram(significant_figures=3))
+
+    def test_round_trip_through_json(self):
+        """A serialized histogram restores to the same distribution."""
+        histogram = HdrHistogram()
+        for value in (1, 20, 300, 4000, 50000):
+            histogram.record(value)
+
+        restored = HdrHistogram.from_dict(json.loads(json.dumps(histogram.to_dict())))
+
+        assert restored.summary() == histogram.summary()
+
+
+class TestResourceHistograms:
+    """Test the per-run wall/CPU/RSS bundle."""
+
+    def test_records_scaled_metrics(self):
+        """Seconds become microseconds and MB become KB."""
+        histograms = ResourceHistograms.from_results(
+            [{"execution_time": 0.25, "cpu_time": 0.2, "memory_used": 2.0}]
+        )
+
+        assert histograms.histograms["wall_time_us"].max_value == 250000
+        assert histograms.histograms["cpu_time_us"].max_value == 200000
+        assert histograms.histograms["peak_rss_kb"].max_value == 2048
+
+    def test_missing_metrics_are_skipped(self):
+        """Results without CPU time should not be recorded as zero."""
+        histograms = ResourceHistograms.from_results([{"execution_time": 0.1}])
+
+        assert histograms.histograms["cpu_time_us"].total_count == 0
+
+    def test_unmeasured_memory_is_skipped(self):
+        """Tests in a persistent JVM should not record its shared RSS."""
+        histograms = ResourceHistograms.from_results(
+            [{"execution_time": 0.1, "memory_used": 0.0, "stack_used": 0.0, "memory_measured": False}]
+        )
+
+        assert histograms.histograms["wall_time_us"].total_count == 1
+        assert histograms.histograms["peak_rss_kb"].total_count == 0
+        assert histograms.histograms["peak_stack_kb"].total_count == 0
+
+    def test_analysis_can_be_merged_across_runs(self):
+        """Analysis sections of two runs restore and merge."""
+        run1 = ResourceHistograms.from_results([{"execution_time": 0.1}] * 3)
+        run2 = ResourceHistograms.from_results([{"execution_time": 0.3}])
+
+        merged = ResourceHistograms.from_analysis(json.loads(json.dumps(run1.to_analysis())))
+        merged.merge(ResourceHistograms.from_analysis(run2.to_analysis()))
+
+        wall = merged.histograms["wall_time_us"]
+        assert wall.total_count == 4
+        assert wall.value_at_percentile(100) == 300000
@@ -0,0 +1,156 @@
+"""
+Tests for core.tools.base.instruction_counter module
+
+Time estimation and summaries use synthetic counts; one test builds the
+counter and runs a real program when g++ is available (instruction counts
+may be unavailable there, the task clock is not).
+"""
+
+import json
+import shutil
+import subprocess
+
+import pytest
+
+from src.app.core.tools.base import alloc_profiler
+from src.app.core.tools.base.instruction_counter import (
+    counter_environment,
+    counter_supported,
+    ensure_counter_built,
+    estimate_time,
+    read_counts,
+    summarize_timing,
+    watchdog_timeout,
+)
+
+
+class TestReadCounts:
+    """Test parsing of counter reports."""
+
+    def test_missing_report(self, tmp_path):
+        assert read_counts(str(tmp_path / "none.json")) is None
+
+    def test_converts_task_clock_to_seconds(self, tmp_path):
+        path = tmp_path / "c.json"
+        path.write_text(json.dumps({"instructions": 1500, "task_clock_ns": 250000000}))
+
+        assert read_counts(str(path)) == {"instructions": 1500, "task_clock": 0.25}
+
+    def test_keeps_counter_error(self, tmp_path):
+        path = tmp_path / "c.json"
+        path.write_text('{"instructions": null, "task_clock_ns": 1000, "error": "No such file or directory"}')
+
+        counts = read_counts(str(path))
+        assert counts["instructions"] is None
+        assert counts["error"] == "No such file or directory"
+
+
+class TestEstimateTime:
+    """Test the fallback chain of timing sources."""
+
+    def test_wall_mode_ignores_counts(self):
+        assert estimate_time("wall", 0.9, 0.3, {"instructions": 10**9}) == (0.9, "wall")
+
+    def test_instructions_at_reference_rate(self):
+        counts = {"instructions": 6 * 10**9, "task_clock": 1.7}
+
+        assert estimate_time("instructions", 5.0, 1.8, counts, reference_ips=3e9) == (2.0, "instructions")
+
+    def test_instructions_fall_back_to_task_clock(self):
+        counts = {"instructions": None, "task_clock": 0.4}
+
+        assert estimate_time("instructions", 2.0, 0.5, counts) == (0.4, "task_clock")
+
+    def test_falls_back_to_sampled_cpu_time_then_wall(self):
+        assert estimate_time("cpu", 2.0, 0.5) == (0.5, "cpu_time")
+        assert estimate_time("instructions", 2.0, 0.0) == (2.0, "wall")
+
+
+def test_watchdog_is_loose_outside_wall_mode():
+    assert watchdog_timeout("wall", 2.0) == 2.0
+    assert watchdog_timeout("cpu", 2.0) == 6.0
+    assert watchdog_timeout("instructions", 0.1) == pytest.approx(1.1)
+
+
+class TestSummarizeTiming:
+    """Test the timing analysis of a run."""
+
+    def test_wall_mode(self):
+        assert summarize_timing([{"execution_time": 0.1}], "wall") is None
+
+    def test_sources_and_measured_rate(self):
+        results = [
+            {"execution_time": 0.5, "wall_time": 1.5, "timing_source": "instructions",
+             "instructions": 1_500_000_000, "task_clock": 0.5},
+            {"execution_time": 0.3, "wall_time": 0.4, "timing_source": "instructions",
+             "instructions": 900_000_000, "task_clock": 0.3},
+            {"execution_time": 0.2, "wall_time": 0.2, "timing_source": "cpu_time"},
+        ]
+
+        summary = summarize_timing(results, "instructions", reference_ips=3e9)
+
+        assert summary["sources"] == {"instructions": 2, "cpu_time": 1}
+        assert summary["total_instructions"] == 2_400_000_000
+        assert summary["measured_instructions_per_second"] == pytest.approx(3e9)
+        assert summary["max_wall_time"] == 1.5
+        assert summary["max_estimated_time"] == 0.5
+
+    def test_reports_counter_errors(self):
+        results = [{"execution_time": 0.1, "timing_source": "task_clock", "instructions": None,
+                    "task_clock": 0.1, "counter_error": "No such file or directory"}]
+
+        summary = summarize_timing(results, "instructions")
+
+        assert summary["counter_errors"] == ["No such file or directory"]
+        assert "measured_instructions_per_second" not in summary
+
+
+def test_counter_environment_extends_preload():
+    env = counter_environment("/cache/libcts_count.so", "/tmp/c.json", base_env={"LD_PRELOAD": "x.so"})
+
+    assert env["LD_PRELOAD"] == "/cache/libcts_count.so:x.so"
+    assert env["CTS_COUNT_REPORT"] == "/tmp/c.json"
+
+
+@pytest.mark.skipif(
+    not counter_supported() or shutil.which("g++") is None, reason="Needs Linux and g++"
+)
+class TestCounter:
+    """Build the counter and count a real program."""
+
+    def _count(self, library, executable, n, report_path):
+        subprocess.run(
+            [str(executable)],
+            input=f"{n}\n",
+            env=counter_environment(library, report_path),
+            stdout=subprocess.PIPE,
+            text=True,
+            check=True,
+        )
+        return read_counts(report_path)
+
+    def test_counts_are_stable(self, tmp_path, monkeypatch):
+        monkeypatch.setattr(alloc_profiler, "PROFILER_CACHE_DIR", str(tmp_path / "cache"))
+        library = ensure_counter_built("g++")
+        assert library is not None
+
+        source = tmp_path / "solution.cpp"
+        source.write_text(
+            "#include <cstdio>\n"
+            "int main() { long long n, s = 0; if (std::scanf(\"%lld\", &n) != 1) return 1;"
+            " for (long long i = 0; i < n; ++i) s += i % 7 * (i ^ s);"
+            " std::printf(\"%lld\\n\", s); }\n"
+        )
+        executable = tmp_path / "solution"
+        subprocess.run(["g++", "-O2", "-o", str(executable), str(source)], check=True)
+
+        first = self._count(library, executable, 20000000, str(tmp_path / "a.json"))
+        second = self._count(library, executable, 20000000, str(tmp_path / "b.json"))
+
+        assert first["task_clock"] > 0
+        if first["instructions"] is None:
+            assert first["error"]
+        else:
+            # Retired instructions barely vary between runs of the same input
+            assert first["instructions"] > 20000000
+            assert abs(first["instructions"] - second["instructions"]) < first["instructions"] * 0.01
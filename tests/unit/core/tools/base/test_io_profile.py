@@ -0,0 +1,148 @@
+"""
+Tests for core.tools.base.io_profile module
+
+Non-reaping exit detection, /proc counter parsing and tiny-chunk warnings.
+"""
+
+import subprocess
+import sys
+import time
+
+import pytest
+
+from src.app.core.tools.base.io_profile import (
+    MIN_SYSCALLS_FOR_WARNING,
+    has_exited,
+    io_profiling_supported,
+    read_io_counters,
+    summarize_io,
+    summarize_io_results,
+)
+
+requires_proc_io = pytest.mark.skipif(not io_profiling_supported(), reason="Needs /proc and WNOWAIT")
+
+
+def counters(**overrides):
+    values = {
+        "read_syscalls": 10,
+        "write_syscalls": 10,
+        "bytes_read": 40960,
+        "bytes_written": 40960,
+        "user_time": 0.5,
+        "system_time": 0.01,
+    }
+    values.update(overrides)
+    return values
+
+
+class TestSummarizeIo:
+    """Test derived metrics and warnings."""
+
+    def test_buffered_output_has_no_warnings(self):
+        """Few large writes are fine."""
+        summary = summarize_io(counters())
+
+        assert summary["avg_write_bytes"] == 4096
+        assert summary["warnings"] == []
+
+    def test_tiny_writes_are_flagged(self):
+        """Thousands of few-byte writes point at endl or unbuffered output."""
+        summary = summarize_io(counters(write_syscalls=100000, bytes_written=700000))
+
+        assert summary["avg_write_bytes"] == 7
+        assert len(summary["warnings"]) == 1
+        assert "endl" in summary["warnings"][0]
+
+    def test_few_tiny_writes_are_not_flagged(self):
+        """Small outputs are not worth a warning."""
+        summary = summarize_io(
+            counters(write_syscalls=MIN_SYSCALLS_FOR_WARNING - 1, bytes_written=100)
+        )
+
+        assert summary["warnings"] == []
+
+    def test_tiny_reads_are_flagged(self):
+        """Unbuffered input shows up as many tiny reads."""
+        summary = summarize_io(counters(read_syscalls=50000, bytes_read=50000))
+
+        assert any("read()" in w for w in summary["warnings"])
+
+    def test_kernel_time_share(self):
+        """A large system time share is reported."""
+        summary = summarize_io(counters(user_time=0.1, system_time=0.3))
+
+        assert summary["system_time_ratio"] == pytest.approx(0.75)
+        assert any("kernel" in w for w in summary["warnings"])
+
+    def test_zero_counters(self):
+        """A process that did nothing has no averages and no warnings."""
+        summary = summarize_io(
+            counters(
+                read_syscalls=0, write_syscalls=0, bytes_read=0, bytes_written=0,
+                user_time=0.0, system_time=0.0,
+            )
+        )
+
+        assert summary["avg_write_bytes"] == 0.0
+        assert summary["system_time_ratio"] == 0.0
+        assert summary["warnings"] == []
+
+
+class TestSummarizeIoResults:
+    """Test aggregation over a run."""
+
+    def test_no_profiles(self):
+        """Runs without profiles have no aggregate."""
+        assert summarize_io_results([{"test_number": 1}]) is None
+
+    def test_aggregates_and_flags_tests(self):
+        """Totals are summed and tests with warnings listed."""
+        noisy = summarize_io(counters(write_syscalls=100000, bytes_written=700000))
+        quiet = summarize_io(counters())
+
+        summary = summarize_io_results(
+            [{"test_number": 1, "io": quiet}, {"test_number": 2, "io": noisy}, {"test_number": 3}]
+        )
+
+        assert summary["profiled_tests"] == 2
+        assert summary["write_syscalls"] == 100010
+        assert summary["max_write_syscalls"] == 100000
+        assert summary["tests_with_warnings"] == [2]
+        assert len(summary["warnings"]) == 1
+
+
+@requires_proc_io
+class TestProcCounters:
+    """Test reading counters from a real exited child."""
+
+    def test_has_exited_does_not_reap(self):
+        """The exited child stays waitable and its counters readable."""
+        script = "import os\nfor _ in range(300): os.write(1, b'x')"
+        process = subprocess.Popen([sys.executable, "-c", script], stdout=subprocess.PIPE)
+        output = process.stdout.read()
+
+        deadline = time.time() + 10
+        while not has_exited(process.pid) and time.time() < deadline:
+            time.sleep(0.01)
+        io = read_io_counters(process.pid)
+        process.wait()
+
+        assert output == b"x" * 300
+        assert io is not None
+        assert io["write_syscalls"] >= 300
+        assert io["bytes_written"] >= 300
+        assert process.returncode == 0
+
+    def test_has_exited_for_running_child(self):
+        """A running child is reported as running."""
+        process = subprocess.Popen([sys.executable, "-c", "import time; time.sleep(5)"])
+        try:
+            assert has_exited(process.pid) is False
+        finally:
+            process.kill()
+            process.wait()
+
+    def test_unknown_process(self):
+        """Non-children and missing processes give no answer."""
+        assert has_exited(1) is None
+        assert read_io_counters(2**22 + 12345) is None
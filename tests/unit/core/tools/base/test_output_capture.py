@@ -0,0 +1,123 @@
+"""
+Tests for core.tools.base.output_capture module
+
+Display excerpts, normalized digests and first differences, and capture
+of real pipes with and without a limit.
+"""
+
+import subprocess
+import sys
+
+from src.app.core.tools.base.output_capture import (
+    NormalizedHasher,
+    OutputCapture,
+    display_excerpt,
+    first_difference,
+    normalized_digest,
+    output_limit_chars,
+)
+
+
+class TestDisplayExcerpt:
+    """Test shortening of large outputs."""
+
+    def test_short_output_is_unchanged(self):
+        assert display_excerpt("1 2 3\n", head=4, tail=4) == "1 2 3\n"
+
+    def test_keeps_head_and_tail(self):
+        excerpt = display_excerpt("a" * 10 + "b" * 100 + "c" * 10, head=10, tail=10)
+
+        assert excerpt.startswith("a" * 10 + "\n")
+        assert excerpt.endswith("\n" + "c" * 10)
+        assert "[100 characters omitted]" in excerpt
+
+
+def test_output_limit_chars():
+    assert output_limit_chars(0) is None
+    assert output_limit_chars(None) is None
+    assert output_limit_chars(2) == 2 * 1024 * 1024
+
+
+def _python(code):
+    return subprocess.Popen(
+        [sys.executable, "-c", code], stdout=subprocess.PIPE, stderr=subprocess.DEVNULL, text=True
+    )
+
+
+class TestOutputCapture:
+    """Test capture of a process's stdout."""
+
+    def test_reads_complete_output(self):
+        process = _python("print('x' * 200000)")
+
+        capture = OutputCapture(process.stdout, limit=1024 * 1024).start()
+        capture.join(timeout=10)
+        process.wait(timeout=10)
+
+        assert capture.text == "x" * 200000 + "\n"
+        assert not capture.exceeded
+
+    def test_runaway_output_is_cut_off(self):
+        """A process printing forever is killed once it passes the limit."""
+        process = _python("while True: print('spam' * 1000)")
+
+        capture = OutputCapture(process.stdout, limit=1024 * 1024, on_limit=process.kill).start()
+        capture.join(timeout=30)
+        process.wait(timeout=10)
+
+        assert capture.exceeded
+        assert capture.size > 1024 * 1024
+        assert len(capture.text) == 1024 * 1024
+        assert process.returncode != 0
+
+
+class TestNormalizedDigest:
+    """Test the streaming hash of whitespace-stripped output."""
+
+    def test_ignores_surrounding_whitespace_only(self):
+        assert normalized_digest("  1 2\n3\n\n") == normalized_digest("1 2\n3")
+        assert normalized_digest("1 2\n3") != normalized_digest("1  2\n3")
+
+    def test_chunking_does_not_matter(self):
+        text = "\n 10 20\n\n30   \n40\n  "
+        hasher = NormalizedHasher()
+        for chunk in ("\n ", "10", " 20\n", "\n", "30   \n", "4", "0\n  "):
+            hasher.update(chunk)
+
+        assert hasher.hexdigest() == normalized_digest(text)
+
+
+class TestFirstDifference:
+    """Test locating the first differing line."""
+
+    def test_differing_line(self):
+        difference = first_difference("1\n2\n5\n", "1\n2\n3\n")
+
+        assert difference["line"] == 3
+        assert (difference["expected"], difference["actual"]) == ("3", "5")
+
+    def test_missing_line(self):
+        difference = first_difference("1\n", "1\n2\n")
+
+        assert difference == {
+            "line": 2, "expected": "2", "actual": None, "expected_lines": 2, "actual_lines": 1,
+        }
+
+    def test_equal_outputs(self):
+        assert first_difference("1\n2", "1\n2\n") is None
+
+
+def test_retention_keeps_head_and_tail():
+    """Past the retention budget only the head and tail are kept; the digest covers everything."""
+    import io
+
+    text = "".join(f"{i}\n" for i in range(200000))
+    capture = OutputCapture(io.StringIO(text), retain=1000, hash_output=True).start()
+    capture.join(timeout=10)
+
+    assert not capture.complete
+    assert capture.size == len(text)
+    assert capture.digest == normalized_digest(text)
+    assert capture.text.startswith("0\n1\n")
+    assert capture.text.endswith("199999\n")
+    assert "characters omitted" in capture.text
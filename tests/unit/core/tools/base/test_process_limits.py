@@ -0,0 +1,163 @@
+"""
+Tests for core.tools.base.process_limits module
+
+Stack limit computation, the exec trampoline and preexec_fn applied in
+children, and VmStk sampling.
+"""
+
+import os
+import shutil
+import subprocess
+import sys
+from unittest.mock import patch
+
+import pytest
+
+from src.app.core.tools.base import alloc_profiler, process_limits
+from src.app.core.tools.base.process_limits import (
+    effective_stack_limit,
+    ensure_launcher_built,
+    launcher_prefix,
+    read_stack_kb,
+    stack_limit_kb,
+    stack_limit_prefix,
+    stack_limit_preexec,
+    stack_limit_supported,
+)
+
+requires_rlimit = pytest.mark.skipif(not stack_limit_supported(), reason="Needs RLIMIT_STACK")
+MB = 1024 * 1024
+
+
+@requires_rlimit
+class TestEffectiveStackLimit:
+    """Test capping of requested limits."""
+
+    def test_capped_at_hard_limit(self):
+        """A request above the hard limit gets the hard limit."""
+        with patch.object(process_limits.resource, "getrlimit", return_value=(8 * MB, 64 * MB)):
+            assert effective_stack_limit(256) == 64 * MB
+            assert effective_stack_limit(32) == 32 * MB
+
+    def test_unlimited_request(self):
+        """0 means unlimited, or the hard limit if that is finite."""
+        infinity = process_limits.resource.RLIM_INFINITY
+        with patch.object(process_limits.resource, "getrlimit", return_value=(8 * MB, infinity)):
+            assert effective_stack_limit(0) == infinity
+            assert stack_limit_kb(0) is None
+        with patch.object(process_limits.resource, "getrlimit", return_value=(8 * MB, 64 * MB)):
+            assert stack_limit_kb(0) == 64 * 1024
+
+    def test_unsupported_platform(self):
+        """Without the resource module nothing is limited."""
+        with patch.object(process_limits, "resource", None):
+            assert effective_stack_limit(256) is None
+            assert stack_limit_preexec(256) is None
+
+
+@requires_rlimit
+class TestStackLimitPreexec:
+    """Test the limit in a real child process."""
+
+    def test_child_gets_limit(self):
+        """The child sees the requested soft limit."""
+        limit_mb = 16
+        _, hard = process_limits.resource.getrlimit(process_limits.resource.RLIMIT_STACK)
+        if hard != process_limits.resource.RLIM_INFINITY and hard < limit_mb * MB:
+            pytest.skip("Hard stack limit too low")
+
+        result = subprocess.run(
+            [sys.executable, "-c", "import resource; print(resource.getrlimit(resource.RLIMIT_STACK)[0])"],
+            stdout=subprocess.PIPE,
+            text=True,
+            preexec_fn=stack_limit_preexec(limit_mb),
+        )
+
+        assert int(result.stdout) == limit_mb * MB
+
+    @pytest.mark.skipif(shutil.which("g++") is None, reason="Needs g++")
+    def test_child_gets_limit_through_launcher(self, tmp_path, monkeypatch):
+        """The trampoline sets the limit and execs the command in place."""
+        limit_mb = 16
+        _, hard = process_limits.resource.getrlimit(process_limits.resource.RLIMIT_STACK)
+        if hard != process_limits.resource.RLIM_INFINITY and hard < limit_mb * MB:
+            pytest.skip("Hard stack limit too low")
+        monkeypatch.setattr(alloc_profiler, "PROFILER_CACHE_DIR", str(tmp_path / "cache"))
+
+        launcher = ensure_launcher_built()
+        assert launcher is not None
+        process = subprocess.Popen(
+            stack_limit_prefix(limit_mb, launcher)
+            + [sys.executable, "-c", "import os, resource; print(os.getpid(), resource.getrlimit(resource.RLIMIT_STACK)[0])"],
+            stdout=subprocess.PIPE,
+            text=True,
+        )
+        pid, limit = process.communicate()[0].split()
+
+        assert int(pid) == process.pid
+        assert int(limit) == limit_mb * MB
+
+    @pytest.mark.skipif(shutil.which("g++") is None, reason="Needs g++")
+    def test_launcher_disables_thp_on_request(self, tmp_path, monkeypatch):
+        """CTS_THP_DISABLE turns off huge pages for the command and is not passed on."""
+        with open("/proc/self/status", encoding="ascii") as f:
+            if "THP_enabled" not in f.read():
+                pytest.skip("Kernel does not report THP_enabled")
+        monkeypatch.setattr(alloc_profiler, "PROFILER_CACHE_DIR", str(tmp_path / "cache"))
+
+        result = subprocess.run(
+            stack_limit_prefix(16, ensure_launcher_built())
+            + [sys.executable, "-c",
+               "import os; print(os.environ.get('CTS_THP_DISABLE'));"
+               "print([l for l in open('/proc/self/status') if l.startswith('THP_enabled')][0].split()[1])"],
+            stdout=subprocess.PIPE,
+            text=True,
+            env={**os.environ, "CTS_THP_DISABLE": "1"},
+        )
+
+        assert result.stdout.split() == ["None", "0"]
+
+    @pytest.mark.skipif(
+        shutil.which("g++") is None or not hasattr(os, "sched_getaffinity"), reason="Needs g++ and affinity"
+    )
+    def test_launcher_pins_cpu_and_keeps_stack_limit(self, tmp_path, monkeypatch):
+        """CTS_CPU_LIST pins the command; '-' leaves the inherited stack limit."""
+        monkeypatch.setattr(alloc_profiler, "PROFILER_CACHE_DIR", str(tmp_path / "cache"))
+        cpu = min(os.sched_getaffinity(0))
+
+        result = subprocess.run(
+            launcher_prefix(ensure_launcher_built())
+            + [sys.executable, "-c",
+               "import os, resource; print(os.environ.get('CTS_CPU_LIST'), sorted(os.sched_getaffinity(0))[0],"
+               " len(os.sched_getaffinity(0)), resource.getrlimit(resource.RLIMIT_STACK)[0])"],
+            stdout=subprocess.PIPE,
+            text=True,
+            env={**os.environ, "CTS_CPU_LIST": str(cpu)},
+        )
+
+        soft, _ = process_limits.resource.getrlimit(process_limits.resource.RLIMIT_STACK)
+        assert result.stdout.split() == ["None", str(cpu), "1", str(soft)]
+
+    @pytest.mark.skipif(shutil.which("g++") is None, reason="Needs g++")
+    def test_launcher_reports_missing_command(self, tmp_path, monkeypatch):
+        monkeypatch.setattr(alloc_profiler, "PROFILER_CACHE_DIR", str(tmp_path / "cache"))
+
+        result = subprocess.run(
+            stack_limit_prefix(16, ensure_launcher_built()) + [str(tmp_path / "missing")],
+            stderr=subprocess.PIPE,
+            text=True,
+        )
+
+        assert result.returncode == 127
+        assert "missing" in result.stderr
+
+
+class TestReadStackKb:
+    """Test VmStk sampling."""
+
+    @pytest.mark.skipif(not sys.platform.startswith("linux"), reason="Needs /proc")
+    def test_reads_own_stack(self):
+        assert read_stack_kb(os.getpid()) > 0
+
+    def test_missing_process(self):
+        assert read_stack_kb(2**31 - 1) is None
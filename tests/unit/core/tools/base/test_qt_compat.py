@@ -0,0 +1,106 @@
+"""
+Tests for core.tools.base.qt_compat module
+
+The pure-Python Signal, QObject and QThread used when running headless.
+"""
+
+import importlib.util
+import os
+import threading
+from unittest.mock import patch
+
+import pytest
+
+import src.app.core.tools.base.qt_compat as qt_compat_module
+
+
+@pytest.fixture(scope="module")
+def qt():
+    """The module loaded in headless mode, whether or not PySide6 is installed."""
+    spec = importlib.util.spec_from_file_location("qt_compat_headless", qt_compat_module.__file__)
+    module = importlib.util.module_from_spec(spec)
+    with patch.dict(os.environ, {"CTS_HEADLESS": "1"}):
+        spec.loader.exec_module(module)
+    return module
+
+
+def make_emitter(qt):
+    class Emitter(qt.QObject):
+        changed = qt.Signal(int, str)
+
+    return Emitter
+
+
+class TestSignal:
+    """Test the stand-in signal."""
+
+    def test_headless_mode(self, qt):
+        assert qt.HEADLESS
+
+    def test_emit_calls_connected_slots(self, qt):
+        emitter = make_emitter(qt)()
+        received = []
+        emitter.changed.connect(lambda number, text: received.append((number, text)))
+
+        emitter.changed.emit(1, "a")
+
+        assert received == [(1, "a")]
+
+    def test_slots_taking_fewer_arguments_get_the_leading_ones(self, qt):
+        emitter = make_emitter(qt)()
+        received = []
+        emitter.changed.connect(lambda number: received.append(number))
+        emitter.changed.connect(lambda *args: received.append(args))
+
+        emitter.changed.emit(2, "b")
+
+        assert received == [2, (2, "b")]
+
+    def test_signal_to_signal_connection(self, qt):
+        source, target = make_emitter(qt)(), make_emitter(qt)()
+        received = []
+        source.changed.connect(target.changed)
+        target.changed.connect(lambda number, text: received.append(text))
+
+        source.changed.emit(3, "c")
+
+        assert received == ["c"]
+
+    def test_instances_have_separate_connections(self, qt):
+        first, second = make_emitter(qt)(), make_emitter(qt)()
+        received = []
+        first.changed.connect(lambda number, text: received.append(number))
+
+        second.changed.emit(4, "d")
+
+        assert received == []
+
+    def test_disconnect(self, qt):
+        emitter = make_emitter(qt)()
+        received = []
+        slot = lambda number, text: received.append(number)  # noqa: E731
+        emitter.changed.connect(slot)
+
+        emitter.changed.disconnect(slot)
+        emitter.changed.emit(5, "e")
+
+        assert received == []
+        with pytest.raises(RuntimeError):
+            emitter.changed.disconnect(slot)
+
+
+class TestQThread:
+    """Test the stand-in thread."""
+
+    def test_start_emits_started_then_finished_off_the_caller_thread(self, qt):
+        thread = qt.QThread()
+        events = []
+        thread.started.connect(lambda: events.append(("started", threading.current_thread())))
+        thread.finished.connect(lambda: events.append(("finished", threading.current_thread())))
+
+        thread.start()
+
+        assert thread.wait(5000)
+        assert [name for name, _ in events] == ["started", "finished"]
+        assert events[0][1] is not threading.current_thread()
+        assert not thread.isRunning()
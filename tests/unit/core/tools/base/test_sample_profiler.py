@@ -0,0 +1,198 @@
+"""
+Tests for core.tools.base.sample_profiler module
+
+Stack folding and rankings use synthetic reports; one test builds the
+sampler and profiles a real program when g++ is available.
+"""
+
+import json
+import shutil
+import subprocess
+import zlib
+
+import pytest
+
+from src.app.core.tools.base import alloc_profiler
+from src.app.core.tools.base.sample_profiler import (
+    PROFILE_BUILD_FLAGS,
+    collapsed_text,
+    ensure_sampler_built,
+    read_profile,
+    sampler_environment,
+    sampling_profiler_supported,
+    summarize_profiles,
+)
+
+EXE = "/work/test_profiled"
+LIBC = "/lib/libc.so.6"
+
+
+def write_report(tmp_path, stacks, samples=None):
+    report = {
+        "schema": 1,
+        "hz": 1000,
+        "samples": samples if samples is not None else sum(s["count"] for s in stacks),
+        "dropped": 0,
+        "stacks": stacks,
+        "modules": [EXE, LIBC],
+    }
+    path = tmp_path / "profile.json"
+    path.write_text(json.dumps(report))
+    return str(path)
+
+
+def stack(count, *symbols):
+    """Frames innermost first; symbols of the form 'module:name'."""
+    frames = []
+    for i, symbol in enumerate(symbols):
+        module, name = symbol.split(":")
+        offset = zlib.crc32(name.encode()) % 100000 * 100 + i
+        frames.append([int(module), offset, offset, name])
+    return {"count": count, "frames": frames}
+
+
+class TestReadProfile:
+    """Test folding reports into collapsed stacks."""
+
+    def test_missing_report(self, tmp_path):
+        """Killed or static processes have no profile."""
+        assert read_profile(str(tmp_path / "missing.json")) is None
+
+    def test_folds_stacks_root_first(self, tmp_path):
+        """Collapsed stacks start at main() and drop the libc startup frames."""
+        path = write_report(
+            tmp_path,
+            [
+                stack(30, "0:dfs", "0:solve", "0:main", "1:__libc_start_call_main"),
+                stack(10, "0:solve", "0:main", "1:__libc_start_call_main"),
+            ],
+        )
+
+        profile = read_profile(path, symbolize=False)
+
+        assert profile["collapsed"] == [["main;solve;dfs", 30], ["main;solve", 10]]
+        assert profile["samples"] == 40
+        assert profile["sampled_cpu_time"] == pytest.approx(0.04)
+
+    def test_merges_identical_folded_stacks(self, tmp_path):
+        """Stacks differing only in return addresses fold together."""
+        path = write_report(
+            tmp_path,
+            [stack(5, "0:dfs", "0:main"), {"count": 7, "frames": [[0, 900, 900, "dfs"], [0, 901, 901, "main"]]}],
+        )
+
+        profile = read_profile(path, symbolize=False)
+
+        assert profile["collapsed"] == [["main;dfs", 12]]
+
+    def test_cuts_frames_outside_modules(self, tmp_path):
+        """Frames after one without a module are garbage from code without frame pointers."""
+        path = write_report(
+            tmp_path,
+            [{"count": 3, "frames": [[0, 1, 1, "dfs"], [-1, 5, 5, ""], [0, 2, 2, "main"]]}],
+        )
+
+        profile = read_profile(path, symbolize=False)
+
+        assert profile["collapsed"] == [["dfs", 3]]
+
+    def test_self_and_total_rankings(self, tmp_path):
+        """Self time counts leaves, total time counts every function once per stack."""
+        path = write_report(
+            tmp_path,
+            [
+                stack(60, "0:dfs", "0:dfs", "0:main"),
+                stack(40, "0:sort", "0:main"),
+            ],
+        )
+
+        profile = read_profile(path, symbolize=False)
+
+        assert profile["top_self"][0] == {"function": "dfs", "samples": 60, "percent": 60.0}
+        totals = {entry["function"]: entry["samples"] for entry in profile["top_total"]}
+        assert totals == {"main": 100, "dfs": 60, "sort": 40}
+
+    def test_unnamed_frames_use_module_offset(self, tmp_path):
+        """Frames without symbols are named by module and offset."""
+        path = write_report(tmp_path, [{"count": 1, "frames": [[0, 255, 255, ""]]}])
+
+        profile = read_profile(path, symbolize=False)
+
+        assert profile["collapsed"] == [["test_profiled+0xff", 1]]
+
+    def test_collapsed_text(self, tmp_path):
+        """Collapsed text is one 'stack count' line per stack."""
+        path = write_report(tmp_path, [stack(2, "0:b", "0:a")])
+
+        assert collapsed_text(read_profile(path, symbolize=False)) == "a;b 2\n"
+
+
+class TestSummarizeProfiles:
+    """Test the benchmark analysis summary."""
+
+    def test_no_profiles(self):
+        assert summarize_profiles([{"test_number": 1}]) is None
+
+    def test_lists_profiled_tests_slowest_first(self):
+        profile = {"samples": 10, "top_self": [{"function": "f", "samples": 10, "percent": 100.0}]}
+        summary = summarize_profiles(
+            [
+                {"test_number": 1, "execution_time": 0.1, "profile": profile},
+                {"test_number": 2, "execution_time": 0.5, "profile": {"error": "no samples"}},
+                {"test_number": 3, "execution_time": 0.9},
+            ]
+        )
+
+        tests = summary["profiled_tests"]
+        assert [t["test_number"] for t in tests] == [2, 1]
+        assert tests[0]["error"] == "no samples"
+        assert tests[1]["top_self"][0]["function"] == "f"
+
+
+def test_sampler_environment_extends_preload():
+    env = sampler_environment("/cache/libcts_prof.so", "/tmp/p.json", hz=500, base_env={"LD_PRELOAD": "x.so"})
+
+    assert env["LD_PRELOAD"] == "/cache/libcts_prof.so:x.so"
+    assert env["CTS_PROF_REPORT"] == "/tmp/p.json"
+    assert env["CTS_PROF_HZ"] == "500"
+
+
+@pytest.mark.skipif(
+    not sampling_profiler_supported() or shutil.which("g++") is None,
+    reason="Needs Linux (x86-64/AArch64) and g++",
+)
+class TestSampler:
+    """Build the sampler and profile a real program."""
+
+    def test_profiles_hot_function(self, tmp_path, monkeypatch):
+        monkeypatch.setattr(alloc_profiler, "PROFILER_CACHE_DIR", str(tmp_path / "cache"))
+        library = ensure_sampler_built("g++")
+        assert library is not None
+
+        source = tmp_path / "solution.cpp"
+        source.write_text(
+            "#include <cstdio>\n"
+            "__attribute__((noinline)) long long spin(long long n) {\n"
+            "  long long s = 0; for (long long i = 0; i < n; ++i) s += i % 7 * (i ^ s); return s; }\n"
+            "int main() { long long n; if (std::scanf(\"%lld\", &n) != 1) return 1;"
+            " std::printf(\"%lld\\n\", spin(n)); }\n"
+        )
+        executable = tmp_path / "solution"
+        subprocess.run(
+            ["g++", "-O2", *PROFILE_BUILD_FLAGS, "-o", str(executable), str(source)], check=True
+        )
+
+        report_path = str(tmp_path / "profile.json")
+        result = subprocess.run(
+            [str(executable)],
+            input="300000000\n",
+            env=sampler_environment(library, report_path),
+            stdout=subprocess.PIPE,
+            text=True,
+        )
+
+        assert result.returncode == 0
+        profile = read_profile(report_path)
+        assert profile["samples"] >= 20
+        assert profile["top_self"][0]["function"].startswith("spin")
+        assert any(stack.startswith("main;spin") for stack, _ in profile["collapsed"])
@@ -0,0 +1,82 @@
+"""
+Tests for core.tools.base.seeds module
+
+Per-test seed derivation and seed-based sampling used for reproducible
+generator inputs and tiered sanitizer replays.
+"""
+
+import pytest
+
+from src.app.core.tools.base.seeds import (
+    SEED_ENV_VAR,
+    derive_test_seed,
+    generator_environment,
+    is_sampled,
+    new_run_seed,
+    seed_fraction,
+    splitmix64,
+)
+
+
+class TestSeedDerivation:
+    """Test seed derivation from run seed and test number."""
+
+    def test_splitmix64_known_value(self):
+        """Should match the reference SplitMix64 output for seed 0."""
+        assert splitmix64(0) == 0xE220A8397B1DCDAF
+
+    def test_derive_test_seed_is_deterministic(self):
+        """Same run seed and test number should give the same seed."""
+        assert derive_test_seed(1234, 7) == derive_test_seed(1234, 7)
+
+    def test_derive_test_seed_differs_per_test(self):
+        """Different tests of one run should get distinct seeds."""
+        seeds = {derive_test_seed(99, n) for n in range(1, 1001)}
+        assert len(seeds) == 1000
+
+    def test_derive_test_seed_fits_64_bits(self):
+        """Seeds should fit into an unsigned 64-bit integer."""
+        for n in range(1, 100):
+            assert 0 <= derive_test_seed(2**64 - 1, n) < 2**64
+
+    def test_new_run_seed_fits_64_bits(self):
+        """Fresh run seeds should be 64-bit values."""
+        assert 0 <= new_run_seed() < 2**64
+
+
+class TestSeedSampling:
+    """Test deterministic seed-based sampling."""
+
+    def test_seed_fraction_in_unit_interval(self):
+        """Fractions should lie in [0, 1)."""
+        for n in range(1, 200):
+            assert 0.0 <= seed_fraction(derive_test_seed(5, n)) < 1.0
+
+    @pytest.mark.parametrize("rate", [0.0, -1.0])
+    def test_zero_rate_never_samples(self, rate):
+        """Non-positive rates should select nothing."""
+        assert not any(is_sampled(derive_test_seed(1, n), rate) for n in range(1, 100))
+
+    def test_full_rate_always_samples(self):
+        """Rate 1.0 should select everything."""
+        assert all(is_sampled(derive_test_seed(1, n), 1.0) for n in range(1, 100))
+
+    def test_sample_rate_is_approximately_respected(self):
+        """About `rate` of all tests should be selected."""
+        selected = sum(is_sampled(derive_test_seed(42, n), 0.1) for n in range(1, 10001))
+        assert 800 < selected < 1200
+
+
+class TestGeneratorEnvironment:
+    """Test environment construction for generator processes."""
+
+    def test_exports_seed(self):
+        """Should export the seed as CTS_SEED."""
+        env = generator_environment(123, {"PATH": "/bin"})
+        assert env == {"PATH": "/bin", SEED_ENV_VAR: "123"}
+
+    def test_does_not_modify_base_env(self):
+        """Should copy the base environment."""
+        base = {"PATH": "/bin"}
+        generator_environment(1, base)
+        assert base == {"PATH": "/bin"}
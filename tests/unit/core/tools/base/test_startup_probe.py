@@ -0,0 +1,60 @@
+"""
+Tests for core.tools.base.startup_probe module
+
+Startup timing of real processes and ELF linkage detection on synthetic headers.
+"""
+
+import struct
+import sys
+
+from src.app.core.tools.base.startup_probe import is_dynamic_executable, measure_startup
+
+
+def _elf64(segment_types):
+    """Minimal little-endian ELF64 header followed by its program headers."""
+    header = bytearray(64)
+    header[:6] = b"\x7fELF\x02\x01"
+    struct.pack_into("<Q", header, 32, 64)
+    struct.pack_into("<HH", header, 54, 56, len(segment_types))
+    table = b"".join(struct.pack("<I", t) + bytes(52) for t in segment_types)
+    return bytes(header) + table
+
+
+class TestMeasureStartup:
+    """Test timing of empty-input runs."""
+
+    def test_reports_fastest_run(self):
+        probe = measure_startup([sys.executable, "-c", "import sys; sys.stdin.read()"], runs=3)
+
+        assert probe["runs"] == 3
+        assert 0 < probe["min_seconds"] <= probe["median_seconds"]
+        assert probe["exit_code"] == 0
+
+    def test_program_waiting_past_timeout(self):
+        assert measure_startup([sys.executable, "-c", "import time; time.sleep(5)"], runs=1, timeout=0.2) is None
+
+    def test_missing_command(self, tmp_path):
+        assert measure_startup([str(tmp_path / "missing")]) is None
+
+
+class TestIsDynamicExecutable:
+    """Test PT_INTERP detection."""
+
+    def test_interpreter_segment(self, tmp_path):
+        path = tmp_path / "dynamic"
+        path.write_bytes(_elf64([6, 3, 1]))
+
+        assert is_dynamic_executable(str(path)) is True
+
+    def test_static_executable(self, tmp_path):
+        path = tmp_path / "static"
+        path.write_bytes(_elf64([1, 1, 4]))
+
+        assert is_dynamic_executable(str(path)) is False
+
+    def test_not_elf(self, tmp_path):
+        path = tmp_path / "script.py"
+        path.write_text("print(1)\n" * 10)
+
+        assert is_dynamic_executable(str(path)) is None
+        assert is_dynamic_executable(str(tmp_path / "missing")) is None
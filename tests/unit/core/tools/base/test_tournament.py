@@ -0,0 +1,139 @@
+"""
+Tests for core.tools.base.tournament module
+
+Significance tests are checked against tabulated Wilcoxon probabilities;
+rankings use synthetic tournament results.
+"""
+
+import pytest
+
+from src.app.core.tools.base.tournament import (
+    SIGNIFICANCE_LEVEL,
+    is_timed,
+    summarize_tournament,
+    wilcoxon_signed_rank,
+)
+
+
+class TestWilcoxon:
+    """Test the signed-rank test."""
+
+    def test_exact_probabilities(self):
+        # All of n differences positive: p = 2 / 2^n
+        assert wilcoxon_signed_rank([1, 2, 3, 4, 5], [0] * 5)["p_value"] == pytest.approx(0.0625)
+        assert wilcoxon_signed_rank([1, 2, 3, 4, 5, 6], [0] * 6)["p_value"] == pytest.approx(0.03125)
+
+    def test_mixed_signs(self):
+        result = wilcoxon_signed_rank([1, -2, 3, -4, 5, 6], [0] * 6)
+
+        assert result["statistic"] == 15
+        assert result["p_value"] == pytest.approx(0.4375)
+
+    def test_zero_differences_are_dropped(self):
+        result = wilcoxon_signed_rank([1, 2, 3], [1, 2, 3])
+
+        assert result["pairs"] == 0
+        assert result["p_value"] == 1.0
+
+    def test_ties_get_average_ranks(self):
+        result = wilcoxon_signed_rank([1, 1, 2, 2], [0, 0, 0, 0])
+
+        assert result["statistic"] == 10
+        assert result["p_value"] == pytest.approx(0.125)
+
+    def test_normal_approximation_for_many_pairs(self):
+        first = [float(i) for i in range(100)]
+        second = [x + 0.5 + (i % 7) * 0.01 for i, x in enumerate(first)]
+
+        result = wilcoxon_signed_rank(second, first)
+
+        assert result["method"] == "normal"
+        assert result["p_value"] < 1e-10
+
+
+def _entry(time, memory=10.0, position=0, passed=True, error="Accepted", output_hash="h"):
+    return {
+        "execution_time": time,
+        "memory_used": memory,
+        "position": position,
+        "passed": passed,
+        "error_details": error,
+        "output_hash": output_hash,
+    }
+
+
+class TestSummarizeTournament:
+    """Test the ranking of a tournament run."""
+
+    LABELS = {"test": "test.cpp", "solution_1": "fast.cpp", "solution_2": "slow.cpp"}
+
+    def _results(self, count=8):
+        return [
+            {
+                "test_number": n,
+                "tournament": {
+                    "test": _entry(0.10 + n * 0.01, memory=20.0, position=n % 3),
+                    "solution_1": _entry(0.05 + n * 0.01, memory=30.0, position=(n + 1) % 3),
+                    "solution_2": _entry(0.30 + n * 0.01, memory=20.0, position=(n + 2) % 3),
+                },
+            }
+            for n in range(1, count + 1)
+        ]
+
+    def test_without_tournament_results(self):
+        assert summarize_tournament([{"test_number": 1}], self.LABELS) is None
+
+    def test_ranks_by_median_time(self):
+        summary = summarize_tournament(self._results(), self.LABELS)
+
+        ranking = summary["ranking"]
+        assert [s["label"] for s in ranking] == ["fast.cpp", "test.cpp", "slow.cpp"]
+        assert [s["rank"] for s in ranking] == [1, 2, 3]
+        assert ranking[0]["wins"] == 8
+        assert ranking[0]["max_memory"] == 30.0
+        assert summary["compared_tests"] == 8
+
+    def test_consistent_differences_are_significant(self):
+        summary = summarize_tournament(self._results(), self.LABELS)
+
+        first = summary["comparisons"][0]
+        assert (first["faster"], first["slower"]) == ("solution_1", "test")
+        assert first["time_p_value"] < SIGNIFICANCE_LEVEL
+        assert first["time_significant"] is True
+        # The faster solution uses more memory on every test
+        assert first["memory_difference_mb"] == -10.0
+        assert first["memory_significant"] is True
+        # Neighbours, then the fastest against the rest
+        assert [(c["faster"], c["slower"]) for c in summary["comparisons"]] == [
+            ("solution_1", "test"), ("test", "solution_2"), ("solution_1", "solution_2"),
+        ]
+
+    def test_crashed_tests_are_not_compared(self):
+        results = self._results()
+        results[0]["tournament"]["solution_2"] = _entry(
+            0.0, passed=False, error="Test solution failed with exit code 1: "
+        )
+
+        summary = summarize_tournament(results, self.LABELS)
+
+        assert summary["compared_tests"] == 7
+        slow = next(s for s in summary["ranking"] if s["key"] == "solution_2")
+        assert slow["failed"] == 1
+
+    def test_reports_output_disagreements(self):
+        results = self._results(3)
+        results[1]["tournament"]["solution_2"]["output_hash"] = "other"
+
+        summary = summarize_tournament(results, self.LABELS)
+
+        assert summary["output_disagreements"] == [2]
+
+    def test_position_effect(self):
+        summary = summarize_tournament(self._results(), self.LABELS)
+
+        assert set(summary["position_effect"]) == {"0", "1", "2"}
+
+
+def test_killed_runs_are_timed_at_the_limit():
+    assert is_timed({"error_details": "Time Limit Exceeded (1.00s)"})
+    assert not is_timed({"error_details": "Output Limit Exceeded (>64MB)"})
@@ -0,0 +1,103 @@
+"""
+Tests for core.tools.base.warm_java_pool module
+
+The JVM side is replaced by a small Python script speaking the WarmRunner
+control protocol, so the pool's pipe handling and bookkeeping run for real.
+"""
+
+import subprocess
+import sys
+import textwrap
+
+import pytest
+
+from src.app.core.tools.base.warm_java_pool import WarmJvmPool, warm_jvm_supported
+
+pytestmark = pytest.mark.skipif(not warm_jvm_supported(), reason="named pipes required")
+
+FAKE_RUNNER = textwrap.dedent(
+    """
+    import sys
+
+    print("READY", flush=True)
+    invocation = 0
+    for line in sys.stdin:
+        parts = line.rstrip("\\n").split("\\t")
+        invocation += 1
+        stdin = open(parts[1])
+        stdout = open(parts[2], "w")
+        stderr = open(parts[3], "w")
+        print("STARTED", flush=True)
+        data = stdin.read()
+        if data.strip() == "exit":
+            sys.exit(3)
+        stdout.write(f"seed={parts[4]} args={parts[5:]} input={data}")
+        stderr.write("log")
+        for stream in (stdin, stdout, stderr):
+            stream.close()
+        print(f"DONE\\t0\\t{invocation * 1000000}\\t{invocation}", flush=True)
+    """
+)
+
+
+@pytest.fixture
+def pool(tmp_path):
+    runner = tmp_path / "fake_runner.py"
+    runner.write_text(FAKE_RUNNER)
+    pool = WarmJvmPool(
+        ["java", "-cp", str(tmp_path), "Test"],
+        size=1,
+        runner_command=[sys.executable, str(runner)],
+        startup_timeout=10,
+    )
+    assert pool.start()
+    yield pool
+    pool.close()
+
+
+class TestWarmJvmPool:
+    """Test test execution through the persistent runner protocol."""
+
+    def test_runs_test_with_input_and_seed(self, pool):
+        """Should pass input, seed and args and collect both output streams."""
+        process = pool.spawn(stdin=subprocess.PIPE, env={"CTS_SEED": "42"}, args=["a"])
+
+        stdout, stderr = process.communicate("1 2\n", timeout=10)
+
+        assert stdout == "seed=42 args=['a'] input=1 2\n"
+        assert stderr == "log"
+        assert process.returncode == 0
+
+    def test_reports_cold_then_warm_invocations(self, pool):
+        """First run of a JVM is cold, later runs are warm."""
+        timings = []
+        for _ in range(2):
+            process = pool.spawn(stdin=subprocess.PIPE)
+            process.communicate("x", timeout=10)
+            timings.append(process.warm_timing)
+
+        assert [t["cold"] for t in timings] == [True, False]
+        assert timings[1]["main_time"] == pytest.approx(0.002)
+        assert timings[0]["jvm_startup_time"] > 0
+
+    def test_exit_ends_jvm_and_pool_recovers(self, pool):
+        """An exiting main() should report its code and get a fresh JVM next time."""
+        process = pool.spawn(stdin=subprocess.PIPE)
+        process.communicate("exit", timeout=10)
+        assert process.returncode == 3
+        assert process.warm_timing is None
+
+        process = pool.spawn(stdin=subprocess.PIPE)
+        stdout, _ = process.communicate("y", timeout=10)
+        assert stdout.endswith("input=y")
+        assert process.warm_timing["cold"]
+
+    def test_runner_start_failure(self, tmp_path):
+        """Should report failure when the runner never becomes ready."""
+        pool = WarmJvmPool(
+            ["java", "-cp", str(tmp_path), "Test"],
+            runner_command=[sys.executable, "-c", "pass"],
+            startup_timeout=5,
+        )
+
+        assert not pool.start()
@@ -0,0 +1,107 @@
+"""
+Tests for core.tools.base.warm_python_pool module
+
+Warm interpreters fork a pre-compiled Python solution per test. These tests
+run a real fork server, so they are skipped where fork() is unavailable.
+"""
+
+import subprocess
+import sys
+
+import pytest
+
+from src.app.core.tools.base.warm_python_pool import (
+    WarmInterpreter,
+    warm_pool_supported,
+)
+
+pytestmark = pytest.mark.skipif(
+    not warm_pool_supported(), reason="warm interpreters need fork() and Unix sockets"
+)
+
+SOLUTION = """
+import os
+import sys
+
+n = int(sys.stdin.readline())
+print(n * n, os.environ.get("CTS_SEED"), sys.argv[1:])
+if n == 7:
+    raise ValueError("boom")
+if n == 8:
+    sys.exit(3)
+"""
+
+
+@pytest.fixture
+def warm(tmp_path):
+    source = tmp_path / "solution.py"
+    source.write_text(SOLUTION)
+    interpreter = WarmInterpreter([sys.executable, "-u", str(source)])
+    assert interpreter.start()
+    yield interpreter
+    interpreter.close()
+
+
+class TestWarmInterpreter:
+    """Test forking solutions from a warm interpreter."""
+
+    def test_runs_solution_with_redirected_stdio(self, warm):
+        """Child should read stdin and write stdout through the pipes."""
+        process = warm.spawn(stdin=subprocess.PIPE, env={"CTS_SEED": "42"})
+
+        stdout, stderr = process.communicate("3\n", timeout=10)
+
+        assert stdout == "9 42 []\n"
+        assert stderr == ""
+        assert process.returncode == 0
+
+    def test_passes_extra_arguments(self, warm):
+        """Extra arguments should end up in sys.argv."""
+        process = warm.spawn(stdin=subprocess.PIPE, args=["in.txt", "out.txt"])
+
+        stdout, _ = process.communicate("2\n", timeout=10)
+
+        assert stdout.split(" ", 2)[2] == "['in.txt', 'out.txt']\n"
+
+    def test_uncaught_exception_exit_code(self, warm):
+        """Uncaught exceptions should print a traceback and exit with 1."""
+        process = warm.spawn(stdin=subprocess.PIPE)
+
+        _, stderr = process.communicate("7\n", timeout=10)
+
+        assert process.returncode == 1
+        assert "ValueError: boom" in stderr
+
+    def test_sys_exit_code(self, warm):
+        """sys.exit() codes should be reported."""
+        process = warm.spawn(stdin=subprocess.PIPE)
+
+        process.communicate("8\n", timeout=10)
+
+        assert process.returncode == 3
+
+    def test_kill_reports_signal(self, warm):
+        """Killed children should report -SIGKILL like Popen."""
+        process = warm.spawn(stdin=subprocess.PIPE)
+
+        process.kill()
+
+        assert process.wait(timeout=10) == -9
+
+    def test_wait_timeout(self, warm):
+        """wait() should time out while the child is blocked on stdin."""
+        process = warm.spawn(stdin=subprocess.PIPE)
+
+        with pytest.raises(subprocess.TimeoutExpired):
+            process.wait(timeout=0.05)
+        process.kill()
+        process.wait(timeout=10)
+
+    def test_start_fails_for_syntax_error(self, tmp_path):
+        """A broken solution should make start() fail so callers fall back."""
+        source = tmp_path / "broken.py"
+        source.write_text("def (:\n")
+        interpreter = WarmInterpreter([sys.executable, str(source)])
+
+        assert interpreter.start() is False
+        assert interpreter.is_running is False
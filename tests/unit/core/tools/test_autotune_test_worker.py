@@ -0,0 +1,42 @@
+"""
+Unit tests for AutotuneTestWorker.
+
+Candidates are small Python programs run as real processes; a sleeping
+candidate stands in for a slow flag set.
+"""
+
+import sys
+
+from src.app.core.tools.specialized.autotune_test_worker import AutotuneTestWorker
+
+FAST = "print(input())"
+SLOW = "import time; time.sleep(0.15); print(input())"
+
+
+def test_slow_candidates_are_eliminated(temp_workspace):
+    solutions = {"test": FAST, "fast": FAST, "slow": SLOW, "wrong": "input(); print(0)"}
+    commands = {"generator": [sys.executable, "-c", "print(3)"]}
+    commands.update({key: [sys.executable, "-c", code] for key, code in solutions.items()})
+    worker = AutotuneTestWorker(
+        str(temp_workspace),
+        {},
+        time_limit=5000,
+        memory_limit=1024,
+        test_count=4,
+        max_workers=1,
+        execution_commands=commands,
+        solutions={key: key for key in solutions},
+    )
+    worker.is_running = True
+
+    worker._execute_tests(worker._run_single_test)
+
+    rounds = worker.autotune_rounds
+    assert [r["tests"] for r in rounds] == [3, 4]
+    assert set(rounds[0]["eliminated"]) == {"slow", "wrong"}
+    assert rounds[1]["candidates"] == ["fast"]
+    # Test numbers continue across rounds; only survivors run later inputs
+    results = sorted(worker.get_test_results(), key=lambda r: r["test_number"])
+    assert [r["test_number"] for r in results] == [1, 2, 3, 4]
+    assert set(results[-1]["tournament"]) == {"test", "fast"}
+    assert worker.solutions == {key: key for key in solutions}
@@ -9,6 +9,7 @@ Tests verify time limit enforcement, memory limit tracking, parallel execution,
 signal emission, and performance metrics collection.
 """
 
+import io
 import os
 from subprocess import TimeoutExpired
 from unittest.mock import MagicMock, Mock, patch
@@ -16,6 +17,7 @@ from unittest.mock import MagicMock, Mock, patch
 import pytest
 from PySide6.QtCore import QObject
 
+from src.app.core.tools.base.warm_java_pool import WarmJavaProcess
 from src.app.core.tools.specialized.benchmark_test_worker import BenchmarkTestWorker
 
 
@@ -183,6 +185,64 @@ class TestBenchmarkWorkerExecution:
 
         assert result["memory_passed"] is False
 
+    @patch("psutil.Process")
+    def test_warm_jvm_memory_is_not_judged(self, mock_psutil, temp_workspace):
+        """A persistent JVM's RSS is shared by its tests and must not fail them."""
+        mock_psutil.return_value.memory_info.return_value = Mock(rss=300 * 1024 * 1024)
+        mock_psutil.return_value.cpu_times.return_value = Mock(user=0.01, system=0.0)
+
+        process = Mock(spec=WarmJavaProcess)
+        process.pid = 1002
+        process.returncode = 0
+        process.poll.return_value = 0
+        process.wait.return_value = 0
+        process.stdin = Mock()
+        process.stdout = io.StringIO("output\n")
+        process.stderr = io.StringIO("")
+        process.warm_timing = {"mode": "warm_jvm", "main_time": 0.01, "invocation": 2, "cold": False}
+
+        worker = BenchmarkTestWorker(
+            str(temp_workspace), {"generator": "", "test": ""}, time_limit=5000, memory_limit=256
+        )
+        with patch.object(worker, "_launch_process", return_value=process):
+            result = worker._measure_solution(1, "5\n", 0.0)
+
+        assert result["passed"] is True
+        assert result["memory_passed"] is True
+        assert result["memory_measured"] is False
+        assert result["memory_used"] == 0
+        mock_psutil.return_value.memory_info.assert_not_called()
+
+    @patch("psutil.Process")
+    def test_warm_jvm_is_judged_by_wall_time(self, mock_psutil, temp_workspace):
+        """The shared JVM's CPU time covers every test it ran and must not be used."""
+        mock_psutil.return_value.cpu_times.return_value = Mock(user=100.0, system=5.0)
+
+        process = Mock(spec=WarmJavaProcess)
+        process.pid = 1002
+        process.returncode = 0
+        process.poll.return_value = 0
+        process.wait.return_value = 0
+        process.stdin = Mock()
+        process.stdout = io.StringIO("output\n")
+        process.stderr = io.StringIO("")
+        process.warm_timing = {"mode": "warm_jvm", "main_time": 0.01, "invocation": 9, "cold": False}
+
+        worker = BenchmarkTestWorker(
+            str(temp_workspace),
+            {"generator": "", "test": ""},
+            time_limit=5000,
+            memory_limit=256,
+            timing_mode="cpu",
+        )
+        with patch.object(worker, "_launch_process", return_value=process):
+            result = worker._measure_solution(1, "5\n", 0.0)
+
+        assert result["passed"] is True
+        assert result["timing_source"] == "wall"
+        assert "cpu_time" not in result
+        mock_psutil.return_value.cpu_times.assert_not_called()
+
 
 class TestBenchmarkWorkerSignals:
     """Test signal emission during benchmarking."""
@@ -415,3 +475,258 @@ class TestBenchmarkWorkerResultStorage:
 
         new_results = worker.get_test_results()
         assert len(new_results) == original_len
+
+
+class TestBenchmarkWorkerResourceHistograms:
+    """Test incremental wall/CPU/RSS histograms."""
+
+    def _make_worker(self, temp_workspace):
+        return BenchmarkTestWorker(
+            str(temp_workspace), {"generator": "", "test": ""}, time_limit=1000, memory_limit=256
+        )
+
+    def test_completed_tests_are_recorded(self, temp_workspace):
+        """Each completed test should update the histograms."""
+        worker = self._make_worker(temp_workspace)
+        worker.testCompleted = MagicMock()
+
+        for number, (wall, cpu, mem) in enumerate([(0.01, 0.008, 10.0), (0.5, 0.45, 64.0)], 1):
+            worker._emit_test_completed(
+                {
+                    "test_name": f"Test {number}",
+                    "test_number": number,
+                    "passed": True,
+                    "execution_time": wall,
+                    "cpu_time": cpu,
+                    "memory_used": mem,
+                    "memory_passed": True,
+                }
+            )
+
+        histograms = worker.resource_histograms.histograms
+        assert histograms["wall_time_us"].total_count == 2
+        assert histograms["wall_time_us"].max_value == 500000
+        assert histograms["cpu_time_us"].min_value == 8000
+        assert histograms["peak_rss_kb"].max_value == 65536
+
+    def test_read_cpu_time_sums_user_and_system(self):
+        """CPU time should be user + system seconds."""
+        ps_process = MagicMock()
+        ps_process.cpu_times.return_value = MagicMock(user=0.25, system=0.05)
+
+        assert BenchmarkTestWorker._read_cpu_time(ps_process, 0.0) == pytest.approx(0.3)
+
+    def test_read_cpu_time_keeps_last_value_when_process_is_gone(self):
+        """A finished process should keep the last sampled CPU time."""
+        import psutil
+
+        ps_process = MagicMock()
+        ps_process.cpu_times.side_effect = psutil.NoSuchProcess(1)
+
+        assert BenchmarkTestWorker._read_cpu_time(ps_process, 0.2) == 0.2
+
+
+class TestBenchmarkWorkerAllocationProfiling:
+    """Test the per-run report directory of the allocation profiler and instruction counter."""
+
+    def test_run_creates_and_removes_report_directory(self, temp_workspace):
+        """Reports live in a temporary directory for the duration of the run."""
+        worker = BenchmarkTestWorker(
+            str(temp_workspace), {"generator": "", "test": ""}, time_limit=1000, memory_limit=256,
+            alloc_profiler="/cache/libcts_alloc.so",
+        )
+        seen = []
+
+        with patch(
+            "src.app.core.tools.specialized.base_test_worker.BaseTestWorker.run_tests",
+            side_effect=lambda: seen.append(worker._report_dir),
+        ):
+            worker.run_tests()
+
+        assert seen[0] and not os.path.exists(seen[0])
+        assert worker._report_dir is None
+
+    def test_run_without_profiler_has_no_report_directory(self, temp_workspace):
+        """Without a profiler no directory is created."""
+        worker = BenchmarkTestWorker(
+            str(temp_workspace), {"generator": "", "test": ""}, time_limit=1000, memory_limit=256
+        )
+        seen = []
+
+        with patch(
+            "src.app.core.tools.specialized.base_test_worker.BaseTestWorker.run_tests",
+            side_effect=lambda: seen.append(worker._report_dir),
+        ):
+            worker.run_tests()
+
+        assert seen == [None]
+
+
+    def test_counter_alone_creates_report_directory(self, temp_workspace):
+        """The instruction counter also writes its reports to the directory."""
+        worker = BenchmarkTestWorker(
+            str(temp_workspace), {"generator": "", "test": ""}, time_limit=1000, memory_limit=256,
+            timing_mode="instructions", counter="/cache/libcts_count.so",
+        )
+        seen = []
+
+        with patch(
+            "src.app.core.tools.specialized.base_test_worker.BaseTestWorker.run_tests",
+            side_effect=lambda: seen.append(worker._report_dir),
+        ):
+            worker.run_tests()
+
+        assert seen[0] and not os.path.exists(seen[0])
+
+
+class TestBenchmarkWorkerSamplingProfile:
+    """Test the post-pass profiling the slowest tests."""
+
+    def _make_worker(self, temp_workspace, count):
+        return BenchmarkTestWorker(
+            str(temp_workspace), {"generator": "", "test": ""}, time_limit=1000, memory_limit=256,
+            profile_command=["./test_profiled"], sampler="/cache/libcts_prof.so", profile_count=count,
+        )
+
+    def test_profiles_slowest_tests(self, temp_workspace):
+        """Only the slowest tests are re-run, each getting its profile."""
+        worker = self._make_worker(temp_workspace, 2)
+        worker.test_results = [
+            {"test_number": n, "execution_time": t, "input": f"{n}\n"}
+            for n, t in ((1, 0.1), (2, 0.9), (3, 0.5), (4, 0.2))
+        ]
+        worker._profile_test = Mock(side_effect=lambda input_text, report: {"samples": int(input_text)})
+
+        worker._profile_slowest_tests()
+
+        profiled = {r["test_number"]: r["profile"] for r in worker.test_results if "profile" in r}
+        assert profiled == {2: {"samples": 2}, 3: {"samples": 3}}
+
+    def test_post_pass_runs_before_completion(self, temp_workspace):
+        """Profiles are attached before allTestsCompleted is emitted."""
+        worker = self._make_worker(temp_workspace, 1)
+        worker._profile_slowest_tests = Mock()
+
+        with patch(
+            "src.app.core.tools.specialized.base_test_worker.BaseTestWorker._execute_tests",
+            return_value=True,
+        ):
+            assert worker._execute_tests(Mock()) is True
+
+        worker._profile_slowest_tests.assert_called_once()
+
+    def test_no_post_pass_without_sampler(self, temp_workspace):
+        """Without a profile build and sampler nothing is re-run."""
+        worker = BenchmarkTestWorker(
+            str(temp_workspace), {"generator": "", "test": ""}, time_limit=1000, memory_limit=256
+        )
+        worker._profile_slowest_tests = Mock()
+
+        with patch(
+            "src.app.core.tools.specialized.base_test_worker.BaseTestWorker._execute_tests",
+            return_value=False,
+        ):
+            worker._execute_tests(Mock())
+
+        worker._profile_slowest_tests.assert_not_called()
+
+    def test_missing_report_is_an_error(self, temp_workspace):
+        """A run that writes no samples yields an error entry."""
+        worker = self._make_worker(temp_workspace, 1)
+        process = Mock()
+        process.communicate.return_value = ("", "")
+
+        with patch.object(worker, "_launch_process", return_value=process):
+            profile = worker._profile_test("5\n", str(temp_workspace / "missing.json"))
+
+        assert profile == {"error": "Profiled run wrote no samples"}
+
+
+class TestBenchmarkWorkerStackOverflow:
+    """Test classification of crashes that exhausted the stack."""
+
+    def _make_worker(self, temp_workspace):
+        return BenchmarkTestWorker(
+            str(temp_workspace), {"generator": "", "test": ""}, time_limit=1000, memory_limit=256
+        )
+
+    def test_crash_near_limit_is_stack_overflow(self, temp_workspace):
+        """A segfault with most of the stack in use is reported as overflow."""
+        worker = self._make_worker(temp_workspace)
+        worker.stack_limits = {"test": 8}
+        worker._stack_limit_kb = Mock(return_value=8 * 1024)
+
+        message = worker._describe_stack_overflow(6 * 1024)
+
+        assert message.startswith("Likely stack overflow (6.0 MB of 8 MB")
+
+    def test_shallow_crash_is_not_stack_overflow(self, temp_workspace):
+        """A segfault with a small stack is an ordinary crash."""
+        worker = self._make_worker(temp_workspace)
+        worker.stack_limits = {"test": 256}
+        worker._stack_limit_kb = Mock(return_value=256 * 1024)
+
+        assert worker._describe_stack_overflow(2 * 1024) is None
+
+    def test_unlimited_stack_never_overflows(self, temp_workspace):
+        """Without a finite limit no overflow is reported."""
+        worker = self._make_worker(temp_workspace)
+        worker.stack_limits = {"test": 0}
+        worker._stack_limit_kb = Mock(return_value=None)
+
+        assert worker._describe_stack_overflow(512 * 1024) is None
+
+
+class TestBenchmarkWorkerCalibration:
+    """Test time-limit calibration on the worker thread."""
+
+    REFERENCE = {"alu": 0.2, "latency": 0.4, "bandwidth": 0.1, "branchy": 0.3}
+
+    def _make_worker(self, temp_workspace):
+        return BenchmarkTestWorker(
+            str(temp_workspace), {"generator": "", "test": ""}, time_limit=1000, memory_limit=256
+        )
+
+    def test_run_scales_time_limit_to_this_machine(self, temp_workspace):
+        """The suite runs when the tests start and scales the limit by the class factor."""
+        worker = self._make_worker(temp_workspace)
+        worker.set_calibration(self.REFERENCE, "g++", "latency")
+        local = {"alu": 0.2, "latency": 0.6, "bandwidth": 0.1, "branchy": 0.3}
+
+        with patch(
+            "src.app.core.tools.specialized.benchmark_test_worker.measure_machine_profile",
+            return_value=local,
+        ) as measure, patch(
+            "src.app.core.tools.specialized.base_test_worker.BaseTestWorker.run_tests"
+        ):
+            worker.run_tests()
+
+        measure.assert_called_once_with("g++")
+        assert worker.time_limit == pytest.approx(1.5)
+        assert worker.calibration["latency"] == pytest.approx(1.5)
+
+    def test_unavailable_suite_keeps_raw_limit(self, temp_workspace):
+        """Without a local profile the limit stays the judge limit."""
+        worker = self._make_worker(temp_workspace)
+        worker.set_calibration(self.REFERENCE, "g++", "mixed")
+
+        with patch(
+            "src.app.core.tools.specialized.benchmark_test_worker.measure_machine_profile",
+            return_value=None,
+        ):
+            worker._calibrate()
+
+        assert worker.time_limit == 1.0
+        assert worker.calibration is None
+
+    def test_no_calibration_without_settings(self, temp_workspace):
+        """Workers that were not asked to calibrate never run the suite."""
+        worker = self._make_worker(temp_workspace)
+
+        with patch(
+            "src.app.core.tools.specialized.benchmark_test_worker.measure_machine_profile"
+        ) as measure:
+            worker._calibrate()
+
+        measure.assert_not_called()
+        assert worker.time_limit == 1.0
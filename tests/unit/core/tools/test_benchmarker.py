@@ -13,6 +13,7 @@ from unittest.mock import MagicMock, Mock, call, patch
 import pytest
 from PySide6.QtCore import QObject
 
+from src.app.core.tools.base.language_detector import Language
 from src.app.core.tools.benchmarker import BenchmarkCompilerRunner, Benchmarker
 
 # Note: BenchmarkCompilerRunner tests skipped due to complex inheritance setup
@@ -45,6 +46,8 @@ class TestBenchmarker:
             bench.memory_limit = 256
             bench.test_count = 10
             bench.executables = {}
+            bench.compiler = MagicMock()
+            bench.config = {}
             return bench
 
     def test_init_sets_workspace_and_files(self, workspace_dir):
@@ -133,6 +136,421 @@ class TestBenchmarker:
         assert benchmarker.time_limit == 1000  # Default
         assert benchmarker.memory_limit == 256  # Default
 
+    def test_create_test_worker_passes_alloc_profiler_for_cpp(self, benchmarker):
+        """Should preload the allocation interposer when profiling a C++ solution"""
+        # Arrange
+        benchmarker.config = {"benchmarker": {"alloc_profile": True}}
+        benchmarker.compiler.file_languages = {"test": Language.CPP}
+
+        # Act
+        with patch("src.app.core.tools.benchmarker.BenchmarkTestWorker") as MockWorker, patch(
+            "src.app.core.tools.benchmarker.alloc_profiler_supported", return_value=True
+        ), patch(
+            "src.app.core.tools.benchmarker.ensure_profiler_built", return_value="/cache/libcts_alloc.so"
+        ):
+            benchmarker._create_test_worker(10)
+
+        # Assert
+        assert MockWorker.call_args.kwargs["alloc_profiler"] == "/cache/libcts_alloc.so"
+
+    def test_create_test_worker_skips_alloc_profiler_for_python(self, benchmarker):
+        """Should not preload the interposer into interpreters"""
+        # Arrange
+        benchmarker.compiler.file_languages = {"test": Language.PYTHON}
+        benchmarker.enable_allocation_profiling()
+
+        # Act
+        with patch("src.app.core.tools.benchmarker.BenchmarkTestWorker") as MockWorker, patch(
+            "src.app.core.tools.benchmarker.ensure_profiler_built"
+        ) as mock_build:
+            benchmarker._create_test_worker(10)
+
+        # Assert
+        assert MockWorker.call_args.kwargs["alloc_profiler"] is None
+        mock_build.assert_not_called()
+
+    def test_create_test_worker_without_alloc_profiling(self, benchmarker):
+        """Should not build the interposer unless profiling is enabled"""
+        # Arrange
+        benchmarker.compiler.file_languages = {"test": Language.CPP}
+
+        # Act
+        with patch("src.app.core.tools.benchmarker.BenchmarkTestWorker") as MockWorker, patch(
+            "src.app.core.tools.benchmarker.ensure_profiler_built"
+        ) as mock_build:
+            benchmarker._create_test_worker(10)
+
+        # Assert
+        assert MockWorker.call_args.kwargs["alloc_profiler"] is None
+        mock_build.assert_not_called()
+
+    def test_enable_sampling_profile_registers_profiled_build(self, benchmarker):
+        """Should register a frame-pointer build of the test solution"""
+        # Arrange
+        benchmarker.compiler.add_build_variant.return_value = "test:profiled"
+
+        # Act
+        with patch(
+            "src.app.core.tools.benchmarker.sampling_profiler_supported", return_value=True
+        ):
+            active = benchmarker.enable_sampling_profile(2)
+
+        # Assert
+        assert active
+        assert benchmarker.profile_key == "test:profiled"
+        file_key, variant, overrides = benchmarker.compiler.add_build_variant.call_args.args
+        assert (file_key, variant) == ("test", "profiled")
+        assert "-fno-omit-frame-pointer" in overrides["extra_flags"]
+
+    def test_create_test_worker_passes_profile_options(self, benchmarker):
+        """Should hand the profiled build and sampler to the worker"""
+        # Arrange
+        benchmarker.config = {"benchmarker": {"profile_slowest": 3}}
+        benchmarker.profile_key = "test:profiled"
+        benchmarker.compiler.get_execution_command.side_effect = lambda key: [f"./{key}"]
+
+        # Act
+        with patch("src.app.core.tools.benchmarker.BenchmarkTestWorker") as MockWorker, patch(
+            "src.app.core.tools.benchmarker.ensure_sampler_built", return_value="/cache/libcts_prof.so"
+        ):
+            benchmarker._create_test_worker(10)
+
+        # Assert
+        kwargs = MockWorker.call_args.kwargs
+        assert kwargs["profile_command"] == ["./test:profiled"]
+        assert kwargs["sampler"] == "/cache/libcts_prof.so"
+        assert kwargs["profile_count"] == 3
+
+    def test_create_test_worker_passes_timing_options(self, benchmarker):
+        """Should preload the instruction counter into C++ solutions in instruction mode"""
+        # Arrange
+        benchmarker.config = {
+            "benchmarker": {"timing_mode": "instructions", "reference_instructions_per_second": 2e9}
+        }
+        benchmarker.compiler.file_languages = {"test": Language.CPP}
+
+        # Act
+        with patch("src.app.core.tools.benchmarker.BenchmarkTestWorker") as MockWorker, patch(
+            "src.app.core.tools.benchmarker.counter_supported", return_value=True
+        ), patch(
+            "src.app.core.tools.benchmarker.ensure_counter_built", return_value="/cache/libcts_count.so"
+        ):
+            benchmarker._create_test_worker(10)
+
+        # Assert
+        kwargs = MockWorker.call_args.kwargs
+        assert kwargs["timing_mode"] == "instructions"
+        assert kwargs["reference_ips"] == 2e9
+        assert kwargs["counter"] == "/cache/libcts_count.so"
+
+    def test_create_test_worker_hands_calibration_to_worker(self, benchmarker):
+        """The worker gets the judge limit and measures this machine on its own thread"""
+        # Arrange
+        reference = {"alu": 0.2, "latency": 0.4, "bandwidth": 0.1, "branchy": 0.3}
+        benchmarker.config = {
+            "benchmarker": {
+                "calibrate": True,
+                "workload_class": "latency",
+                "reference_profile": reference,
+            }
+        }
+
+        # Act
+        with patch("src.app.core.tools.benchmarker.BenchmarkTestWorker") as MockWorker, patch(
+            "src.app.core.tools.benchmarker.measure_machine_profile"
+        ) as measure:
+            benchmarker._create_test_worker(10, time_limit=1000)
+
+        # Assert
+        assert MockWorker.call_args.args[2] == 1000
+        assert benchmarker.time_limit == 1000
+        MockWorker.return_value.set_calibration.assert_called_once_with(reference, "g++", "latency")
+        measure.assert_not_called()
+
+    def test_create_test_worker_without_reference_profile(self, benchmarker):
+        """Calibration needs a reference profile; without one the raw limit is used"""
+        benchmarker.config = {"benchmarker": {"calibrate": True}}
+
+        with patch("src.app.core.tools.benchmarker.BenchmarkTestWorker") as MockWorker:
+            benchmarker._create_test_worker(10, time_limit=1000)
+
+        assert MockWorker.call_args.args[2] == 1000
+        MockWorker.return_value.set_calibration.assert_not_called()
+
+    def test_save_reference_profile_measures_this_machine(self, benchmarker):
+        """Without a profile the local suite result becomes the reference"""
+        # Arrange
+        profile = {"alu": 0.2, "latency": 0.4, "bandwidth": 0.1, "branchy": 0.3}
+        config_manager = MagicMock()
+        config_manager.load_config.return_value = {"benchmarker": {"timing_mode": "cpu"}}
+
+        # Act
+        with patch("src.app.core.tools.benchmarker.measure_machine_profile", return_value=profile):
+            saved = benchmarker.save_reference_profile(config_manager=config_manager)
+
+        # Assert
+        assert saved == profile
+        stored = config_manager.save_config.call_args.args[0]["benchmarker"]
+        assert stored == {"timing_mode": "cpu", "reference_profile": profile}
+        assert benchmarker.config["benchmarker"]["reference_profile"] == profile
+
+    def test_set_timing_mode_rejects_unknown_mode(self, benchmarker):
+        """Should only accept wall, cpu and instructions"""
+        benchmarker.set_timing_mode("cpu")
+        assert benchmarker._get_timing_options()["timing_mode"] == "cpu"
+
+        with pytest.raises(ValueError):
+            benchmarker.set_timing_mode("cycles")
+
+    def test_enable_tournament_registers_solutions(self, benchmarker):
+        """Competing solutions get solution_N keys next to the test solution"""
+        # Arrange
+        benchmarker.compiler.files = {"test": "/ws/benchmarker/test.cpp"}
+        benchmarker.compiler.add_source.side_effect = lambda key, path: f"/ws/benchmarker/{path}"
+
+        # Act
+        solutions = benchmarker.enable_tournament(["fast.cpp", "alt.py"])
+
+        # Assert
+        assert solutions == {"test": "test.cpp", "solution_1": "fast.cpp", "solution_2": "alt.py"}
+        assert benchmarker.enable_tournament([]) == {}
+
+    def test_create_test_worker_in_tournament_mode(self, benchmarker):
+        """Should run all tournament solutions with the tournament worker"""
+        # Arrange
+        benchmarker.tournament = {"test": "test.cpp", "solution_1": "fast.cpp"}
+        benchmarker.compiler.get_execution_command.side_effect = lambda key: [f"./{key}"]
+
+        # Act
+        with patch("src.app.core.tools.benchmarker.TournamentTestWorker") as MockWorker, patch(
+            "src.app.core.tools.benchmarker.BenchmarkTestWorker"
+        ) as MockBenchmarkWorker:
+            benchmarker._create_test_worker(10)
+
+        # Assert
+        MockBenchmarkWorker.assert_not_called()
+        kwargs = MockWorker.call_args.kwargs
+        assert kwargs["solutions"] == benchmarker.tournament
+        assert kwargs["execution_commands"]["solution_1"] == ["./solution_1"]
+
+    def test_create_test_result_includes_tournament(self, benchmarker):
+        """Should rank the tournament solutions in the analysis"""
+        # Arrange
+        benchmarker.tournament = {"test": "test.cpp", "solution_1": "fast.cpp"}
+        def entry(time):
+            return {"execution_time": time, "memory_used": 5.0, "passed": True,
+                    "error_details": "Accepted", "position": 0}
+
+        test_results = [
+            {"test_number": n, "passed": True, "execution_time": 0.2,
+             "tournament": {"test": entry(0.2), "solution_1": entry(0.1)}}
+            for n in range(1, 4)
+        ]
+
+        benchmarker._get_test_file_path = Mock(return_value="test.cpp")
+        benchmarker._create_files_snapshot = Mock(return_value={})
+
+        # Act
+        result = benchmarker._create_test_result(True, test_results, 3, 0, 0.9)
+
+        # Assert
+        tournament = json.loads(result.mismatch_analysis)["tournament"]
+        assert [s["label"] for s in tournament["ranking"]] == ["fast.cpp", "test.cpp"]
+        assert tournament["compared_tests"] == 3
+
+    def test_files_snapshot_includes_tournament_solutions(self, benchmarker, tmp_path):
+        """Competing solutions are saved with the run"""
+        # Arrange
+        source = tmp_path / "fast.cpp"
+        source.write_text("int main() {}")
+        benchmarker.tournament = {"test": "test.cpp", "solution_1": "fast.cpp"}
+        benchmarker.compiler.files = {"solution_1": str(source)}
+        benchmarker.compiler.file_languages = {"solution_1": Language.CPP}
+
+        # Act
+        with patch(
+            "src.app.core.tools.benchmarker.BaseRunner._create_files_snapshot",
+            return_value={"files": {}},
+        ):
+            snapshot = benchmarker._create_files_snapshot()
+
+        # Assert
+        assert snapshot["files"]["fast.cpp"] == {
+            "content": "int main() {}", "language": "cpp", "role": "solution"
+        }
+
+    def test_enable_differential_registers_profile_builds(self, benchmarker):
+        """Each available profile becomes a build variant of the test solution"""
+        # Arrange
+        benchmarker.compiler.add_build_variant.side_effect = lambda key, variant, overrides: f"{key}:{variant}"
+
+        # Act
+        with patch("src.app.core.tools.base.differential.shutil.which", return_value=None):
+            builds = benchmarker.enable_differential(
+                {"O0": {"optimization": "O0"}, "clang": {"compiler": "clang++"}}
+            )
+
+        # Assert
+        assert list(builds.values()) == ["O0"]
+        key = next(iter(builds))
+        assert key.startswith("test:diff_O0_")
+        assert benchmarker.compiler.add_build_variant.call_args.args[2] == {"optimization": "O0"}
+
+    def test_enable_differential_skips_interpreted_solutions(self, benchmarker):
+        """Python solutions have no flag profiles"""
+        benchmarker.compiler.add_build_variant.return_value = None
+
+        assert benchmarker.enable_differential({"O0": {"optimization": "O0"}}) == {}
+
+    def test_create_test_worker_in_differential_mode(self, benchmarker):
+        """Profile builds run next to the regular build on the same inputs"""
+        # Arrange
+        benchmarker.differential = {"test:diff_O0_1": "O0"}
+        benchmarker.compiler.get_execution_command.side_effect = lambda key: [f"./{key}"]
+
+        # Act
+        with patch("src.app.core.tools.benchmarker.TournamentTestWorker") as MockWorker:
+            benchmarker._create_test_worker(10)
+
+        # Assert
+        kwargs = MockWorker.call_args.kwargs
+        assert kwargs["solutions"] == {"test": "regular build", "test:diff_O0_1": "O0"}
+        assert kwargs["execution_commands"]["test:diff_O0_1"] == ["./test:diff_O0_1"]
+
+    def test_enable_autotune_registers_candidates(self, benchmarker):
+        """Each flag set becomes a build variant of the test solution"""
+        # Arrange
+        benchmarker.compiler.add_build_variant.side_effect = lambda key, variant, overrides: f"{key}:{variant}"
+
+        # Act
+        candidates = benchmarker.enable_autotune({"O3": {"optimization": "O3"}})
+
+        # Assert
+        key = next(iter(candidates))
+        assert key.startswith("test:tune_O3_")
+        assert candidates[key] == "O3"
+        assert benchmarker.autotune_overrides[key] == {"optimization": "O3"}
+
+    def test_create_test_worker_in_autotune_mode(self, benchmarker):
+        """Candidates run next to the default build without profiling"""
+        # Arrange
+        benchmarker.autotune = {"test:tune_O3_1": "O3"}
+        benchmarker.differential = {"test:diff_O0_1": "O0"}
+        benchmarker._get_profile_options = Mock(return_value={"profile_command": ["perf"]})
+
+        # Act
+        with patch("src.app.core.tools.benchmarker.AutotuneTestWorker") as MockWorker:
+            benchmarker._create_test_worker(10)
+
+        # Assert
+        kwargs = MockWorker.call_args.kwargs
+        assert kwargs["solutions"] == {"test": "default flags", "test:tune_O3_1": "O3"}
+        assert "profile_command" not in kwargs
+
+    def test_create_test_result_includes_autotune(self, benchmarker):
+        """Should report the fastest flag set and its recommended overrides"""
+        # Arrange
+        benchmarker.autotune = {"test:tune_O3_1": "O3"}
+        benchmarker.autotune_overrides = {"test:tune_O3_1": {"optimization": "O3"}}
+        def entry(time):
+            return {"execution_time": time, "passed": True, "error_details": "Accepted", "output_hash": "h"}
+
+        test_results = [
+            {"test_number": n, "passed": True, "execution_time": 0.2,
+             "tournament": {"test": entry(0.2 * n), "test:tune_O3_1": entry(0.1 * n)}}
+            for n in range(1, 6)
+        ]
+
+        benchmarker._get_test_file_path = Mock(return_value="test.cpp")
+        benchmarker._create_files_snapshot = Mock(return_value={})
+
+        # Act
+        result = benchmarker._create_test_result(True, test_results, 5, 0, 0.9)
+
+        # Assert
+        autotune = json.loads(result.mismatch_analysis)["autotune"]
+        assert autotune["best"]["label"] == "O3"
+        assert autotune["recommended_overrides"] == {"optimization": "O3"}
+
+    def test_save_flag_overrides_updates_config(self, benchmarker, tmp_path):
+        """Overrides are stored per source file and the stale executable removed"""
+        # Arrange
+        executable = tmp_path / "test.exe"
+        executable.write_text("")
+        benchmarker.compiler.files = {"test": "/src/test.cpp"}
+        benchmarker.compiler.executables = {"test": str(executable)}
+        config_manager = MagicMock()
+        config_manager.load_config.return_value = {"languages": {"cpp": {"std_version": "c++17"}}}
+
+        # Act
+        benchmarker.save_flag_overrides({"optimization": "O3"}, config_manager)
+
+        # Assert
+        saved = config_manager.save_config.call_args.args[0]
+        assert saved["languages"]["cpp"]["std_version"] == "c++17"
+        assert saved["languages"]["cpp"]["file_overrides"] == {"/src/test.cpp": {"optimization": "O3"}}
+        assert benchmarker.config["languages"]["cpp"]["file_overrides"]["/src/test.cpp"] == {"optimization": "O3"}
+        assert not executable.exists()
+
+    def test_enable_allocator_experiments_registers_variants(self, benchmarker):
+        """Each allocator/THP variant runs the test solution with its environment"""
+        # Arrange
+        benchmarker.compiler.file_languages = {"test": Language.CPP}
+
+        # Act
+        variants = benchmarker.enable_allocator_experiments(
+            {"jemalloc": {"LD_PRELOAD": "/lib/libjemalloc.so.2"}}
+        )
+
+        # Assert
+        assert variants == {"test@jemalloc": "jemalloc"}
+        assert benchmarker.allocator_environments["test@jemalloc"] == {"LD_PRELOAD": "/lib/libjemalloc.so.2"}
+
+    def test_enable_allocator_experiments_skips_interpreted_solutions(self, benchmarker):
+        """Only native solutions are run under other allocators"""
+        benchmarker.compiler.file_languages = {"test": Language.PYTHON}
+
+        assert benchmarker.enable_allocator_experiments({"thp": {"GLIBC_TUNABLES": "x"}}) == {}
+
+    def test_create_test_worker_with_allocator_variants(self, benchmarker):
+        """Variant runs execute the test command with their environment"""
+        # Arrange
+        benchmarker.allocators = {"test@thp": "thp"}
+        benchmarker.allocator_environments = {"test@thp": {"GLIBC_TUNABLES": "glibc.malloc.hugetlb=1"}}
+        benchmarker.compiler.get_execution_command.side_effect = lambda key: [f"./{key}"]
+
+        # Act
+        with patch("src.app.core.tools.benchmarker.TournamentTestWorker") as MockWorker:
+            benchmarker._create_test_worker(10)
+
+        # Assert
+        kwargs = MockWorker.call_args.kwargs
+        assert kwargs["solutions"] == {"test": "regular build", "test@thp": "thp"}
+        assert kwargs["execution_commands"]["test@thp"] == ["./test"]
+        assert kwargs["role_environments"] == benchmarker.allocator_environments
+
+    def test_allocator_variants_share_stack_limit(self, benchmarker):
+        """Variant runs get the stack limit of the test solution"""
+        benchmarker.allocators = {"test@thp": "thp"}
+        benchmarker.compiler.file_languages = {"test": Language.CPP, "generator": Language.CPP}
+
+        with patch("src.app.core.tools.base.base_runner.stack_limit_supported", return_value=True):
+            limits = benchmarker._get_stack_limits()
+
+        assert limits["test@thp"] == limits["test"]
+
+    def test_create_test_worker_without_sampling_profile(self, benchmarker):
+        """Should not build the sampler unless profiling is enabled"""
+        # Act
+        with patch("src.app.core.tools.benchmarker.BenchmarkTestWorker") as MockWorker, patch(
+            "src.app.core.tools.benchmarker.ensure_sampler_built"
+        ) as mock_build:
+            benchmarker._create_test_worker(10)
+
+        # Assert
+        assert "profile_command" not in MockWorker.call_args.kwargs
+        mock_build.assert_not_called()
+
     def test_connect_worker_signals_calls_parent(self, benchmarker):
         """Should call parent method to connect common signals"""
         # Arrange
@@ -308,6 +726,193 @@ class TestBenchmarker:
         assert analysis["failed_tests"][0]["test_number"] == 2
         assert analysis["failed_tests"][1]["test_number"] == 3
 
+    def test_create_test_result_includes_allocation_profile(self, benchmarker):
+        """Should aggregate per-test allocation summaries"""
+        # Arrange
+        test_results = [
+            {
+                "passed": True,
+                "execution_time": 0.1,
+                "allocations": {
+                    "allocations": 5000,
+                    "peak_live_bytes": 4096,
+                    "leaked_bytes": 0,
+                    "hints": ["node churn"],
+                },
+            },
+            {"passed": True, "execution_time": 0.1},
+        ]
+
+        benchmarker._get_test_file_path = Mock(return_value="test.cpp")
+        benchmarker._create_files_snapshot = Mock(return_value={})
+
+        # Act
+        result = benchmarker._create_test_result(True, test_results, 2, 0, 0.2)
+
+        # Assert
+        profile = json.loads(result.mismatch_analysis)["allocation_profile"]
+        assert profile["profiled_tests"] == 1
+        assert profile["max_allocations"] == 5000
+        assert profile["hints"] == {"node churn": 1}
+
+    def test_create_test_result_includes_io_profile(self, benchmarker):
+        """Should aggregate per-test syscall I/O profiles"""
+        # Arrange
+        io = {
+            "read_syscalls": 3,
+            "write_syscalls": 20000,
+            "bytes_read": 100,
+            "bytes_written": 140000,
+            "user_time": 0.2,
+            "system_time": 0.2,
+            "warnings": ["tiny writes"],
+        }
+        test_results = [
+            {"passed": True, "test_number": 1, "io": io},
+            {"passed": True, "test_number": 2},
+        ]
+
+        benchmarker._get_test_file_path = Mock(return_value="test.cpp")
+        benchmarker._create_files_snapshot = Mock(return_value={})
+
+        # Act
+        result = benchmarker._create_test_result(True, test_results, 2, 0, 0.2)
+
+        # Assert
+        profile = json.loads(result.mismatch_analysis)["io_profile"]
+        assert profile["profiled_tests"] == 1
+        assert profile["avg_write_bytes"] == 7
+        assert profile["system_time_ratio"] == 0.5
+        assert profile["tests_with_warnings"] == [1]
+
+    def test_create_test_result_includes_timing(self, benchmarker):
+        """Should summarize timing sources outside wall mode"""
+        # Arrange
+        benchmarker.timing_mode = "cpu"
+        test_results = [
+            {"passed": True, "execution_time": 0.2, "wall_time": 0.9, "timing_source": "cpu_time"}
+        ]
+
+        benchmarker._get_test_file_path = Mock(return_value="test.cpp")
+        benchmarker._create_files_snapshot = Mock(return_value={})
+
+        # Act
+        result = benchmarker._create_test_result(True, test_results, 1, 0, 0.9)
+
+        # Assert
+        timing = json.loads(result.mismatch_analysis)["timing"]
+        assert timing["mode"] == "cpu"
+        assert timing["sources"] == {"cpu_time": 1}
+        assert timing["max_wall_time"] == 0.9
+
+    def test_create_test_result_includes_calibration(self, benchmarker):
+        """Should report the factors and the predicted judge time of the slowest test"""
+        # Arrange
+        benchmarker.worker = Mock(calibration={"alu": 2.0, "latency": 2.0, "bandwidth": 2.0, "branchy": 2.0})
+        test_results = [{"passed": True, "execution_time": 1.2}, {"passed": True, "execution_time": 0.4}]
+
+        benchmarker._get_test_file_path = Mock(return_value="test.cpp")
+        benchmarker._create_files_snapshot = Mock(return_value={})
+
+        # Act
+        result = benchmarker._create_test_result(True, test_results, 2, 0, 1.6)
+
+        # Assert
+        calibration = json.loads(result.mismatch_analysis)["calibration"]
+        assert calibration["workload_class"] == "mixed"
+        assert calibration["local_time_limit_ms"] == pytest.approx(2000)
+        assert calibration["predicted_max_time"] == pytest.approx(0.6)
+        assert calibration["predicted_within_limit"] is True
+
+    def test_create_test_result_includes_sampling_profile(self, benchmarker):
+        """Should list profiled tests with their hottest functions"""
+        # Arrange
+        profile = {
+            "samples": 500,
+            "top_self": [{"function": "dfs(int)", "samples": 400, "percent": 80.0}],
+            "collapsed": [["main;dfs(int)", 400]],
+        }
+        test_results = [
+            {"passed": True, "test_number": 1, "execution_time": 0.5, "profile": profile},
+            {"passed": True, "test_number": 2, "execution_time": 0.1},
+        ]
+
+        benchmarker._get_test_file_path = Mock(return_value="test.cpp")
+        benchmarker._create_files_snapshot = Mock(return_value={})
+
+        # Act
+        result = benchmarker._create_test_result(True, test_results, 2, 0, 0.6)
+
+        # Assert
+        summary = json.loads(result.mismatch_analysis)["sampling_profile"]
+        assert summary["profiled_tests"][0]["test_number"] == 1
+        assert summary["profiled_tests"][0]["top_self"][0]["function"] == "dfs(int)"
+
+    def test_create_test_result_includes_latency_distribution(self, benchmarker):
+        """Should report percentiles of wall time, CPU time and peak RSS"""
+        # Arrange
+        test_results = [
+            {"passed": True, "execution_time": 0.01, "cpu_time": 0.01, "memory_used": 10}
+            for _ in range(99)
+        ] + [{"passed": True, "execution_time": 1.0, "cpu_time": 0.9, "memory_used": 200}]
+
+        benchmarker._get_test_file_path = Mock(return_value="test.cpp")
+        benchmarker._create_files_snapshot = Mock(return_value={})
+
+        # Act
+        result = benchmarker._create_test_result(True, test_results, 100, 0, 2.0)
+
+        # Assert
+        distribution = json.loads(result.mismatch_analysis)["latency_distribution"]
+        wall = distribution["wall_time_us"]
+        assert wall["count"] == 100
+        assert wall["p50"] == pytest.approx(10000, rel=1e-3)
+        assert wall["max"] == 1000000
+        assert distribution["cpu_time_us"]["p99"] == pytest.approx(10000, rel=1e-3)
+        assert distribution["peak_rss_kb"]["max"] == 204800
+        assert "hdr" in wall and wall["histogram"]
+
+    def test_create_test_result_separates_cold_and_warm_jvm_runs(self, benchmarker):
+        """Should report cold and warm main() times of persistent JVMs separately"""
+        # Arrange
+        def timing(main_time, cold):
+            return {"mode": "warm_jvm", "main_time": main_time, "cold": cold, "jvm_startup_time": 0.2}
+
+        test_results = [
+            {"passed": True, "warm_timing": timing(0.09, True)},
+            {"passed": True, "warm_timing": timing(0.01, False)},
+            {"passed": True, "warm_timing": timing(0.03, False)},
+        ]
+
+        benchmarker._get_test_file_path = Mock(return_value="Test.java")
+        benchmarker._create_files_snapshot = Mock(return_value={})
+
+        # Act
+        result = benchmarker._create_test_result(
+            all_passed=True,
+            test_results=test_results,
+            passed_tests=3,
+            failed_tests=0,
+            total_time=0.5,
+        )
+
+        # Assert
+        jvm_timing = json.loads(result.mismatch_analysis)["jvm_timing"]
+        assert jvm_timing["cold_runs"] == 1
+        assert jvm_timing["warm_runs"] == 2
+        assert jvm_timing["cold_main_avg"] == pytest.approx(0.09)
+        assert jvm_timing["warm_main_avg"] == pytest.approx(0.02)
+        assert jvm_timing["jvm_startup_time"] == pytest.approx(0.2)
+
+    def test_create_test_result_without_warm_runs(self, benchmarker):
+        """Should omit JVM timing for regular process launches"""
+        benchmarker._get_test_file_path = Mock(return_value="test.cpp")
+        benchmarker._create_files_snapshot = Mock(return_value={})
+
+        result = benchmarker._create_test_result(True, [{"passed": True}], 1, 0, 0.1)
+
+        assert "jvm_timing" not in json.loads(result.mismatch_analysis)
+
     def test_run_benchmark_test_calls_run_tests(self, benchmarker):
         """Should call BaseRunner.run_tests with benchmark parameters"""
         # Arrange
@@ -653,3 +653,175 @@ class TestComparatorEdgeCases:
         analysis = json.loads(result.mismatch_analysis)
         assert analysis["comparison_summary"]["matching_outputs"] == 0
         assert len(analysis["failed_tests"]) == 2
+
+
+class TestComparatorTieredMode:
+    """Test tiered stress mode (optimized run + sanitizer replays)."""
+
+    def test_tiered_mode_disabled_by_default(
+        self, temp_workspace, comparator_files, mock_compiler, mock_database
+    ):
+        """Should not register a sanitizer build without config."""
+        comparator = Comparator(str(temp_workspace), files=comparator_files)
+
+        assert comparator.sanitizer_key is None
+        mock_compiler.add_sanitizer_build.assert_not_called()
+
+    def test_tiered_mode_from_config(
+        self, temp_workspace, comparator_files, mock_compiler, mock_database
+    ):
+        """Should register the sanitized test build when enabled in config."""
+        mock_compiler.add_sanitizer_build.return_value = "test:sanitized"
+        config = {"comparator": {"tiered": True, "sanitizer_sample_rate": 0.25}}
+
+        comparator = Comparator(
+            str(temp_workspace), files=comparator_files, config=config
+        )
+
+        mock_compiler.add_sanitizer_build.assert_called_once_with("test")
+        assert comparator.sanitizer_key == "test:sanitized"
+        assert comparator.sanitizer_sample_rate == 0.25
+
+    @patch("src.app.core.tools.comparator.ComparisonTestWorker")
+    def test_worker_receives_sanitizer_command(
+        self,
+        mock_worker_class,
+        temp_workspace,
+        comparator_files,
+        mock_compiler,
+        mock_database,
+    ):
+        """Worker should get the sanitized execution command and sample rate."""
+        mock_compiler.add_sanitizer_build.return_value = "test:sanitized"
+        comparator = Comparator(str(temp_workspace), files=comparator_files)
+        comparator.enable_tiered_mode(0.5)
+
+        comparator._create_test_worker(10, run_seed=123)
+
+        kwargs = mock_worker_class.call_args[1]
+        assert kwargs["sanitizer_command"] == "./test:sanitized"
+        assert kwargs["sanitizer_sample_rate"] == 0.5
+        assert kwargs["run_seed"] == 123
+
+    def test_analysis_includes_sanitizer_summary(
+        self, temp_workspace, comparator_files, mock_compiler, mock_database
+    ):
+        """mismatch_analysis should summarize sanitizer replays."""
+        mock_compiler.add_sanitizer_build.return_value = "test:sanitized"
+        comparator = Comparator(str(temp_workspace), files=comparator_files)
+        comparator.enable_tiered_mode()
+        comparator.test_count = 2
+
+        test_results = [
+            {
+                "test_number": 1,
+                "passed": False,
+                "error_details": "Undefined behavior detected by sanitizer replay",
+                "sanitizer_replay": {"reason": "sample", "ub_detected": True, "time": 0.5},
+            },
+            {
+                "test_number": 2,
+                "passed": False,
+                "error_details": "Output mismatch",
+                "sanitizer_replay": {"reason": "failure", "ub_detected": False, "time": 0.25},
+            },
+        ]
+
+        result = comparator._create_test_result(
+            all_passed=False,
+            test_results=test_results,
+            passed_tests=0,
+            failed_tests=2,
+            total_time=1.0,
+        )
+
+        tier = json.loads(result.mismatch_analysis)["sanitizer_tier"]
+        assert tier["replayed_samples"] == 1
+        assert tier["replayed_failures"] == 1
+        assert tier["ub_detected"] == 1
+        assert tier["ub_tests"] == [1]
+        assert tier["replay_time"] == 0.75
+
+    def test_analysis_includes_startup_overhead(
+        self, temp_workspace, comparator_files, mock_compiler, mock_database
+    ):
+        """Startup of the binaries is probed against their average time per test."""
+        comparator = Comparator(str(temp_workspace), files=comparator_files)
+        comparator.test_count = 1
+        comparator._measure_startup_overhead = Mock(
+            return_value={"test": {"min_seconds": 0.001, "share_of_test_time": 0.5}}
+        )
+
+        result = comparator._create_test_result(
+            all_passed=True,
+            test_results=[
+                {"test_number": 1, "passed": True, "generator_time": 0.004,
+                 "test_time": 0.002, "correct_time": 0.003}
+            ],
+            passed_tests=1,
+            failed_tests=0,
+            total_time=0.1,
+        )
+
+        comparator._measure_startup_overhead.assert_called_once_with(
+            {"test": 0.002, "correct": 0.003}
+        )
+        analysis = json.loads(result.mismatch_analysis)
+        assert analysis["startup_overhead"]["test"]["share_of_test_time"] == 0.5
+
+
+class TestComparatorDistributedMode:
+    """Test comparison runs handed to worker agents."""
+
+    @patch("src.app.core.tools.comparator.DistributedTestWorker")
+    def test_distributed_mode_from_config(
+        self,
+        mock_worker_class,
+        temp_workspace,
+        comparator_files,
+        mock_compiler,
+        mock_database,
+    ):
+        """Config should switch the worker to the broker with its settings."""
+        config = {
+            "comparator": {
+                "distributed": {"enabled": True, "address": "0.0.0.0:7070", "token": "t"}
+            }
+        }
+        comparator = Comparator(str(temp_workspace), files=comparator_files, config=config)
+
+        comparator._create_test_worker(1000, run_seed=5)
+
+        kwargs = mock_worker_class.call_args[1]
+        assert kwargs["address"] == "0.0.0.0:7070"
+        assert kwargs["token"] == "t"
+        assert kwargs["local_agents"] == 0
+        assert kwargs["run_seed"] == 5
+        assert kwargs["execution_commands"]["test"] == "./test"
+
+    def test_analysis_counts_unrecorded_passes(
+        self, temp_workspace, comparator_files, mock_compiler, mock_database
+    ):
+        """Averages and matches should cover the passing tests that were only counted."""
+        comparator = Comparator(str(temp_workspace), files=comparator_files)
+        comparator.test_count = 4
+        comparator._measure_startup_overhead = Mock(return_value=None)
+        comparator.worker = Mock()
+        comparator.worker.run_seed = 9
+        comparator.worker.time_totals = {"generator": 0.4, "test": 0.8, "correct": 1.2}
+        comparator.worker.distribution = {"completed_tests": 4, "agents": {}}
+
+        result = comparator._create_test_result(
+            all_passed=False,
+            test_results=[
+                {"test_number": 2, "passed": False, "error_details": "Output mismatch"}
+            ],
+            passed_tests=3,
+            failed_tests=1,
+            total_time=1.0,
+        )
+
+        analysis = json.loads(result.mismatch_analysis)
+        assert analysis["comparison_summary"]["matching_outputs"] == 3
+        assert analysis["execution_times"]["avg_test"] == pytest.approx(0.2)
+        assert analysis["distributed"]["completed_tests"] == 4
@@ -513,3 +513,186 @@ class TestComparisonWorkerResultStorage:
         assert "test_output_full" in result
         assert "correct_output_full" in result
         assert len(result["input_full"]) > 300
+
+
+class TestComparisonWorkerSanitizerTier:
+    """Test tiered mode: sanitizer replays of failures and sampled passes."""
+
+    def _make_worker(self, temp_workspace, sample_rate=0.0):
+        executables = {"generator": "", "test": "", "correct": ""}
+        return ComparisonTestWorker(
+            str(temp_workspace),
+            executables,
+            test_count=1,
+            run_seed=1,
+            sanitizer_command=["./test_sanitized"],
+            sanitizer_sample_rate=sample_rate,
+        )
+
+    def _result(self, passed, error_details=""):
+        return {
+            "test_number": 1,
+            "passed": passed,
+            "error_details": error_details,
+            "input_full": "5\n",
+            "correct_output_full": "25\n",
+        }
+
+    def _replay(self, ub_detected=False, output="25\n"):
+        return {
+            "exit_code": 1 if ub_detected else 0,
+            "report": "runtime error: signed integer overflow" if ub_detected else "",
+            "ub_detected": ub_detected,
+            "time": 0.1,
+            "output": output,
+        }
+
+    def test_unsampled_pass_is_not_replayed(self, temp_workspace):
+        """Passing tests outside the sample should not run the sanitized build."""
+        worker = self._make_worker(temp_workspace, sample_rate=0.0)
+
+        with patch.object(worker, "_run_sanitized") as mock_replay:
+            result = worker._apply_sanitizer_tier(1, self._result(True))
+
+        mock_replay.assert_not_called()
+        assert "sanitizer_replay" not in result
+
+    def test_sampled_pass_with_ub_fails(self, temp_workspace):
+        """A sampled pass that trips a sanitizer should become a failure."""
+        worker = self._make_worker(temp_workspace, sample_rate=1.0)
+
+        with patch.object(
+            worker, "_run_sanitized", return_value=self._replay(ub_detected=True)
+        ) as mock_replay:
+            result = worker._apply_sanitizer_tier(1, self._result(True))
+
+        mock_replay.assert_called_once_with("5\n")
+        assert result["passed"] is False
+        assert result["error_details"] == "Undefined behavior detected by sanitizer replay"
+        assert result["sanitizer_replay"]["reason"] == "sample"
+        assert result["sanitizer_replay"]["output_matches"] is True
+        assert "output" not in result["sanitizer_replay"]
+
+    def test_mismatch_is_always_replayed(self, temp_workspace):
+        """Output mismatches are replayed regardless of the sample rate."""
+        worker = self._make_worker(temp_workspace, sample_rate=0.0)
+
+        with patch.object(
+            worker, "_run_sanitized", return_value=self._replay(output="24\n")
+        ):
+            result = worker._apply_sanitizer_tier(
+                1, self._result(False, "Output mismatch")
+            )
+
+        assert result["passed"] is False
+        assert result["error_details"] == "Output mismatch"
+        assert result["sanitizer_replay"]["reason"] == "failure"
+        assert result["sanitizer_replay"]["output_matches"] is False
+
+    def test_crash_with_ub_is_annotated(self, temp_workspace):
+        """Crashing test solutions get the sanitizer finding appended."""
+        worker = self._make_worker(temp_workspace)
+
+        with patch.object(
+            worker, "_run_sanitized", return_value=self._replay(ub_detected=True)
+        ):
+            result = worker._apply_sanitizer_tier(
+                1, self._result(False, "Test solution failed: ")
+            )
+
+        assert "sanitizer replay detected undefined behavior" in result["error_details"]
+
+    @pytest.mark.parametrize(
+        "error_details",
+        ["Generator failed: boom", "Test solution timeout (>30s)"],
+    )
+    def test_other_failures_are_not_replayed(self, temp_workspace, error_details):
+        """Generator failures and timeouts are not replayed."""
+        worker = self._make_worker(temp_workspace, sample_rate=1.0)
+
+        with patch.object(worker, "_run_sanitized") as mock_replay:
+            worker._apply_sanitizer_tier(1, self._result(False, error_details))
+
+        mock_replay.assert_not_called()
+
+    @patch("subprocess.run")
+    def test_run_sanitized_detects_reports(self, mock_run, temp_workspace):
+        """Sanitizer reports on stderr should be detected and kept."""
+        mock_run.return_value = Mock(
+            returncode=1,
+            stdout="25\n",
+            stderr="==1==ERROR: AddressSanitizer: heap-buffer-overflow",
+        )
+        worker = self._make_worker(temp_workspace)
+
+        replay = worker._run_sanitized("5\n")
+
+        assert replay["ub_detected"] is True
+        assert "heap-buffer-overflow" in replay["report"]
+        assert mock_run.call_args[1]["input"] == "5\n"
+        assert mock_run.call_args[1]["env"]["ASAN_OPTIONS"] == "detect_leaks=0"
+
+    @patch("subprocess.run")
+    def test_run_sanitized_timeout(self, mock_run, temp_workspace):
+        """A hanging replay is reported without UB."""
+        mock_run.side_effect = TimeoutExpired(["./test_sanitized"], 60)
+        worker = self._make_worker(temp_workspace)
+
+        replay = worker._run_sanitized("5\n")
+
+        assert replay["ub_detected"] is False
+        assert replay["output"] is None
+        assert replay["exit_code"] is None
+
+    def test_no_replay_without_sanitizer_command(self, temp_workspace):
+        """Without a sanitizer build the tier is skipped entirely."""
+        executables = {"generator": "", "test": "", "correct": ""}
+        worker = ComparisonTestWorker(str(temp_workspace), executables, test_count=1)
+
+        with patch.object(
+            worker, "_run_comparison", return_value=self._result(True)
+        ), patch.object(worker, "_apply_sanitizer_tier") as mock_tier:
+            worker._run_single_test(1)
+
+        mock_tier.assert_not_called()
+
+
+class TestComparisonWorkerHashedComparison:
+    """Test the digest comparison with real processes."""
+
+    def _make_worker(self, temp_workspace, test_code, correct_code):
+        import sys
+
+        commands = {
+            "generator": [sys.executable, "-c", "print(3)"],
+            "test": [sys.executable, "-c", test_code],
+            "correct": [sys.executable, "-c", correct_code],
+        }
+        return ComparisonTestWorker(
+            str(temp_workspace), {}, test_count=1, execution_commands=commands
+        )
+
+    def test_match_keeps_no_outputs(self, temp_workspace):
+        """Outputs equal up to surrounding whitespace pass without being stored."""
+        worker = self._make_worker(
+            temp_workspace, "print('1\\n2\\n3  ')", "print('\\n1\\n2\\n3')"
+        )
+
+        result = worker._run_comparison(1)
+
+        assert result["passed"] is True
+        assert result["test_output_hash"] == result["correct_output_hash"]
+        assert result["test_output_full"] == ""
+        assert "diff" not in result
+
+    def test_mismatch_stores_outputs_and_diff(self, temp_workspace):
+        """A mismatch keeps both outputs and locates the first differing line."""
+        worker = self._make_worker(temp_workspace, "print('1\\n2\\n4')", "print('1\\n2\\n3')")
+
+        result = worker._run_comparison(1)
+
+        assert result["passed"] is False
+        assert result["error_details"] == "Output mismatch"
+        assert result["test_output_full"] == "1\n2\n4\n"
+        assert result["diff"]["line"] == 3
+        assert (result["diff"]["expected"], result["diff"]["actual"]) == ("3", "4")
@@ -0,0 +1,100 @@
+"""
+Unit tests for TournamentTestWorker.
+
+Runs small Python solutions as real processes: every solution gets the
+same generated input, in a run order reproducible from the test seed.
+"""
+
+import sys
+
+import pytest
+
+from src.app.core.tools.specialized.tournament_test_worker import TournamentTestWorker
+
+
+def _make_worker(temp_workspace, solutions, generator="print(3)"):
+    commands = {"generator": [sys.executable, "-c", generator]}
+    commands.update({key: [sys.executable, "-c", code] for key, code in solutions.items()})
+    worker = TournamentTestWorker(
+        str(temp_workspace),
+        {},
+        time_limit=5000,
+        memory_limit=1024,
+        test_count=1,
+        execution_commands=commands,
+        solutions={key: f"{key}.py" for key in solutions},
+    )
+    worker.run_seed = 7
+    return worker
+
+
+class TestTournamentWorker:
+    """Test running all solutions on a shared input."""
+
+    def test_all_solutions_run_on_same_input(self, temp_workspace):
+        """Each solution is measured once per test on the generated input."""
+        worker = _make_worker(
+            temp_workspace,
+            {
+                "test": "n = int(input()); print(n * 2)",
+                "solution_1": "n = int(input()); print(n + n)",
+                "solution_2": "n = int(input()); print(n * 3)",
+            },
+        )
+
+        result = worker._run_single_test(1)
+
+        assert result["passed"] is True
+        assert result["input"].strip() == "3"
+        assert result["output"].strip() == "6"
+        runs = result["tournament"]
+        assert set(runs) == {"test", "solution_1", "solution_2"}
+        assert sorted(r["position"] for r in runs.values()) == [0, 1, 2]
+        assert all(r["passed"] and r["execution_time"] > 0 for r in runs.values())
+        # Equal outputs hash alike, a different one does not
+        assert runs["test"]["output_hash"] == runs["solution_1"]["output_hash"]
+        assert runs["test"]["output_hash"] != runs["solution_2"]["output_hash"]
+
+    def test_run_order_is_reproducible_from_seed(self, temp_workspace):
+        """The shuffled order only depends on the run seed and test number."""
+        solutions = {key: "print(1)" for key in ("test", "a", "b", "c", "d")}
+        worker = _make_worker(temp_workspace, solutions)
+        again = _make_worker(temp_workspace, solutions)
+
+        orders = {tuple(worker._run_order(n)) for n in range(1, 21)}
+
+        assert worker._run_order(5) == again._run_order(5)
+        assert len(orders) > 1
+
+    def test_crashing_solution_is_recorded(self, temp_workspace):
+        """A failing competitor does not fail the test solution's result."""
+        worker = _make_worker(
+            temp_workspace, {"test": "print(input())", "solution_1": "raise SystemExit(3)"}
+        )
+
+        result = worker._run_single_test(1)
+
+        assert result["passed"] is True
+        crashed = result["tournament"]["solution_1"]
+        assert crashed["passed"] is False
+        assert "exit code 3" in crashed["error_details"]
+
+    def test_role_environment_applies_to_its_runs(self, temp_workspace):
+        """Variant runs (e.g. a preloaded allocator) get their environment overrides."""
+        code = "import os; input(); print(os.environ.get('CTS_VARIANT', 'none'))"
+        worker = _make_worker(temp_workspace, {"test": code, "test@variant": code})
+        worker.role_environments = {"test@variant": {"CTS_VARIANT": "on"}}
+
+        result = worker._run_single_test(1)
+
+        runs = result["tournament"]
+        assert runs["test"]["output_hash"] != runs["test@variant"]["output_hash"]
+        assert result["output"].strip() == "none"
+
+    def test_requires_test_solution(self, temp_workspace):
+        """The reported result always belongs to the test solution."""
+        with pytest.raises(ValueError):
+            TournamentTestWorker(
+                str(temp_workspace), {}, time_limit=1000, memory_limit=256,
+                solutions={"solution_1": "a.py"},
+            )